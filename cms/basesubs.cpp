@@ -51,36 +51,44 @@ public:
 };
 
 
-class ImgFileDimensions : public ScriptMacroprocessorMacro {
+    // base class for macros which take a file name as the first param
+class FileMacro : public ScriptMacroprocessorMacro {
     ScriptVariable basepath;
+    FileAccessObserver * const *observer;
 public:
-    ImgFileDimensions(const ScriptVariable &bp)
-        : ScriptMacroprocessorMacro("imgdim"), basepath(bp)
-    {}
+    FileMacro(const char *name, const ScriptVariable &bp,
+              FileAccessObserver * const *obs)
+        : ScriptMacroprocessorMacro(name), basepath(bp), observer(obs) {}
+protected:
+    ScriptVariable FileName(ScriptVariable p0) const;
+};
+
+class ImgFileDimensions : public FileMacro {
+public:
+    ImgFileDimensions(const ScriptVariable &bp,
+                      FileAccessObserver * const *obs)
+        : FileMacro("imgdim", bp, obs) {}
     ScriptVariable Expand(const ScriptVector &params) const;
 };
 
-class IfFile : public ScriptMacroprocessorMacro {
-    ScriptVariable basepath;
+class IfFile : public FileMacro {
 public:
-    IfFile(const ScriptVariable &bp)
-        : ScriptMacroprocessorMacro("iffile"), basepath(bp) {}
+    IfFile(const ScriptVariable &bp, FileAccessObserver * const *obs)
+        : FileMacro("iffile", bp, obs) {}
     ScriptVariable Expand(const ScriptVector &params) const;
 };
 
-class FileSize : public ScriptMacroprocessorMacro {
-    ScriptVariable basepath;
+class FileSize : public FileMacro {
 public:
-    FileSize(const ScriptVariable &bp)
-        : ScriptMacroprocessorMacro("filesize"), basepath(bp) {}
+    FileSize(const ScriptVariable &bp, FileAccessObserver * const *obs)
+        : FileMacro("filesize", bp, obs) {}
     ScriptVariable Expand(const ScriptVector &params) const;
 };
 
-class ReadFile : public ScriptMacroprocessorMacro {
-    ScriptVariable basepath;
+class ReadFile : public FileMacro {
 public:
-    ReadFile(const ScriptVariable &bp)
-        : ScriptMacroprocessorMacro("readfile"), basepath(bp) {}
+    ReadFile(const ScriptVariable &bp, FileAccessObserver * const *obs)
+        : FileMacro("readfile", bp, obs) {}
     ScriptVariable Expand(const ScriptVector &params) const;
 };
 
@@ -261,11 +269,8 @@ ScriptVariable SwitchForm::Expand(const ScriptVector &params) const
 }
 
 
-ScriptVariable IfFile::Expand(const ScriptVector &params) const
+ScriptVariable FileMacro::FileName(ScriptVariable p0) const
 {
-    if(params.Length() < 2)
-        return ScriptVariableInv();
-    ScriptVariable p0 = params[0];
     p0.Trim();
     ScriptVariable fname;
     if(p0[0] == '/') {
@@ -276,6 +281,16 @@ ScriptVariable IfFile::Expand(const ScriptVector &params) const
         else
             fname = p0;
     }
+    if(*observer)
+        (*observer)->FileAccessed(fname);
+    return fname;
+}
+
+ScriptVariable IfFile::Expand(const ScriptVector &params) const
+{
+    if(params.Length() < 2)
+        return ScriptVariableInv();
+    ScriptVariable fname = FileName(params[0]);
         // %[iffile:filename:then:else]
     FileStat fs(fname.c_str());
     ScriptVariable res = fs.Exists() ? params[1] : params[2];
@@ -288,17 +303,7 @@ ScriptVariable FileSize::Expand(const ScriptVector &params) const
 {
     if(params.Length() < 1)
         return ScriptVariableInv();
-    ScriptVariable p0 = params[0];
-    p0.Trim();
-    ScriptVariable fname;
-    if(p0[0] == '/') {
-        fname = p0;
-    } else {
-        if(basepath.Length() > 0)
-            fname = basepath + "/" + p0;
-        else
-            fname = p0;
-    }
+    ScriptVariable fname = FileName(params[0]);
     FileStat fs(fname.c_str());
     if(!fs.Exists() || !fs.IsRegularFile())
         return "";
@@ -313,15 +318,7 @@ ScriptVariable ReadFile::Expand(const ScriptVector &params) const
     p0.Trim();
     if(p0 == "")
         return "";
-    ScriptVariable fname;
-    if(p0[0] == '/') {
-        fname = p0;
-    } else {
-        if(basepath.Length() > 0)
-            fname = basepath + "/" + p0;
-        else
-            fname = p0;
-    }
+    ScriptVariable fname = FileName(p0);
     ReadText rt(fname.c_str());
     if(!rt.IsOpen())
         return "";
@@ -334,17 +331,7 @@ ScriptVariable ImgFileDimensions::Expand(const ScriptVector &params) const
 {
     if(params.Length() < 1)
         return ScriptVariableInv();
-    ScriptVariable p0 = params[0];
-    p0.Trim();
-    ScriptVariable fname;
-    if(p0[0] == '/') {
-        fname = p0;
-    } else {
-        if(basepath.Length() > 0)
-            fname = basepath + "/" + p0;
-        else
-            fname = p0;
-    }
+    ScriptVariable fname = FileName(params[0]);
     int w, h, res;
     res = extract_image_dimensions(fname.c_str(), &w, &h);
     if(res)
@@ -497,6 +484,7 @@ ScriptVariable NowTime::Expand(const ScriptVector &params) const
 
 
 BaseSubstitutions::BaseSubstitutions(const char *bp)
+    : file_observer(0)
 {
     AddMacro(new IfForm);                                 // [if: ]
     AddMacro(new OrForm);                                 // [or: ]
@@ -510,10 +498,10 @@ BaseSubstitutions::BaseSubstitutions(const char *bp)
     AddMacro(new Trim);                                   // [trim: ]
     AddMacro(new SubstitutionLtGt);                       // [ltgt: ]
     AddMacro(new SubstitutionURLEnc);                     // [urlenc: ]
-    AddMacro(new IfFile(bp));                             // [iffile: ]
-    AddMacro(new FileSize(bp));                           // [filesize: ]
-    AddMacro(new ReadFile(bp));                           // [readfile: ]
-    AddMacro(new ImgFileDimensions(bp));                  // [imgdim: ]
+    AddMacro(new IfFile(bp, &file_observer));             // [iffile: ]
+    AddMacro(new FileSize(bp, &file_observer));           // [filesize: ]
+    AddMacro(new ReadFile(bp, &file_observer));           // [readfile: ]
+    AddMacro(new ImgFileDimensions(bp, &file_observer));  // [imgdim: ]
     AddMacro(new MacroRFC2822Date);                       // [rfcdate: ]
     AddMacro(new NowTime);                                // [now]
 }
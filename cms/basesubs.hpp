@@ -16,10 +16,20 @@ public:
 
 
 
+    // gets notified about files the macros (readfile, imgdim etc.) use
+class FileAccessObserver {
+public:
+    virtual ~FileAccessObserver() {}
+    virtual void FileAccessed(const ScriptVariable &path) = 0;
+};
+
 class BaseSubstitutions : public ScriptMacroprocessor {
+    FileAccessObserver *file_observer;  // not owned, may be null
 public:
     BaseSubstitutions(const char *basepath);
     ~BaseSubstitutions();
+
+    void SetFileObserver(FileAccessObserver *o) { file_observer = o; }
 };
 
 #endif
@@ -1,5 +1,3 @@
-#include <stdlib.h>    // for getenv
-
 #include "xcgi.hpp"
 
 #include "cgicmsub.hpp"
@@ -58,8 +56,10 @@ ScriptVariable VarRequestData::DoExpand(const ScriptVector &params) const
 ///////////////////////////////////////////////////////////////////////////
 
 class VarGetEnv : public ScriptMacroprocessorMacro {
+    const Cgi *req;
 public:
-    VarGetEnv() : ScriptMacroprocessorMacro("getenv", true /*dirty*/) {}
+    VarGetEnv(const Cgi *c)
+        : ScriptMacroprocessorMacro("getenv", true /*dirty*/), req(c) {}
     ScriptVariable Expand(const ScriptVector &params) const;
 };
 
@@ -69,7 +69,7 @@ ScriptVariable VarGetEnv::Expand(const ScriptVector &params) const
         return ScriptVariableInv();
     ScriptVariable s = params[0];
     s.Trim();
-    const char *tmp = getenv(s.c_str());
+    const char *tmp = req->GetEnv(s.c_str());
     return tmp ? tmp : "";
 }
 
@@ -79,7 +79,7 @@ ScriptVariable VarGetEnv::Expand(const ScriptVector &params) const
 CommonCgiSubstitutions::CommonCgiSubstitutions(const Cgi *cgi)
     : BaseSubstitutions("")
 {
-    AddMacro(new VarGetEnv);                              // [getenv: ]
+    AddMacro(new VarGetEnv(cgi));                         // [getenv: ]
     AddMacro(new VarRequestData(cgi));                    // [req: ]
 }
 
@@ -0,0 +1,413 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <scriptpp/scrvect.hpp>
+#include <scriptpp/scrmsg.hpp>
+#include <scriptpp/cmd.hpp>
+
+#include "cmtindex.hpp"
+
+
+    // please note this macro is also set and used in dbforum.cpp and
+    // tcgi_rpl.cpp
+#ifndef MAX_COMMENT_ID
+#define MAX_COMMENT_ID 50000
+#endif
+
+    // bump the version whenever the record layout changes; the version
+    // number also catches files written with the other byte order
+#define INDEX_MAGIC "THCI"
+#define INDEX_VERSION 2
+
+struct index_file_header {
+    char magic[4];
+    int version;
+    int record_size;
+    int count;
+};
+
+static long long stat_mtime_ns(const struct stat &st)
+{
+    return (long long)st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+}
+
+unsigned int comment_flags_bitmap(const ScriptVariable &flags_header)
+{
+    if(flags_header.IsInvalid())
+        return 0;
+    ScriptVector vf(flags_header, ",", " \t\r\n");
+    unsigned int res = 0;
+    int i;
+    for(i = 0; i < vf.Length(); i++) {
+        if(vf[i] == "")
+            continue;
+        if(vf[i] == "anon")
+            res |= cmtidx_flag_anon;
+        else
+        if(vf[i] == "hidden")
+            res |= cmtidx_flag_hidden;
+        else
+        if(vf[i] == "premod")
+            res |= cmtidx_flag_premod;
+        else
+            res |= cmtidx_flag_other;
+    }
+    return res;
+}
+
+CommentIndex::CommentIndex(const ScriptVariable &d)
+    : dir(d), recs(0), count(0), alloc(0), fd(-1), lock_mode(0), dirty(false)
+{
+}
+
+CommentIndex::~CommentIndex()
+{
+    if(fd != -1)
+        close(fd);     // this releases the lock as well
+    if(recs)
+        delete[] recs;
+}
+
+bool CommentIndex::OpenIndex(bool create)
+{
+    if(fd != -1)
+        return true;
+    ScriptVariable fname = dir + "/" INDEX_FNAME;
+    fd = open(fname.c_str(), create ? O_RDWR|O_CREAT : O_RDWR, 0666);
+    if(fd == -1)
+        fd = open(fname.c_str(), O_RDONLY);
+    return fd != -1;
+}
+
+bool CommentIndex::Lock()
+{
+    if(!OpenIndex(true))
+        return false;
+    if(lock_mode == LOCK_EX)
+        return true;
+    if(flock(fd, LOCK_EX) == -1)
+        return false;
+    lock_mode = LOCK_EX;
+    return true;
+}
+
+void CommentIndex::ProvideRoom(int n)
+{
+    if(n <= alloc)
+        return;
+    int newsize = alloc ? alloc : 64;
+    while(newsize < n)
+        newsize *= 2;
+    CommentIndexRecord *tmp = new CommentIndexRecord[newsize];
+    if(count > 0)
+        memcpy(tmp, recs, count * sizeof(*recs));
+    if(recs)
+        delete[] recs;
+    recs = tmp;
+    alloc = newsize;
+}
+
+bool CommentIndex::ReadIndex()
+{
+    count = 0;
+    struct stat st;
+    if(fstat(fd, &st) == -1)
+        return false;
+    struct index_file_header hdr;
+    if(st.st_size < (off_t)sizeof(hdr))
+        return false;
+    if(pread(fd, &hdr, sizeof(hdr), 0) != (ssize_t)sizeof(hdr))
+        return false;
+    if(memcmp(hdr.magic, INDEX_MAGIC, 4) != 0 ||
+        hdr.version != INDEX_VERSION ||
+        hdr.record_size != (int)sizeof(CommentIndexRecord) ||
+        hdr.count < 0 || hdr.count > MAX_COMMENT_ID ||
+        st.st_size !=
+            (off_t)(sizeof(hdr) + hdr.count * sizeof(CommentIndexRecord)))
+    {
+        return false;
+    }
+    ProvideRoom(hdr.count);
+    int size = hdr.count * sizeof(CommentIndexRecord);
+    if(size > 0 && pread(fd, recs, size, sizeof(hdr)) != size)
+        return false;
+    int i;
+    for(i = 0; i < hdr.count; i++)     // must be sorted and sane
+        if(recs[i].id < 1 || (i > 0 && recs[i].id <= recs[i-1].id))
+            return false;
+    count = hdr.count;
+    return true;
+}
+
+bool CommentIndex::Load(bool verify)
+{
+    count = 0;
+    dirty = false;
+    struct stat dst, ist;
+    if(stat(dir.c_str(), &dst) == -1 || !S_ISDIR(dst.st_mode))
+        return false;
+
+        // in case we can't have the index file, we still build the
+        // index in memory, so the caller gets its data anyway
+    bool own_lock = false;
+    if(OpenIndex(true) && lock_mode == 0) {
+        if(flock(fd, LOCK_SH) != -1) {
+            lock_mode = LOCK_SH;
+            own_lock = true;
+        }
+    }
+    bool fresh = false;
+    if(fd != -1 && ReadIndex() && fstat(fd, &ist) != -1)
+        fresh = stat_mtime_ns(dst) < stat_mtime_ns(ist);
+
+    if(!fresh || verify) {
+        if(lock_mode == LOCK_SH && own_lock) {
+                // the lock can't be upgraded atomically, so after we get
+                // it exclusive, someone could have fixed the index already
+            if(flock(fd, LOCK_EX) != -1) {
+                lock_mode = LOCK_EX;
+                fresh = false;
+                stat(dir.c_str(), &dst);
+                if(ReadIndex() && fstat(fd, &ist) != -1)
+                    fresh = stat_mtime_ns(dst) < stat_mtime_ns(ist);
+            }
+        }
+        if(!fresh) {
+            if(!Rescan())
+                return false;
+        } else {
+            int i;
+            for(i = 0; i < count; i++) {
+                if(RecordIsFresh(recs[i]))
+                    continue;
+                CommentIndexRecord rec;
+                if(ReadRecord(recs[i].id, recs[i].plain_name, rec)) {
+                    recs[i] = rec;
+                } else {   // the comment is gone
+                    memmove(recs+i, recs+i+1, (count-i-1) * sizeof(*recs));
+                    count--;
+                    i--;
+                }
+                dirty = true;
+            }
+        }
+        if(dirty && lock_mode == LOCK_EX)
+            Save();
+    }
+
+    if(own_lock) {
+        flock(fd, LOCK_UN);
+        lock_mode = 0;
+    }
+    return true;
+}
+
+bool CommentIndex::Save()
+{
+    if(fd == -1 || lock_mode != LOCK_EX)
+        return false;
+    struct index_file_header hdr;
+    memcpy(hdr.magic, INDEX_MAGIC, 4);
+    hdr.version = INDEX_VERSION;
+    hdr.record_size = sizeof(CommentIndexRecord);
+    hdr.count = count;
+    int size = count * sizeof(CommentIndexRecord);
+
+        // the file is rewritten in place rather than replaced, because
+        // creating a new file would modify the directory and thus make
+        // the index look stale
+    if(pwrite(fd, &hdr, sizeof(hdr), 0) != (ssize_t)sizeof(hdr))
+        return false;
+    if(size > 0 && pwrite(fd, recs, size, sizeof(hdr)) != size)
+        return false;
+    if(ftruncate(fd, sizeof(hdr) + size) == -1)
+        return false;
+    dirty = false;
+    return true;
+}
+
+ScriptVariable CommentIndex::CommentPath(const CommentIndexRecord &rec) const
+{
+    return dir + ScriptVariable(30, rec.plain_name ? "/%d" : "/%04d", rec.id);
+}
+
+bool CommentIndex::RecordIsFresh(const CommentIndexRecord &rec) const
+{
+    struct stat st;
+    if(stat(CommentPath(rec).c_str(), &st) == -1)
+        return false;
+    return st.st_size == rec.file_size && stat_mtime_ns(st) == rec.mtime;
+}
+
+bool CommentIndex::ReadRecord(int id, bool plain_name,
+                              CommentIndexRecord &rec) const
+{
+    memset(&rec, 0, sizeof(rec));
+    rec.id = id;
+    rec.plain_name = plain_name ? 1 : 0;
+    int cfd = open(CommentPath(rec).c_str(), O_RDONLY);
+    if(cfd == -1)
+        return false;
+    struct stat st;
+    if(fstat(cfd, &st) == -1 || !S_ISREG(st.st_mode)) {
+        close(cfd);
+        return false;
+    }
+    rec.file_size = st.st_size;
+    rec.mtime = stat_mtime_ns(st);
+
+        // only the headers are needed, so we read until the body begins
+    HeadedTextMessage parser(false);
+    unsigned char buf[4096];    // unsignedness is critical here!
+    int rc;
+    bool done = false;
+    while(!done && (rc = read(cfd, buf, sizeof(buf))) > 0) {
+        int i;
+        for(i = 0; i < rc; i++) {
+            if(!parser.FeedChar(buf[i]) || parser.InBody()) {
+                done = true;
+                break;
+            }
+        }
+    }
+    close(cfd);
+
+    long n;
+    ScriptVariable v = parser.FindHeader("parent");
+    if(v.IsValid() && v.GetLong(n, 10) && n > 0 && n <= MAX_COMMENT_ID)
+        rec.parent = n;
+    long long ut;
+    v = parser.FindHeader("unixtime");
+    if(v.IsValid() && v.GetLongLong(ut, 10))
+        rec.unixtime = ut;
+    rec.flags = comment_flags_bitmap(parser.FindHeader("flags"));
+    return true;
+}
+
+static int record_id_cmp(const void *a, const void *b)
+{
+    return ((const CommentIndexRecord*)a)->id -
+           ((const CommentIndexRecord*)b)->id;
+}
+
+bool CommentIndex::Rescan()
+{
+    ReadDir rd(dir.c_str());
+    if(!rd.OpenOk())
+        return false;
+    int oldcount = count;
+    CommentIndexRecord *old = 0;
+    if(oldcount > 0) {
+        old = new CommentIndexRecord[oldcount];
+        memcpy(old, recs, oldcount * sizeof(*recs));
+    }
+    count = 0;
+    const char *nm;
+    while((nm = rd.Next())) {
+        if(!*nm || *nm == '.' || *nm == '_')
+            continue;
+        ScriptVariable v(nm);
+        long id;
+        if(!v.GetLong(id, 10) || id < 1 || id > MAX_COMMENT_ID)
+            continue;
+        CommentIndexRecord rec;
+        rec.id = id;
+        rec.plain_name = v != ScriptVariable(30, "%04d", (int)id);
+
+            // unchanged files are taken from the old index as they are
+        const CommentIndexRecord *orec = 0;
+        if(old) {
+            orec = (const CommentIndexRecord*)
+                bsearch(&rec, old, oldcount, sizeof(*old), record_id_cmp);
+        }
+        if(orec && orec->plain_name == rec.plain_name && RecordIsFresh(*orec))
+            rec = *orec;
+        else
+        if(!ReadRecord(id, rec.plain_name, rec))
+            continue;
+        ProvideRoom(count + 1);
+        recs[count] = rec;
+        count++;
+    }
+    if(old)
+        delete[] old;
+    qsort(recs, count, sizeof(*recs), record_id_cmp);
+        // in case both "12" and "0012" exist, the latter wins
+    int i, j;
+    for(i = 0, j = 0; i < count; i++) {
+        if(j > 0 && recs[j-1].id == recs[i].id) {
+            if(!recs[i].plain_name)
+                recs[j-1] = recs[i];
+            continue;
+        }
+        recs[j] = recs[i];
+        j++;
+    }
+    count = j;
+    dirty = true;
+    return true;
+}
+
+const CommentIndexRecord *CommentIndex::Find(int id) const
+{
+    int lo = 0, hi = count - 1;
+    while(lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if(recs[mid].id == id)
+            return recs + mid;
+        if(recs[mid].id < id)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+    return 0;
+}
+
+void CommentIndex::Insert(const CommentIndexRecord &rec)
+{
+    ProvideRoom(count + 1);
+    int i = count;
+    while(i > 0 && recs[i-1].id > rec.id) {
+        recs[i] = recs[i-1];
+        i--;
+    }
+    recs[i] = rec;
+    count++;
+    dirty = true;
+}
+
+bool CommentIndex::UpdateRecord(int id)
+{
+    CommentIndexRecord rec;
+    const CommentIndexRecord *old = Find(id);
+    bool plain = old && old->plain_name;
+    bool ok = ReadRecord(id, plain, rec);
+    if(!ok && !old && id < 1000)
+        ok = ReadRecord(id, true, rec);
+    if(!ok) {
+        RemoveRecord(id);
+        return false;
+    }
+    if(old)
+        *const_cast<CommentIndexRecord*>(old) = rec;
+    else
+        Insert(rec);
+    dirty = true;
+    return true;
+}
+
+void CommentIndex::RemoveRecord(int id)
+{
+    const CommentIndexRecord *r = Find(id);
+    if(!r)
+        return;
+    int i = r - recs;
+    memmove(recs+i, recs+i+1, (count-i-1) * sizeof(*recs));
+    count--;
+    dirty = true;
+}
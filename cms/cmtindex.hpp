@@ -0,0 +1,96 @@
+#ifndef CMTINDEX_HPP_SENTRY
+#define CMTINDEX_HPP_SENTRY
+
+#include <scriptpp/scrvar.hpp>
+
+/* The comment index is a binary file named "_index" within a comment
+   directory (next to "_hints"); it holds one fixed-size record per
+   comment, sorted by id, so the tree of comments (and the list of their
+   ids) is obtained by reading one file instead of opening and parsing
+   every comment.
+
+   Just like the hints, the index is a cache, not the data: if it is
+   absent, corrupt, written on a machine with different byte order
+   or stale, it is rebuilt from the comment files.  The index is
+   considered stale if the directory has been modified (that is,
+   files were added or removed) since the index was last written; if
+   verification is requested, the mtime and size of every comment file
+   are compared to those stored in the record, too, and the records
+   for changed files are recomputed.
+
+   The writers (see tcgi_rpl.cpp) lock the index, load it BEFORE they
+   change the directory, then update the record and save the index, so
+   the index remains fresh and no rescan is needed.  All access to the
+   index file is done under flock(2).
+ */
+
+#ifndef INDEX_FNAME
+#define INDEX_FNAME "_index"
+#endif
+
+enum comment_index_flags {
+    cmtidx_flag_anon   = 0x01,
+    cmtidx_flag_hidden = 0x02,
+    cmtidx_flag_premod = 0x04,
+    cmtidx_flag_other  = 0x80     /* anything not listed above */
+};
+
+struct CommentIndexRecord {
+    int id, parent;
+    unsigned int flags;
+    int file_size;
+    int plain_name;         /* the file is named "12" rather than "0012" */
+    long long unixtime;     /* 0 if there's no valid unixtime header */
+    long long mtime;        /* of the comment file, in nanoseconds */
+};
+
+class CommentIndex {
+    ScriptVariable dir;
+    CommentIndexRecord *recs;
+    int count, alloc;
+    int fd, lock_mode;
+    bool dirty;
+public:
+    CommentIndex(const ScriptVariable &dir);
+    ~CommentIndex();
+
+        // exclusive lock for writers; MUST be taken before Load, and
+        // before the directory is modified; released by the destructor
+    bool Lock();
+
+        // returns false if the directory can't be read; the index file
+        // is rewritten if it had to be rebuilt or updated
+    bool Load(bool verify);
+
+        // false if the index can't be written (e.g. no permissions)
+    bool Save();
+
+        // (re)read the headers of the given comment; if the file
+        // doesn't exist, the record is removed
+    bool UpdateRecord(int id);
+    void RemoveRecord(int id);
+
+    int Count() const { return count; }
+    const CommentIndexRecord &operator[](int i) const { return recs[i]; }
+    const CommentIndexRecord *Find(int id) const;
+    int GetMaxId() const { return count > 0 ? recs[count-1].id : 0; }
+
+    ScriptVariable CommentPath(const CommentIndexRecord &rec) const;
+
+        // true if the comment file still has the size and mtime stored
+        // in the record, so the record can be trusted
+    bool RecordIsFresh(const CommentIndexRecord &rec) const;
+
+private:
+    bool OpenIndex(bool create);
+    bool ReadIndex();
+    bool Rescan();
+    bool ReadRecord(int id, bool plain_name, CommentIndexRecord &rec) const;
+    void Insert(const CommentIndexRecord &rec);
+    void ProvideRoom(int n);
+};
+
+    // the flags header converted to the bitmap
+unsigned int comment_flags_bitmap(const ScriptVariable &flags_header);
+
+#endif
@@ -4,6 +4,8 @@
 #include <scriptpp/cmd.hpp>
 
 #include <stdio.h>
+#include <sys/types.h>
+#include <sys/stat.h>
 #include <time.h>   // XXX for ctime -- remove once ctime is removed
 
 enum { too_long_for_filename = 128 };
@@ -15,6 +17,7 @@ enum { too_long_for_filename = 128 };
 #include "arrindex.hpp"
 #include "dbforum.hpp"
 #include "forumgen.hpp"
+#include "depgraph.hpp"
 
 #include "database.hpp"
 
@@ -50,11 +53,193 @@ bool CommentData::HasFlag(const ScriptVariable &f) const
 
 /* We need this structure for the ``set''-based lists only  */
 struct SetListIndex {
-    ScriptVariable set_id, tag;
+    ScriptVariable set_id, tag, path;
     ScriptVector items;
     SetListIndex *next;
 };
 
+/* Parsed set items are kept in this cache, so that an item which is
+   included into several lists (and has its own page as well) is read
+   and converted only once per run.  The entries are checked against
+   the source's mtime and size (see set_item_stamp), and once the total
+   (approximate) size exceeds the limit, the least recently used entries
+   are dropped.
+ */
+struct SetItemCacheEntry {
+    ScriptVariable key, stamp;
+    ListItemData data;
+    long size;
+    SetItemCacheEntry *hash_next;
+    SetItemCacheEntry *lru_prev, *lru_next;  // lru_prev is more recent
+};
+
+class SetItemCache {
+    SetItemCacheEntry **table;
+    int table_size, count;
+    long total_size, limit;
+    SetItemCacheEntry *lru_first, *lru_last;
+public:
+    SetItemCache(long lim);
+    ~SetItemCache();
+    const ListItemData *Find(const ScriptVariable &key,
+                             const ScriptVariable &stamp);
+    void Add(const ScriptVariable &key, const ScriptVariable &stamp,
+             const ListItemData &data);
+private:
+    unsigned int Hash(const ScriptVariable &key) const;
+    void Remove(SetItemCacheEntry *e);
+    void LruUnlink(SetItemCacheEntry *e);
+    void LruPushFront(SetItemCacheEntry *e);
+    void ResizeTable();
+};
+
+SetItemCache::SetItemCache(long lim)
+    : table_size(256), count(0), total_size(0), limit(lim),
+    lru_first(0), lru_last(0)
+{
+    table = new SetItemCacheEntry*[table_size];
+    int i;
+    for(i = 0; i < table_size; i++)
+        table[i] = 0;
+}
+
+SetItemCache::~SetItemCache()
+{
+    while(lru_first) {
+        SetItemCacheEntry *tmp = lru_first;
+        lru_first = lru_first->lru_next;
+        delete tmp;
+    }
+    delete[] table;
+}
+
+static unsigned int string_hash(const ScriptVariable &s)
+{
+    unsigned int h = 5381;
+    const char *p;
+    for(p = s.c_str(); *p; p++)
+        h = h * 33 + (unsigned char)*p;
+    return h;
+}
+
+unsigned int SetItemCache::Hash(const ScriptVariable &key) const
+{
+    return string_hash(key);
+}
+
+const ListItemData *SetItemCache::Find(const ScriptVariable &key,
+                                       const ScriptVariable &stamp)
+{
+    SetItemCacheEntry *e;
+    for(e = table[Hash(key) % table_size]; e; e = e->hash_next) {
+        if(e->key != key)
+            continue;
+        if(e->stamp != stamp) {   // the source has changed
+            Remove(e);
+            return 0;
+        }
+        LruUnlink(e);
+        LruPushFront(e);
+        return &e->data;
+    }
+    return 0;
+}
+
+static long estimate_item_size(const ListItemData &d)
+{
+    long sz = sizeof(d) + d.item_id.Length() + d.date.Length() +
+        d.title.Length() + d.descr.Length() + d.text.Length() +
+        d.pgtype.Length() + d.comments.Length();
+    int i;
+    for(i = 0; i < d.aux_params.Length(); i++)
+        sz += d.aux_params[i].Length();
+    for(i = 0; i < d.tags.Length(); i++)
+        sz += d.tags[i].Length();
+    for(i = 0; i < d.files.Length(); i++)
+        sz += d.files[i].Length();
+    return sz;
+}
+
+void SetItemCache::Add(const ScriptVariable &key, const ScriptVariable &stamp,
+                       const ListItemData &data)
+{
+    long sz = estimate_item_size(data) + key.Length() + stamp.Length();
+    if(sz > limit)
+        return;
+    while(lru_last && total_size + sz > limit)
+        Remove(lru_last);
+
+    SetItemCacheEntry *e = new SetItemCacheEntry;
+    e->key = key;
+    e->stamp = stamp;
+    e->data = data;
+    e->size = sz;
+    int h = Hash(key) % table_size;
+    e->hash_next = table[h];
+    table[h] = e;
+    LruPushFront(e);
+    total_size += sz;
+    count++;
+    if(count > 2 * table_size)
+        ResizeTable();
+}
+
+void SetItemCache::Remove(SetItemCacheEntry *e)
+{
+    SetItemCacheEntry **pp = &table[Hash(e->key) % table_size];
+    while(*pp != e)
+        pp = &(*pp)->hash_next;
+    *pp = e->hash_next;
+    LruUnlink(e);
+    total_size -= e->size;
+    count--;
+    delete e;
+}
+
+void SetItemCache::LruUnlink(SetItemCacheEntry *e)
+{
+    if(e->lru_prev)
+        e->lru_prev->lru_next = e->lru_next;
+    else
+        lru_first = e->lru_next;
+    if(e->lru_next)
+        e->lru_next->lru_prev = e->lru_prev;
+    else
+        lru_last = e->lru_prev;
+}
+
+void SetItemCache::LruPushFront(SetItemCacheEntry *e)
+{
+    e->lru_prev = 0;
+    e->lru_next = lru_first;
+    if(lru_first)
+        lru_first->lru_prev = e;
+    else
+        lru_last = e;
+    lru_first = e;
+}
+
+void SetItemCache::ResizeTable()
+{
+    int newsize = table_size * 4;
+    SetItemCacheEntry **newtbl = new SetItemCacheEntry*[newsize];
+    int i;
+    for(i = 0; i < newsize; i++)
+        newtbl[i] = 0;
+    for(i = 0; i < table_size; i++) {
+        while(table[i]) {
+            SetItemCacheEntry *e = table[i];
+            table[i] = e->hash_next;
+            int h = Hash(e->key) % newsize;
+            e->hash_next = newtbl[h];
+            newtbl[h] = e;
+        }
+    }
+    delete[] table;
+    table = newtbl;
+    table_size = newsize;
+}
+
 /////////////////////////////////
 // BlockGroups must be defined before the Database's destructor
 
@@ -91,12 +276,63 @@ BlockGroupData::~BlockGroupData()
     }
 }
 
+/* Compiled forms of the templates taken from the ini file, such as the
+   list item and comment templates, which are expanded over and over;
+   they are keyed by the text itself.  There can't be more of them than
+   the ini file contains, so nothing is ever dropped.
+ */
+class TemplateCache {
+    enum { table_size = 64 };
+    struct Entry {
+        ScriptMacroTemplate templ;
+        Entry *next;
+        Entry(const ScriptVariable &text, Entry *nx)
+            : templ(text), next(nx) {}
+    };
+    Entry *table[table_size];
+public:
+    TemplateCache();
+    ~TemplateCache();
+    const ScriptMacroTemplate &Get(const ScriptVariable &text);
+};
+
+TemplateCache::TemplateCache()
+{
+    int i;
+    for(i = 0; i < table_size; i++)
+        table[i] = 0;
+}
+
+TemplateCache::~TemplateCache()
+{
+    int i;
+    for(i = 0; i < table_size; i++) {
+        while(table[i]) {
+            Entry *tmp = table[i];
+            table[i] = tmp->next;
+            delete tmp;
+        }
+    }
+}
+
+const ScriptMacroTemplate &TemplateCache::Get(const ScriptVariable &text)
+{
+    Entry **bucket = &table[string_hash(text) % table_size];
+    Entry *e;
+    for(e = *bucket; e; e = e->next)
+        if(e->templ.GetSource() == text)
+            return e->templ;
+    *bucket = new Entry(text, *bucket);
+    return (*bucket)->templ;
+}
+
 /////////////////////////////////
 
 
 Database::Database()
     : subst(0), filtmaker(0), current_list_data(0), current_list_item_data(0),
-    first_block_group(0), first_set_list(0)
+    first_block_group(0), first_set_list(0), item_cache(0), templ_cache(0),
+    deps(0)
 {
     inifile = new IniFileParser;
     // subst object is to be created after loading the inifile,
@@ -119,6 +355,10 @@ Database::~Database()
     }
     if(first_block_group)
         delete first_block_group;
+    if(item_cache)
+        delete item_cache;
+    if(templ_cache)
+        delete templ_cache;
 }
 
 void Database::SetOptSelector(const ScriptVariable &whatfor,
@@ -142,15 +382,30 @@ void Database::SetOptSelector(const ScriptVariable &whatfor,
 bool Database::Load(const char *filename)
 {
     bool ok = inifile->Load(filename);
+    loaded_files.AddItem(filename);
     if(subst)
         delete subst;
     subst = new DatabaseSubstitution(this);
+    subst->SetFileObserver(deps);
     if(default_opt_selector.IsValid())
         inifile->SetTextParameter("general", 0, "opt_selector",
                                   default_opt_selector.c_str());
     return ok;
 }
 
+void Database::SetDependencyRecorder(DependencyRecorder *r)
+{
+    deps = r;
+    if(subst)
+        subst->SetFileObserver(r);
+}
+
+void Database::NoteInput(const ScriptVariable &path) const
+{
+    if(deps)
+        deps->NoteInput(path);
+}
+
 void Database::MakeErrorMessage(class ScriptVariable &msg) const
 {
     msg = "";
@@ -722,11 +977,19 @@ ScriptVariable Database::BuildListItemPart(const ListData &lsd,
                                            const ScriptVariable &templ) const
 {
     //SetListData(&lsd, &itd);
-    ScriptVariable res = (*subst)(templ);
+    ScriptVariable res = subst->Process(CompiledTemplate(templ));
     //ForgetListCmtData();
     return res;
 }
 
+const ScriptMacroTemplate &
+Database::CompiledTemplate(const ScriptVariable &templ) const
+{
+    if(!templ_cache)
+        const_cast<Database*>(this)->templ_cache = new TemplateCache;
+    return templ_cache->Get(templ);
+}
+
 void Database::BuildListItemPage(const ListData &lsd, const ListItemData &itd,
                        ScriptVariable &main, ScriptVariable &tail,
                        ForumGenerator **fgp) const
@@ -1031,10 +1294,26 @@ bool Database::ScanSetTagItems(const ScriptVariable &set_id,
 #endif
 }
 
-FilterChainSet *Database::MakeFormatFilter(const HeadedTextMessage &msg) const
+const FilterChainSet *
+Database::GetFormatFilter(const HeadedTextMessage &msg) const
 {
     ProvideFilterChainMaker();
-    return filtmaker->MakeChainSet(msg.GetHeaders());
+    return filtmaker->GetChainSet(msg.GetHeaders());
+}
+
+long Database::GetIniLookupCount() const
+{
+    return inifile->GetLookupCount();
+}
+
+void Database::GetFormatFilterStats(int &built, int &reused) const
+{
+    if(filtmaker) {
+        filtmaker->GetStats(built, reused);
+    } else {
+        built = 0;
+        reused = 0;
+    }
 }
 
 bool Database::GetSetItemData(const PageSetData &setd, int idx,
@@ -1124,6 +1403,58 @@ GetSetItemSource(const ScriptVariable &set_id, const ScriptVariable &page_id,
     return true;
 }
 
+    // the cached item is valid while its source's mtime and size
+    // remain the same; for items having their own directories, the
+    // directory is checked as well, because of the attached files
+static ScriptVariable set_item_stamp(const ScriptVariable &srcd,
+                                     const ScriptVariable &fname,
+                                     bool it_is_dir)
+{
+    struct stat st;
+    if(stat(fname.c_str(), &st) == -1)
+        return ScriptVariableInv();
+    ScriptVariable res(64, "%lld.%09ld:%lld",
+                       (long long)st.st_mtim.tv_sec,
+                       (long)st.st_mtim.tv_nsec,
+                       (long long)st.st_size);
+    if(it_is_dir) {
+        if(stat(srcd.c_str(), &st) == -1)
+            return ScriptVariableInv();
+        res += ScriptVariable(64, "/%lld.%09ld",
+                              (long long)st.st_mtim.tv_sec,
+                              (long)st.st_mtim.tv_nsec);
+    }
+    return res;
+}
+
+SetItemCache *Database::ProvideItemCache() const
+{
+    if(!item_cache) {
+        long lim = inifile->GetIntegerParameter("general", 0,
+                                                "item_cache_limit", 65536);
+        if(lim <= 0)
+            return 0;
+        const_cast<Database*>(this)->item_cache =
+            new SetItemCache(lim * 1024);
+    }
+    return item_cache;
+}
+
+void Database::NoteSetItemInputs(const ScriptVariable &srcd,
+                                 const ScriptVariable &fname,
+                                 const ListItemData &itd) const
+{
+    if(!deps)
+        return;
+    NoteInput(fname);
+    if(itd.make_separate_directory) {
+        NoteInput(srcd);
+        int i;
+        for(i = 0; i < itd.files.Length(); i++)
+            NoteInput(srcd + "/" + itd.files[i]);
+    }
+}
+
 bool Database::GetSetItemDataById(const ScriptVariable &set_id,
                                   const ScriptVariable &page_id,
                                   ListItemData *itd) const
@@ -1134,28 +1465,37 @@ bool Database::GetSetItemDataById(const ScriptVariable &set_id,
     bool it_is_dir;
     bool ok = GetSetItemSource(set_id, page_id, srcd, fname, it_is_dir);
     if(!ok) {
+        NoteInput(srcd);
         itd->title = fname + ": file doesn't exist";
         return false;
     }
 
+    SetItemCache *cache = ProvideItemCache();
+    ScriptVariable cache_key, stamp;
+    if(cache) {
+        cache_key = set_id + "/" + page_id;
+        stamp = set_item_stamp(srcd, fname, it_is_dir);
+        const ListItemData *cached =
+            stamp.IsValid() ? cache->Find(cache_key, stamp) : 0;
+        if(cached) {
+            *itd = *cached;
+            NoteSetItemInputs(srcd, fname, *itd);
+            return true;
+        }
+    }
+
     itd->make_separate_directory = it_is_dir;
 
-    FILE *s = fopen(fname.c_str(), "r");
-    if(!s) {
+    HeadedTextMessage parser(false);
+    if(!parser.ReadFile(fname.c_str())) {
+        NoteInput(fname);
         itd->title = fname + ": couldn't open file";
         return false;
     }
-    int c;
-    HeadedTextMessage parser(false);
-    while((c = fgetc(s)) != EOF) {
-        if(!parser.FeedChar(c))   // ok, int
-            break;
-    }
-    fclose(s);
 
     long teaser_len = -1;
 
-    FilterChainSet *filt = MakeFormatFilter(parser);
+    const FilterChainSet *filt = GetFormatFilter(parser);
     int i;
     const ScriptVector& hdr = parser.GetHeaders();
     for(i = 0; i < hdr.Length()-1; i+=2) {
@@ -1226,13 +1566,16 @@ bool Database::GetSetItemDataById(const ScriptVariable &set_id,
         itd->descr = filt->ConvertContent(b.Range(0, teaser_len).Get());
     }
 
-    delete filt;
-
     if(it_is_dir)
         scan_set_item_dir_for_files(srcd, itd->files);
     else
         itd->files.Clear();
 
+    NoteSetItemInputs(srcd, fname, *itd);
+
+    if(cache && stamp.IsValid())
+        cache->Add(cache_key, stamp, *itd);
+
     return true;
 }
 
@@ -1447,21 +1790,26 @@ ProvideSetListIndex(const ScriptVariable &set_id, const ScriptVariable &tag)
     SetListIndex *tmp;
 
     for(tmp = first_set_list; tmp; tmp = tmp->next)
-        if(tmp->set_id == set_id && tmp->tag == tag)
+        if(tmp->set_id == set_id && tmp->tag == tag) {
+            NoteInput(tmp->path);
             return tmp;
+        }
 
     ScriptVariable sd = GetSetSourceDir(set_id);
     if(sd.IsInvalid() || sd == "")
         return 0;
 
+    ScriptVariable path = sd + "/_" + tag;
+    NoteInput(path);
     ReadStream f;
-    if(!f.FOpen((sd + "/_" + tag).c_str()))
+    if(!f.FOpen(path.c_str()))
         return 0;
 
     tmp = new SetListIndex;
     tmp->next = first_set_list;
     tmp->set_id = set_id;
     tmp->tag = tag;
+    tmp->path = path;
     first_set_list = tmp;
     tmp->items.Clear();
 
@@ -1475,6 +1823,20 @@ ProvideSetListIndex(const ScriptVariable &set_id, const ScriptVariable &tag)
     return tmp;
 }
 
+void Database::ForgetSetListIndices(const ScriptVariable &set_id)
+{
+    SetListIndex **pp = &first_set_list;
+    while(*pp) {
+        if((*pp)->set_id == set_id) {
+            SetListIndex *tmp = *pp;
+            *pp = tmp->next;
+            delete tmp;
+        } else {
+            pp = &(*pp)->next;
+        }
+    }
+}
+
 bool Database::
 GetIndexBarStyle(const ScriptVariable &name, IndexBarStyle &s) const
 {
@@ -1668,6 +2030,8 @@ ForumGenerator *Database::GetComments(ScriptVariable conf) const
 
     CommentDir cmtdir(path, auxparamdict);
     CommentTree *tree = cmtdir.GetTree();
+    if(deps)
+        deps->NoteDirectory(path);
     if(!tree) {
         delete fd;
         return new ErrorForumGenerator(this,
@@ -1712,7 +2076,7 @@ ScriptVariable Database::
 BuildCommentPart(const CommentData &cdt, const ScriptVariable &templ) const
 {
     subst->SetCmtData(&cdt);
-    ScriptVariable res = (*subst)(templ);
+    ScriptVariable res = subst->Process(CompiledTemplate(templ));
     subst->SetCmtData(0);
     return res;
 }
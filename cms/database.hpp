@@ -140,6 +140,11 @@ class Database {
     struct BlockGroupData *first_block_group;
 
     struct SetListIndex *first_set_list;
+    class SetItemCache *item_cache;
+    class TemplateCache *templ_cache;
+
+    ScriptVector loaded_files;
+    class DependencyRecorder *deps;   // not owned, normally null
 
 public:
 
@@ -153,6 +158,14 @@ public:
     void MakeErrorMessage(ScriptVariable &msg) const;
     bool GetExtraFiles(ScriptVector &ef); // clears them, hence non-const
 
+    const ScriptVector &GetLoadedFiles() const { return loaded_files; }
+    ScriptVariable GetOptSelector() const { return default_opt_selector; }
+
+        // incremental generation support: when a recorder is set,
+        // all input files the database reads are reported to it
+    void SetDependencyRecorder(class DependencyRecorder *r);
+    void NoteInput(const ScriptVariable &path) const;
+
 #if 0
     ScriptVariable GetSourcePrefix() const;
 #endif
@@ -233,6 +246,8 @@ private:
     ScriptVariable BuildListItemPart(const ListData &lsd,
                                      const ListItemData &itd,
                                      const ScriptVariable &templ) const;
+    const class ScriptMacroTemplate &
+    CompiledTemplate(const ScriptVariable &templ) const;
 public:
 #if 0
     ScriptVariable BuildListSegment(const ListData &lsd,
@@ -265,6 +280,10 @@ public:
     bool ScanSetTagItems(const ScriptVariable &set_id,
                          const ScriptVariable &tag,
                          ScriptVector &items) const;
+        // the tag index files (``_tag'') read so far are cached for
+        // the lifetime of the object; a resident process must call this
+        // once the set's source directory changes
+    void ForgetSetListIndices(const ScriptVariable &set_id);
     bool GetSetItemData(const PageSetData &setd, int idx,
                         ListItemData *itd) const;
     bool GetSetItemDataById(const ScriptVariable &set_id,
@@ -274,6 +293,12 @@ public:
                           const ScriptVariable &page_id,
                           ScriptVariable &srcd, ScriptVariable &fname,
                           bool &dedic_dir) const;
+private:
+    class SetItemCache *ProvideItemCache() const;
+    void NoteSetItemInputs(const ScriptVariable &srcd,
+                           const ScriptVariable &fname,
+                           const ListItemData &itd) const;
+public:
 
     void GetSetItemFilenames(const PageSetData &setd, bool separ_dir,
                              ScriptVariable &dir, ScriptVariable &idxfl,
@@ -378,7 +403,14 @@ private:
                                       const ScriptVariable &tag);
 
 public:
-    FilterChainSet *MakeFormatFilter(const class HeadedTextMessage &msg) const;
+        // the set is owned by the database and shared by all texts
+        // having the same encoding and format; don't delete it!
+    const FilterChainSet *
+        GetFormatFilter(const class HeadedTextMessage &msg) const;
+        // see FilterChainMaker::GetStats
+    void GetFormatFilterStats(int &built, int &reused) const;
+        // see IniFileParser::GetLookupCount
+    long GetIniLookupCount() const;
 
 };
 
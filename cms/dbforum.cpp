@@ -35,8 +35,17 @@
 
 #include "database.hpp"
 #include "filters.hpp"
+#include "cmtindex.hpp"
 #include "dbforum.hpp"
 
+CommentNode::~CommentNode()
+{
+    if(children)
+        delete[] children;
+    if(message)
+        delete message;
+}
+
 int CommentNode::ChildCount() const
 {
     if(!children)
@@ -73,8 +82,9 @@ void CommentNode::AddChild(int cid)
     children[cnt+1] = 0;
 }
 
-CommentTree::CommentTree(const ScriptVector &auxp)
-    : comments(0), comments_array_size(8), max_id(0), aux_params(auxp)
+CommentTree::CommentTree(const ScriptVariable &d, const ScriptVector &auxp)
+    : comments(0), comments_array_size(8), max_id(0), loaded(0), layout(0),
+    dir(d), aux_params(auxp)
 {
     comments = new CommentNode*[comments_array_size];
     *comments = new CommentNode;
@@ -92,6 +102,8 @@ CommentTree::~CommentTree()
         if(comments[i])
             delete comments[i];
     delete[] comments;
+    if(layout)
+        delete layout;
 }
 
 void CommentTree::ProvideCommentSlot(int id)
@@ -116,6 +128,10 @@ void CommentTree::ProvideCommentSlot(int id)
 
 void CommentTree::AddComment(CommentNode *cmt)
 {
+    if(layout) {
+        delete layout;
+        layout = 0;
+    }
     int id = cmt->id;
     if(comments_array_size > id && comments[id]) {
         // this is perfectly okay, in case one of the children was read
@@ -143,12 +159,131 @@ void CommentTree::AddComment(CommentNode *cmt)
 }
 
 const CommentNode* CommentTree::GetComment(int id) const
+{
+    if(id > max_id)
+        return 0;
+    CommentNode *node = comments[id];
+    if(node && node->id > 0 && !node->message)
+        const_cast<CommentTree*>(this)->LoadComment(node);
+    return node;
+}
+
+const CommentNode* CommentTree::GetNode(int id) const
 {
     if(id > max_id)
         return 0;
     return comments[id];
 }
 
+void CommentTree::LoadComment(CommentNode *node)
+{
+    ScriptVariable fname =
+        dir + ScriptVariable(30, node->plain_name ? "/%d" : "/%04d", node->id);
+        // in case the file disappeared, the comment remains empty
+    node->message = new HeadedTextMessage(false);
+    node->message->ReadFile(fname.c_str());
+    node->next_loaded = loaded;
+    loaded = node;
+}
+
+void CommentTree::ReleaseMessages()
+{
+    while(loaded) {
+        CommentNode *tmp = loaded;
+        loaded = loaded->next_loaded;
+        delete tmp->message;
+        tmp->message = 0;
+        tmp->next_loaded = 0;
+    }
+}
+
+CommentTreeLayout::CommentTreeLayout(int sz)
+    : size(sz), order_count(0)
+{
+    mem = new int[7 * size + 1];
+    parents = mem;
+    child_start = parents + size;    /* size + 1 items */
+    child_list = child_start + size + 1;
+    order = child_list + size;
+    depth = order + size;
+    subtree_end = depth + size;
+    position = subtree_end + size;
+}
+
+const CommentTreeLayout *CommentTree::GetLayout() const
+{
+    if(!layout)
+        const_cast<CommentTree*>(this)->MakeLayout();
+    return layout;
+}
+
+void CommentTree::MakeLayout()
+{
+    int n = max_id + 1;
+    CommentTreeLayout *lt = new CommentTreeLayout(n);
+    int *parents = lt->parents;
+    int *start = lt->child_start;
+    int i;
+
+        // the nodes made up for missing parents aren't anyone's children,
+        // and they may even have ids above max_id; their children are
+        // never reached anyway, so they are left out, too
+    for(i = 0; i <= n; i++)
+        start[i] = 0;
+    parents[0] = -1;
+    for(i = 1; i < n; i++) {
+        const CommentNode *node = comments[i];
+        if(node && node->id && node->parent < n) {
+            parents[i] = node->parent;
+            start[node->parent + 1]++;
+        } else {
+            parents[i] = -1;
+        }
+    }
+    for(i = 1; i <= n; i++)
+        start[i] += start[i-1];
+
+        // as the ids are taken in ascending order, every list of
+        // children gets sorted by itself
+    int *cursor = lt->position;   // used as a temporary here
+    for(i = 0; i < n; i++)
+        cursor[i] = start[i];
+    for(i = 1; i < n; i++)
+        if(parents[i] >= 0)
+            lt->child_list[cursor[parents[i]]++] = i;
+
+        // depth first walk; no stack is needed, as the way back is
+        // known from parents, and until the subtree is done, its
+        // subtree_end item holds the index of the next child to visit;
+        // a comment can't be reached twice as it only has one parent
+    for(i = 0; i < n; i++)
+        lt->position[i] = -1;
+    int root_next = start[0];
+    int v = 0, d = 0, k = 0;
+    for(;;) {
+        int *next = v ? &lt->subtree_end[lt->position[v]] : &root_next;
+        if(*next < start[v+1]) {
+            int c = lt->child_list[*next];
+            (*next)++;
+            d++;
+            lt->order[k] = c;
+            lt->depth[k] = d;
+            lt->position[c] = k;
+            lt->subtree_end[k] = start[c];
+            k++;
+            v = c;
+        } else {
+            if(!v)
+                break;
+            lt->subtree_end[lt->position[v]] = k;
+            v = parents[v];
+            d--;
+        }
+    }
+    lt->order_count = k;
+    layout = lt;
+}
+
 #if 0
 bool CommentTree::SetAuxData(int id, const ScriptVariable &ad)
 {
@@ -213,47 +348,6 @@ CommentTree *CommentDir::GetTree()
     return tree;
 }
 
-static void
-read_comment_file_to_tree(int id, const char *path, CommentTree *tree)
-{
-    FILE *s = fopen(path, "r");
-    if(!s)
-        return;
-
-    CommentNode *node = new CommentNode;
-    node->id = id;
-    node->parent = -1;
-
-    int c;
-    while((c = fgetc(s)) != EOF) {
-        if(!node->parser.FeedChar(c))    // ok, int
-            break;
-    }
-    fclose(s);
-
-    const ScriptVector& hdr = node->parser.GetHeaders();
-    int i;
-    for(i = 0; i < hdr.Length()-1; i+=2) {
-        if(hdr[i] == "parent") {
-            long n;
-            if(hdr[i+1].GetLong(n, 10) && n > 0 && n <= MAX_COMMENT_ID) {
-                node->parent = n;
-            } else {
-                // XXX error handling here?
-                node->parent = 0;
-            }
-            break;
-        }
-    }
-    if(node->parent == -1)   // XXX not found; error?
-        node->parent = 0;
-    tree->AddComment(node);
-}
-
-
-
-
-
 bool CommentDir::ScanTheTree()
 {
     if(tree) {
@@ -261,19 +355,20 @@ bool CommentDir::ScanTheTree()
         tree = 0;
     }
 
-    ReadDir dir(path.c_str());
-    if(!dir.OpenOk())
+    CommentIndex idx(path);
+    if(!idx.Load(true))
         return false;
 
-    tree = new CommentTree(aux_params);
+    tree = new CommentTree(path, aux_params);
 
-    const char *nm;
-    while((nm = dir.Next())) {
-        ScriptVariable v(nm);
-        long id;
-        if(!v.GetLong(id, 10))
-            continue;
-        read_comment_file_to_tree(id, (path+"/"+v).c_str(), tree);
+    int i;
+    for(i = 0; i < idx.Count(); i++) {
+        CommentNode *node = new CommentNode;
+        node->id = idx[i].id;
+        node->parent = idx[i].parent;
+        node->flags = idx[i].flags;
+        node->plain_name = idx[i].plain_name;
+        tree->AddComment(node);
     }
     return true;
 }
@@ -318,3 +413,194 @@ int CommentDir::SaveNewComment(int parent, long long date,
     return new_id;
 }
 #endif
+
+
+#ifdef DBFORUM_BENCH_MAIN
+
+/* Benchmark: builds synthetic comment trees in memory (a deep chain,
+   a wide flat thread, many small threads and a random tree) and walks
+   them the way the tree is rendered, first recursively over the nodes'
+   children arrays (the way it used to be done), then linearly over
+   the layout; the walks must produce the same sequence of events.
+
+     make dbforum_bench && ./dbforum_bench [nodes] [repeat]
+ */
+
+#include <stdlib.h>
+#include <time.h>
+
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+    // the events are hashed instead of emitting the HTML
+static void event(unsigned int &h, int code, int id)
+{
+    h = h * 31 + code;
+    h = h * 31 + id;
+}
+
+static int bubble_sort_child_array(int *arr)
+{
+    if(!*arr)
+        return 0;
+    int i, len, restlen;
+    for(len = 1; arr[len]; len++)
+        ;
+    for(restlen = len; restlen > 1; restlen--) {
+        bool changed = false;
+        for(i = 1; i < restlen; i++) {
+            if(arr[i] < arr[i-1]) {
+                int t = arr[i];
+                arr[i] = arr[i-1];
+                arr[i-1] = t;
+                changed = true;
+            }
+        }
+        if(!changed)
+            break;
+    }
+    return len;
+}
+
+static void walk_recursive(const CommentTree *tree, const CommentNode *node,
+                           unsigned int &h)
+{
+    event(h, 1, node->id);
+    int *chl = node->children;
+    if(chl) {
+        event(h, 2, 0);
+        int len = bubble_sort_child_array(chl);
+        int i;
+        for(i = 0; i < len; i++)
+            walk_recursive(tree, tree->GetNode(chl[i]), h);
+        event(h, 3, 0);
+    }
+    event(h, 4, node->id);
+}
+
+static void walk_layout(const CommentTreeLayout *lt, unsigned int &h)
+{
+    int *stack = new int[lt->order_count + 1];
+    int sp = 0;
+    int k;
+    for(k = 0; k < lt->order_count; k++) {
+        int d = lt->depth[k] - 1;
+        while(sp > d) {
+            sp--;
+            if(lt->ChildCount(stack[sp]) > 0)
+                event(h, 3, 0);
+            event(h, 4, stack[sp]);
+        }
+        int id = lt->order[k];
+        event(h, 1, id);
+        if(lt->ChildCount(id) > 0)
+            event(h, 2, 0);
+        stack[sp] = id;
+        sp++;
+    }
+    while(sp > 0) {
+        sp--;
+        if(lt->ChildCount(stack[sp]) > 0)
+            event(h, 3, 0);
+        event(h, 4, stack[sp]);
+    }
+    delete[] stack;
+}
+
+enum bench_shapes { shape_chain, shape_flat, shape_threads, shape_random };
+
+static const char * const shape_names[] = {
+    "deep chain", "wide flat thread", "small threads", "random tree"
+};
+
+static CommentTree *make_tree(int shape, int n)
+{
+    CommentTree *tree = new CommentTree("", ScriptVector());
+    unsigned int rnd = 12345;
+    int i;
+    for(i = 1; i <= n; i++) {
+        rnd = rnd * 1103515245 + 12345;
+        CommentNode *node = new CommentNode;
+        node->id = i;
+        switch(shape) {
+        case shape_chain:
+            node->parent = i - 1;
+            break;
+        case shape_flat:
+            node->parent = i > 1 ? 1 : 0;
+            break;
+        case shape_threads: {   // 20 comments per thread
+            int pos = (i - 1) % 20;
+            node->parent = pos ? i - 1 - (rnd >> 16) % pos : 0;
+            break;
+        }
+        default:
+            node->parent = (rnd >> 8) % i;
+        }
+        tree->AddComment(node);
+    }
+    return tree;
+}
+
+int main(int argc, char **argv)
+{
+    int n = argc > 1 ? atoi(argv[1]) : 100000;
+    int repeat = argc > 2 ? atoi(argv[2]) : 20;
+    int failures = 0;
+    printf("%d nodes, %d walks\n", n, repeat);
+    printf("%-18s %12s %12s %12s %12s %12s\n", "", "first walk:",
+           "", "next walks:", "", "");
+    printf("%-18s %12s %12s %12s %12s %12s\n", "", "recursive",
+           "make+layout", "recursive", "layout", "make layout");
+    int shape;
+    for(shape = shape_chain; shape <= shape_random; shape++) {
+        CommentTree *tree = make_tree(shape, n);
+        unsigned int h1 = 0, h2 = 0;
+        const CommentNode *root = tree->GetNode(0);
+        int r, i;
+
+            // the children arrays get sorted on the first walk; this is
+            // what a generation run pays, as it walks the tree once
+        double t0 = now();
+        int len = bubble_sort_child_array(root->children);
+        for(i = 0; i < len; i++)
+            walk_recursive(tree, tree->GetNode(root->children[i]), h1);
+        double t_first = now() - t0;
+
+        t0 = now();
+        for(r = 0; r < repeat; r++) {
+            h1 = 0;
+            len = bubble_sort_child_array(root->children);
+            for(i = 0; i < len; i++)
+                walk_recursive(tree, tree->GetNode(root->children[i]), h1);
+        }
+        double t_rec = (now() - t0) / repeat;
+
+        t0 = now();
+        const CommentTreeLayout *lt = tree->GetLayout();
+        double t_make = now() - t0;
+
+        t0 = now();
+        for(r = 0; r < repeat; r++) {
+            h2 = 0;
+            walk_layout(lt, h2);
+        }
+        double t_lay = (now() - t0) / repeat;
+
+        bool same = h1 == h2;
+        if(!same)
+            failures++;
+        printf("%-18s %9.3f ms %9.3f ms %9.3f ms %9.3f ms %9.3f ms  %s\n",
+               shape_names[shape], t_first * 1000, t_make * 1000 + t_lay * 1000,
+               t_rec * 1000, t_lay * 1000, t_make * 1000,
+               same ? "ok" : "MISMATCH");
+        delete tree;
+    }
+    return failures ? 1 : 0;
+}
+
+#endif
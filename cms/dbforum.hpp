@@ -7,20 +7,59 @@
 /* comment IDs are from 1, the value of 0 means "no", e.g. no parent */
 
 
+/* The id, parent and flags come from the comment index (see
+   cmtindex.hpp) and stay in memory as long as the tree exists; the
+   file itself is only read when the comment is requested with
+   CommentTree::GetComment, and the message is dropped again by
+   CommentTree::ReleaseMessages, so only the comments of the page being
+   generated are kept in memory.
+ */
 struct CommentNode {
     int id, parent;
+    unsigned int flags;  /* cmtidx_flag_* bitmap */
+    bool plain_name;
     int *children;  /* zero-terminated */
     int children_array_size;
-    HeadedTextMessage parser;
+    HeadedTextMessage *message;  /* 0 unless loaded */
+    CommentNode *next_loaded;
 
     CommentNode()
-        : id(0), parent(0), children(0), children_array_size(0), parser(false)
+        : id(0), parent(0), flags(0), plain_name(false),
+        children(0), children_array_size(0), message(0), next_loaded(0)
         {}
-    ~CommentNode() { if(children) delete[] children; }
+    ~CommentNode();
     int ChildCount() const;
     void AddChild(int cid);
 };
 
+/* Compact read-only form of the tree, made in one pass by CommentTree
+   once all the comments are added.  Everything is indexed by comment
+   ids, 0 being the root; for ids with no comment, as well as for the
+   nodes made up for missing parents, parents[id] is -1.  The children
+   of the comment are child_list[child_start[id]] ...
+   child_list[child_start[id+1]-1], sorted by id.  The order array lists
+   the ids reachable from the root as they go on the page (depth first);
+   for every position k in it, depth[k] is the nesting level of order[k]
+   (1 for top-level comments) and subtree_end[k] is the position right
+   after the subtree of order[k].  position[id] is the position of the
+   comment in the order (-1 if it isn't reachable).  All the arrays live
+   in one memory block.
+ */
+struct CommentTreeLayout {
+    int size;            /* max_id + 1 */
+    int order_count;     /* the root is not in the order */
+    int *parents;
+    int *child_start, *child_list;
+    int *order, *depth, *subtree_end, *position;
+private:
+    int *mem;
+public:
+    CommentTreeLayout(int size);
+    ~CommentTreeLayout() { delete[] mem; }
+    int ChildCount(int id) const
+        { return child_start[id+1] - child_start[id]; }
+};
+
 class CommentTree {
         /* comments[0] points to a CommentNode object which is not
            actually an existing comment, it only stores the list of
@@ -29,21 +68,33 @@ class CommentTree {
     CommentNode **comments;
     int comments_array_size;
     int max_id;
+    CommentNode *loaded;  /* the list of nodes having the message */
+    CommentTreeLayout *layout;
+    ScriptVariable dir;
     ScriptVector aux_params;  /* this is stored just to make it available
                                 for the macroprocessor using the getter */
 public:
-    CommentTree(const ScriptVector &auxparm);
+    CommentTree(const ScriptVariable &dir, const ScriptVector &auxparm);
     ~CommentTree();
 
     void AddComment(CommentNode *cmt);  // ownership is transferred
 
+        // the comment file is read if it isn't yet
     const CommentNode* GetComment(int id) const;
+        // only id, parent, flags and children are guaranteed to be there
+    const CommentNode* GetNode(int id) const;
+        // drop the messages loaded so far; the nodes remain valid
+    void ReleaseMessages();
+
+        // made on the first call, dropped by AddComment
+    const CommentTreeLayout *GetLayout() const;
 
     int GetMaxId() const { return max_id; }
     const ScriptVector &GetAuxParams() const { return aux_params; }
 private:
     void ProvideCommentSlot(int id);
-    void ScanTheTree();
+    void LoadComment(CommentNode *node);
+    void MakeLayout();
 };
 
 /* The directory contains files with names "0001", "0002", ..., and
@@ -55,6 +106,8 @@ private:
    If there are more than 9999 comments (which is strange already),
    the files for them are named like "10000", "52034" etc., i.e., without
    padding zeroes.
+   The tree is built from the "_index" file (see cmtindex.hpp), which
+   is rebuilt from the comment files if it is missing or stale.
 */
 class CommentDir {
     ScriptVariable path;
@@ -0,0 +1,247 @@
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <scriptpp/scrvar.hpp>
+#include <scriptpp/scrvect.hpp>
+#include <scriptpp/scrmap.hpp>
+#include <scriptpp/cmd.hpp>
+
+#include "depgraph.hpp"
+
+
+static ScriptVariable file_stamp(const ScriptVariable &path)
+{
+    struct stat st;
+    if(stat(path.c_str(), &st) == -1)
+        return "-1 -1";
+    return ScriptVariable(64, "%lld.%09ld %lld",
+                          (long long)st.st_mtim.tv_sec,
+                          (long)st.st_mtim.tv_nsec,
+                          (long long)st.st_size);
+}
+
+static bool file_exists(const ScriptVariable &path)
+{
+    struct stat st;
+    return lstat(path.c_str(), &st) != -1;
+}
+
+
+void DependencyRecorder::Start()
+{
+    seen.Clear();
+    record = "";
+    active = true;
+}
+
+void DependencyRecorder::NoteInput(const ScriptVariable &path)
+{
+    if(!active)
+        return;
+    if(!seen.AddItem(ScriptVariable("i:") + path))   // already there
+        return;
+    record += "in ";
+    record += file_stamp(path);
+    record += " ";
+    record += path;
+    record += "\n";
+}
+
+void DependencyRecorder::NoteDirectory(const ScriptVariable &path)
+{
+    if(!active)
+        return;
+    NoteInput(path);
+    ReadDir dir(path.c_str());
+    const char *nm;
+    while((nm = dir.Next())) {
+        if(nm[0] == '.' && (!nm[1] || (nm[1] == '.' && !nm[2])))
+            continue;
+        NoteInput(path + "/" + nm);
+    }
+}
+
+void DependencyRecorder::NoteOutput(const ScriptVariable &path)
+{
+    if(!active)
+        return;
+    if(!seen.AddItem(ScriptVariable("o:") + path))   // already there
+        return;
+    record += "out ";
+    record += path;
+    record += "\n";
+}
+
+ScriptVariable DependencyRecorder::Finish()
+{
+    active = false;
+    seen.Clear();
+    ScriptVariable res = record;
+    record = "";
+    return res;
+}
+
+
+DependencyManifest::DependencyManifest(const ScriptVariable &path)
+    : fname(path), valid(false), skipped(0)
+{
+}
+
+void DependencyManifest::AddGlobal(const ScriptVariable &path)
+{
+    globals.AddItem(ScriptVariable("global ") + file_stamp(path) + " " + path);
+}
+
+void DependencyManifest::AddParam(const ScriptVariable &name,
+                                  const ScriptVariable &value)
+{
+    globals.AddItem(ScriptVariable("param ") + name + "=" + value);
+}
+
+bool DependencyManifest::Load()
+{
+    valid = false;
+    tasks.Clear();
+
+    ReadStream f;
+    if(!f.FOpen(fname.c_str()))
+        return false;
+
+    int globcnt = 0;
+    ScriptVariable key, rec;
+    ScriptVariable line;
+    while(f.ReadLine(line)) {
+        if(line == "")
+            continue;
+        if(line.HasPrefix("global ") || line.HasPrefix("param ")) {
+            if(key.IsValid() && key != "")   // must be before the tasks
+                return false;
+            if(globcnt >= globals.Length() || globals[globcnt] != line)
+                return false;
+            globcnt++;
+            continue;
+        }
+        if(line.HasPrefix("task ")) {
+            if(key.IsValid() && key != "")
+                tasks.SetItem(key, rec);
+            key = line.Range(5, -1).Get();
+            rec = "";
+            continue;
+        }
+        if(line.HasPrefix("in ") || line.HasPrefix("out ")) {
+            rec += line;
+            rec += "\n";
+            continue;
+        }
+        return false;   // the file is broken, don't trust it
+    }
+    if(key.IsValid() && key != "")
+        tasks.SetItem(key, rec);
+    if(globcnt != globals.Length())
+        return false;
+
+    valid = true;
+    return true;
+}
+
+bool DependencyManifest::Save()
+{
+    ScriptVariable tmpname = fname + ".tmp";
+    FILE *f = fopen(tmpname.c_str(), "w");
+    if(!f)
+        return false;
+    int i;
+    for(i = 0; i < globals.Length(); i++)
+        fprintf(f, "%s\n", globals[i].c_str());
+    ScriptMap::Iterator iter(new_tasks);
+    ScriptVariable key, rec;
+    while(iter.GetNext(key, rec))
+        fprintf(f, "task %s\n%s", key.c_str(), rec.c_str());
+    if(fclose(f) != 0) {
+        unlink(tmpname.c_str());
+        return false;
+    }
+    return rename(tmpname.c_str(), fname.c_str()) == 0;
+}
+
+static bool record_is_up_to_date(const ScriptVariable &rec)
+{
+    ScriptVector lines(rec, "\n");
+    int i;
+    for(i = 0; i < lines.Length(); i++) {
+        ScriptVariable &ln = lines[i];
+        if(ln.HasPrefix("out ")) {
+            if(!file_exists(ln.Range(4, -1).Get()))
+                return false;
+            continue;
+        }
+        if(ln.HasPrefix("in ")) {
+                // in <mtime> <size> <path>, and the path may have spaces
+            const char *p = ln.c_str() + 3;
+            const char *sp = strchr(p, ' ');
+            if(sp)
+                sp = strchr(sp + 1, ' ');
+            if(!sp)
+                return false;
+            ScriptVariable stamp(p, sp - p);
+            ScriptVariable path(sp + 1);
+            if(file_stamp(path) != stamp)
+                return false;
+            continue;
+        }
+        return false;
+    }
+    return true;
+}
+
+bool DependencyManifest::IsUpToDate(const ScriptVariable &key)
+{
+    if(!valid)
+        return false;
+    ScriptVariable rec = tasks.GetItem(key);
+    if(rec.IsInvalid() || !record_is_up_to_date(rec))
+        return false;
+    new_tasks.SetItem(key, rec);
+    skipped++;
+    return true;
+}
+
+void DependencyManifest::SetRecord(const ScriptVariable &key,
+                                   const ScriptVariable &rec)
+{
+    new_tasks.SetItem(key, rec);
+}
+
+bool DependencyManifest::ListInputs(ScriptVector &paths) const
+{
+    ReadStream f;
+    if(!f.FOpen(fname.c_str()))
+        return false;
+    ScriptSet seen;
+    ScriptVariable line;
+    while(f.ReadLine(line)) {
+        int skip;
+        if(line.HasPrefix("in "))
+            skip = 3;
+        else
+        if(line.HasPrefix("global "))
+            skip = 7;
+        else
+            continue;
+            // <mtime> <size> <path>, and the path may have spaces
+        const char *p = strchr(line.c_str() + skip, ' ');
+        if(p)
+            p = strchr(p + 1, ' ');
+        if(!p)
+            continue;
+        ScriptVariable path(p + 1);
+        if(seen.Contains(path))
+            continue;
+        seen.AddItem(path);
+        paths.AddItem(path);
+    }
+    return true;
+}
@@ -0,0 +1,85 @@
+#ifndef DEPGRAPH_HPP_SENTRY
+#define DEPGRAPH_HPP_SENTRY
+
+#include <scriptpp/scrvar.hpp>
+#include <scriptpp/scrvect.hpp>
+#include <scriptpp/scrmap.hpp>
+
+#include "basesubs.hpp"
+
+/*
+    The dependency manifest is used for incremental generation.  For
+    every generation task (e.g. ``set=blog=n35'', ``listpage=news=3'')
+    it stores the list of inputs the task consumed (source files,
+    tag index files, comment directories and files, files used by
+    macros such as readfile and imgdim), together with their mtimes
+    and sizes, and the list of files it produced.  A task is considered
+    up to date if none of its inputs changed and all of its outputs
+    still exist.  Besides that, the manifest stores the ``global''
+    inputs (the ini files) and some generation parameters; if any of
+    them changed, the whole manifest is void.
+
+    The manifest is a text file, one record per line:
+
+        global <mtime> <size> <path>
+        param <name>=<value>
+        task <key>
+        in <mtime> <size> <path>
+        out <path>
+
+    where ``in'' and ``out'' lines belong to the last ``task'' line;
+    missing inputs are stored with both mtime and size of -1.
+ */
+
+class DependencyRecorder : public FileAccessObserver {
+    bool active;
+    ScriptSet seen;
+    ScriptVariable record;
+public:
+    DependencyRecorder() : active(false) {}
+
+    void Start();
+    bool IsActive() const { return active; }
+
+    void NoteInput(const ScriptVariable &path);
+        // the directory itself and all entries in it
+    void NoteDirectory(const ScriptVariable &path);
+    void NoteOutput(const ScriptVariable &path);
+
+        // returns the record, deactivates the recorder
+    ScriptVariable Finish();
+
+    virtual void FileAccessed(const ScriptVariable &path) { NoteInput(path); }
+};
+
+class DependencyManifest {
+    ScriptVariable fname;
+    ScriptVector globals;
+    ScriptMap tasks;
+    ScriptMap new_tasks;
+    bool valid;
+    int skipped;
+public:
+    DependencyManifest(const ScriptVariable &path);
+
+        // global inputs and params must be given before Load
+    void AddGlobal(const ScriptVariable &path);
+    void AddParam(const ScriptVariable &name, const ScriptVariable &value);
+
+        // false means there's no usable manifest; everything is rebuilt
+    bool Load();
+    bool Save();
+
+        // if the task is up to date, its record is carried over
+        // to the new manifest and true is returned
+    bool IsUpToDate(const ScriptVariable &key);
+    void SetRecord(const ScriptVariable &key, const ScriptVariable &rec);
+
+    int GetSkippedCount() const { return skipped; }
+
+        // all the input paths mentioned by the manifest file (the global
+        // ones included), each once; works without Load
+    bool ListInputs(ScriptVector &paths) const;
+};
+
+#endif
@@ -0,0 +1,57 @@
+arrindex.o: arrindex.cpp database.hpp arrindex.hpp
+basesubs.o: basesubs.cpp imgsize.h urlenc.hpp basesubs.hpp
+binbuf.o: binbuf.cpp binbuf.hpp
+cgicmsub.o: cgicmsub.cpp xcgi.hpp cgicmsub.hpp basesubs.hpp
+cmtindex.o: cmtindex.cpp cmtindex.hpp
+database.o: database.cpp dbsubst.hpp basesubs.hpp filters.hpp \
+ fpublish.hpp arrindex.hpp dbforum.hpp forumgen.hpp depgraph.hpp \
+ database.hpp
+dbforum.o: dbforum.cpp database.hpp filters.hpp cmtindex.hpp dbforum.hpp
+dbsubst.o: dbsubst.cpp database.hpp basesubs.hpp arrindex.hpp dbsubst.hpp
+depgraph.o: depgraph.cpp depgraph.hpp basesubs.hpp
+dullcgi.o: dullcgi.cpp cgicmsub.hpp basesubs.hpp xcgi.hpp xrandom.h \
+ dullcgi.hpp
+errlist.o: errlist.cpp errlist.hpp
+fileops.o: fileops.cpp fileops.hpp
+filters.o: filters.cpp filters.hpp
+forumgen.o: forumgen.cpp database.hpp dbforum.hpp cmtindex.hpp \
+ filters.hpp textsink.hpp forumgen.hpp
+fpublish.o: fpublish.cpp fileops.hpp errlist.hpp workers.hpp fpublish.hpp
+fswatch.o: fswatch.cpp fswatch.hpp
+generate.o: generate.cpp database.hpp forumgen.hpp textsink.hpp \
+ arrindex.hpp errlist.hpp fileops.hpp fpublish.hpp workers.hpp \
+ depgraph.hpp basesubs.hpp generate.hpp
+main_all.o: main_all.cpp database.hpp main_all.hpp
+main_gen.o: main_gen.cpp main_all.hpp main_gen.hpp main_srv.hpp \
+ database.hpp fileops.hpp fpublish.hpp generate.hpp errlist.hpp \
+ fswatch.hpp
+main_lst.o: main_lst.cpp database.hpp main_all.hpp main_lst.hpp
+main_srv.o: main_srv.cpp main_all.hpp main_gen.hpp main_srv.hpp \
+ database.hpp fileops.hpp fswatch.hpp unixsock.hpp
+main_upd.o: main_upd.cpp database.hpp main_all.hpp main_upd.hpp
+makeargv.o: makeargv.cpp makeargv.hpp
+memmail.o: memmail.cpp emailval.h memmail.hpp
+roles.o: roles.cpp roles.hpp
+tcgi_db.o: tcgi_db.cpp xcaptcha.hpp tcgi_sub.hpp cgicmsub.hpp \
+ basesubs.hpp tcgi_rpl.hpp tcgi_ses.hpp tcgi_sst.hpp makeargv.hpp \
+ roles.hpp fnchecks.h tcgi_db.hpp
+tcgi_rpl.o: tcgi_rpl.cpp filters.hpp fileops.hpp fpublish.hpp \
+ cmtindex.hpp tcgi_rpl.hpp
+tcgi_ses.o: tcgi_ses.cpp fnchecks.h fileops.hpp memmail.hpp tcgi_ses.hpp \
+ tcgi_sst.hpp
+tcgi_srv.o: tcgi_srv.cpp xcgi.hpp unixsock.hpp tcgi_srv.hpp
+tcgi_sst.o: tcgi_sst.cpp fileops.hpp tcgi_sst.hpp
+tcgi_sub.o: tcgi_sub.cpp fnchecks.h qsrt.h basesubs.hpp tcgi_db.hpp \
+ tcgi_ses.hpp tcgi_sst.hpp tcgi_rpl.hpp xcgi.hpp xcaptcha.hpp \
+ tcgi_sub.hpp cgicmsub.hpp
+textsink.o: textsink.cpp textsink.hpp
+thalassa.o: thalassa.cpp main_all.hpp main_gen.hpp main_lst.hpp \
+ main_upd.hpp main_srv.hpp
+thalcgi.o: thalcgi.cpp xcgi.hpp xcaptcha.hpp xrandom.h tcgi_db.hpp \
+ tcgi_ses.hpp tcgi_sst.hpp tcgi_rpl.hpp invoke.h emailval.h fnchecks.h \
+ fileops.hpp tcgi_srv.hpp
+unixsock.o: unixsock.cpp unixsock.hpp
+urlenc.o: urlenc.cpp urlenc.hpp
+workers.o: workers.cpp errlist.hpp workers.hpp
+xcaptcha.o: xcaptcha.cpp xcaptcha.hpp
+xcgi.o: xcgi.cpp urlenc.hpp xcgi.hpp
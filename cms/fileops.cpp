@@ -1,11 +1,16 @@
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/ioctl.h>
 #include <fcntl.h>
 #include <errno.h>
 #include <string.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <libgen.h>
+#if defined(__linux__)
+#include <sys/sendfile.h>
+#include <linux/fs.h>
+#endif
 
 
 #include <scriptpp/scrvar.hpp>
@@ -39,6 +44,20 @@ static void normalize_path(ScriptVector &path)
         path.Remove(0);
 }
 
+void split_file_path(const ScriptVariable &path,
+                     ScriptVariable &dir, ScriptVariable &fname)
+{
+    const char *p = path.c_str();
+    const char *slash = strrchr(p, '/');
+    if(!slash) {
+        dir = ".";
+        fname = path;
+        return;
+    }
+    dir = slash == p ? ScriptVariable("/") : ScriptVariable(p, slash - p);
+    fname = slash + 1;
+}
+
 ScriptVariable short_link_path(ScriptVariable src, ScriptVariable dst)
 {
     if(src[0] == '/' && dst[0] != '/') {
@@ -113,17 +132,126 @@ int make_directory_path(const char *path, int skip_the_last)
         return -1;
 
     r = skip_the_last ? 0 : mkdir(path, 0777);
+    if(r == -1 && errno == EEXIST) {
+        /* someone else (e.g. another generator process) was faster */
+        struct stat st;
+        if(stat(path, &st) != -1 && S_ISDIR(st.st_mode))
+            r = 0;
+        else
+            errno = EEXIST;
+    }
     return r;
 }
 
+    // the buffer for the plain read/write copying; it is aligned to the
+    // page size so that the kernel can do its best with it
+enum { copy_buf_size = 1024 * 1024, copy_buf_align = 4096 };
+
+static int write_all(int fd, const char *buf, int len)
+{
+    while(len > 0) {
+        int rc = write(fd, buf, len);
+        if(rc == -1) {
+            if(errno == EINTR)
+                continue;
+            return -1;
+        }
+        buf += rc;
+        len -= rc;
+    }
+    return 0;
+}
+
+static int copy_by_buffer(int fs, int fd)
+{
+    static char *buf = 0;
+    if(!buf) {
+        void *p;
+        if(posix_memalign(&p, copy_buf_align, copy_buf_size) != 0)
+            return -1;
+        buf = (char*)p;
+    }
+    for(;;) {
+        int rc = read(fs, buf, copy_buf_size);
+        if(rc == -1 && errno == EINTR)
+            continue;
+        if(rc <= 0)
+            return rc;
+        if(write_all(fd, buf, rc) == -1)
+            return -1;
+    }
+}
+
+    // tries the in-kernel ways first: reflink (the data is shared until
+    // modified), copy_file_range(2), sendfile(2); both descriptors must be
+    // at the beginning of the files; once any of these methods fails in a
+    // way which means it isn't supported here, the copying goes on from
+    // where it stopped by the next method
+static int copy_file_data(int fs, int fd, off_t size)
+{
+#if defined(__linux__)
+#if defined(FICLONE)
+    if(ioctl(fd, FICLONE, fs) == 0)
+        return 0;
+#endif
+    off_t left = size;
+    while(left > 0) {
+        ssize_t rc = copy_file_range(fs, 0, fd, 0, left, 0);
+        if(rc == -1 && errno == EINTR)
+            continue;
+        if(rc <= 0)
+            break;
+        left -= rc;
+    }
+    while(left > 0) {
+        ssize_t rc = sendfile(fd, fs, 0, left);
+        if(rc == -1 && errno == EINTR)
+            continue;
+        if(rc <= 0)
+            break;
+        left -= rc;
+    }
+    if(left == 0)
+        return 0;
+#endif
+    return copy_by_buffer(fs, fd);
+}
+
 int file_copy(const char *src, const char *dst, int mode)
 {
-    static char buf[4096];
-    int rc;
-    int fs, fd;
+    struct stat sst, dst_st;
+    int fs, fd, rc;
     fs = open(src, O_RDONLY);
     if(fs == -1)
         return -1;
+    if(fstat(fs, &sst) == -1) {
+        int e = errno;
+        close(fs);
+        errno = e;
+        return -1;
+    }
+
+        // the destination is most probably our own copy made last time
+    if(stat(dst, &dst_st) != -1 && S_ISREG(dst_st.st_mode) &&
+        dst_st.st_size == sst.st_size &&
+        dst_st.st_mtim.tv_sec == sst.st_mtim.tv_sec &&
+        dst_st.st_mtim.tv_nsec == sst.st_mtim.tv_nsec &&
+        (dst_st.st_dev != sst.st_dev || dst_st.st_ino != sst.st_ino))
+    {
+        close(fs);
+        if(mode && (dst_st.st_mode & 07777) != (mode_t)mode)
+            chmod(dst, mode);
+        return 1;
+    }
+
+        // it might be a hard link to the source (published with another
+        // method before), so we must not truncate it in place
+    if(unlink(dst) == -1 && errno != ENOENT) {
+        int e = errno;
+        close(fs);
+        errno = e;
+        return -1;
+    }
     fd = open(dst, O_WRONLY|O_TRUNC|O_CREAT, mode ? mode : 0666);
     if(fd == -1) {
         int e = errno;
@@ -134,12 +262,69 @@ int file_copy(const char *src, const char *dst, int mode)
     if(mode)
         fchmod(fd, mode);
 
-    while((rc = read(fs, buf, sizeof(buf))) > 0)
-        write(fd, buf, rc);
-
-    close(fd);
+    rc = copy_file_data(fs, fd, sst.st_size);
+    if(rc != -1) {
+        struct timespec times[2];
+        times[0] = sst.st_atim;
+        times[1] = sst.st_mtim;
+        futimens(fd, times);
+    }
+    int e = errno;
+    if(close(fd) == -1 && rc != -1) {
+        rc = -1;
+        e = errno;
+    }
     close(fs);
-    return 0;
+    if(rc == -1) {
+        unlink(dst);   // don't leave a partial copy with a matching mtime
+        errno = e;
+    }
+    return rc;
+}
+
+int files_identical(const char *a, const char *b)
+{
+    enum { bufsize = 65536 };
+    struct stat sa, sb;
+    if(stat(a, &sa) == -1 || stat(b, &sb) == -1)
+        return 0;
+    if(!S_ISREG(sa.st_mode) || !S_ISREG(sb.st_mode))
+        return 0;
+    if(sa.st_size != sb.st_size)
+        return 0;
+    int fa = open(a, O_RDONLY);
+    if(fa == -1)
+        return 0;
+    int fb = open(b, O_RDONLY);
+    if(fb == -1) {
+        close(fa);
+        return 0;
+    }
+    char *bufa = new char[2 * bufsize];
+    char *bufb = bufa + bufsize;
+    int res = 1;
+    for(;;) {
+        int ra = read(fa, bufa, bufsize);
+        if(ra <= 0) {
+            res = (ra == 0 && read(fb, bufb, 1) == 0);
+            break;
+        }
+        int got = 0;
+        while(got < ra) {
+            int rb = read(fb, bufb + got, ra - got);
+            if(rb <= 0)
+                break;
+            got += rb;
+        }
+        if(got != ra || memcmp(bufa, bufb, ra) != 0) {
+            res = 0;
+            break;
+        }
+    }
+    delete[] bufa;
+    close(fb);
+    close(fa);
+    return res;
 }
 
 int make_link(const char *src, const char *dst)
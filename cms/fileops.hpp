@@ -7,9 +7,21 @@ ScriptVariable short_link_path(ScriptVariable src, ScriptVariable dst);
 
 int make_directory_path(const char *path, int skip_the_last);
 
-    // mode==0 means 0666
+    // "a/b/c" -> "a/b", "c";  "c" -> ".", "c";  "/c" -> "/", "c"
+void split_file_path(const ScriptVariable &path,
+                     ScriptVariable &dir, ScriptVariable &fname);
+
+    // mode==0 means 0666; the copy gets the mtime of the source, and if
+    // the destination already has the same size and mtime, it is
+    // considered up to date and is not copied again (1 is returned
+    // in this case, 0 on success and -1 on error)
 int file_copy(const char *src, const char *dst, int mode);
 
+    // 1 if both files exist and have the same content, 0 otherwise;
+    // the sizes are compared first, so differing files are mostly
+    // rejected without reading them
+int files_identical(const char *a, const char *b);
+
 int make_link(const char *src, const char *dst);
 
 int make_symlink(const ScriptVariable &src, const ScriptVariable &dst);
@@ -1,3 +1,5 @@
+#include <string.h>
+
 #include <stfilter/stfilter.hpp>
 #include <stfilter/stfhtml.hpp>
 
@@ -6,20 +8,41 @@
 
 #include "filters.hpp"
 
-/* ``Destination'' for filter chains, which uses
-   a ScriptVarable object as the result storage
+/* ``Destination'' for filter chains; the chars are collected in
+   a plain buffer which is kept between the calls, and the result
+   is made into a ScriptVariable once the chain is done
  */
 class DestSV : public StreamFilter {
-    ScriptVariable *the_dest;
+    char *buf;
+    int bufsize, used;
 public:
-    DestSV() : StreamFilter(0), the_dest(0) {}
-    ~DestSV() {}
-    void SetDest(ScriptVariable *sv) { the_dest = sv; }
+    DestSV() : StreamFilter(0), buf(0), bufsize(0), used(0) {}
+    ~DestSV() { if(buf) delete[] buf; }
+    ScriptVariable Get() const { return ScriptVariable(buf ? buf : "", used); }
 private:
-    virtual void FeedChar(int c)
-        { the_dest->operator+=((char)c); } // no EOF, ok
+    virtual void FeedChar(int c) { char ch = c; FeedBlock(&ch, 1); }
+    virtual void FeedBlock(const char *b, int len);
+    virtual void Reset() { used = 0; }
 };
 
+void DestSV::FeedBlock(const char *b, int len)
+{
+    if(used + len > bufsize) {
+        int newsize = bufsize ? bufsize : 256;
+        while(newsize < used + len)
+            newsize *= 2;
+        char *nbuf = new char[newsize];
+        if(buf) {
+            memcpy(nbuf, buf, used);
+            delete[] buf;
+        }
+        buf = nbuf;
+        bufsize = newsize;
+    }
+    memcpy(buf + used, b, len);
+    used += len;
+}
+
 
 FilterChain::~FilterChain()
 {
@@ -49,15 +72,10 @@ ScriptVariable FilterChain::operator()(const ScriptVariable &src) const
         const_cast<FilterChain*>(this)->Add(p);
         const_cast<FilterChain*>(this)->finished = true;
     }
-    ScriptVariable res;
-    static_cast<DestSV*>(last)->SetDest(&res);
     chain->ChainReset();
-    const char *zstr = src.c_str();
-    for(; *zstr; zstr++)
-        chain->FeedChar(*zstr);
+    chain->FeedBlock(src.c_str(), src.Length());
     chain->FeedEnd();
-    static_cast<DestSV*>(last)->SetDest(0);
-    return res;
+    return static_cast<DestSV*>(last)->Get();
 }
 
 
@@ -144,7 +162,8 @@ ScriptVariable FilterChainSet::DoConvert(const FilterChain *fc,
 
 
 FilterChainMaker::FilterChainMaker(const char *target_enc, const char *tags)
-    : allowed_tags(0), errmsg(0)
+    : utf_to_target_table(0), allowed_tags(0), errmsg(0),
+    cache(0), sets_built(0), sets_reused(0)
 {
     if(!target_enc || !*target_enc) {
         target_encoding = streamfilter_enc_unknown;  // disable transcodings
@@ -171,6 +190,12 @@ FilterChainMaker::~FilterChainMaker()
 {
     if(allowed_tags)
         ScriptVector::DeleteArgv(allowed_tags);
+    while(cache) {
+        cached_set *tmp = cache;
+        cache = cache->next;
+        delete tmp->set;
+        delete tmp;
+    }
 }
 
 // NOTE as of now it is unexpected for this method to return 0
@@ -207,9 +232,11 @@ MakeChainSet(const char *src_enc, int par, bool tags) const
     return res;
 }
 
-FilterChainSet* FilterChainMaker::MakeChainSet(const ScriptVector &hdr) const
+static void parse_format_headers(const ScriptVector &hdr,
+                                 ScriptVariable &encoding,
+                                 int &nlconv, bool &tagconv)
 {
-    ScriptVariable encoding, format;
+    ScriptVariable format;
     bool enc_found = false, fmt_found = false;
     int i;
     for(i = 0; i < hdr.Length()-1; i+=2) {
@@ -225,8 +252,8 @@ FilterChainSet* FilterChainMaker::MakeChainSet(const ScriptVector &hdr) const
             break;
     }
     ScriptTokenVector fmt_tokens(format, ",", " \t\r\n");
-    int nlconv = parconv_none;
-    bool tagconv = false;
+    nlconv = parconv_none;
+    tagconv = false;
     for(i = 0; i < fmt_tokens.Length(); i++) {
         fmt_tokens[i].Tolower();
         if(fmt_tokens[i] == "breaks")
@@ -240,5 +267,49 @@ FilterChainSet* FilterChainMaker::MakeChainSet(const ScriptVector &hdr) const
         if(tagconv && nlconv)
             break;
     }
+}
+
+FilterChainSet* FilterChainMaker::MakeChainSet(const ScriptVector &hdr) const
+{
+    ScriptVariable encoding;
+    int nlconv;
+    bool tagconv;
+    parse_format_headers(hdr, encoding, nlconv, tagconv);
     return MakeChainSet(encoding.c_str(), nlconv, tagconv);
 }
+
+    /* MakeChainSet only looks at the source encoding's code, so
+       the sets are cached by the code; no encoding at all and an
+       unknown encoding both mean no transcoding
+     */
+const FilterChainSet*
+FilterChainMaker::GetChainSet(const char *src_enc, int par, bool tags)
+{
+    int enc = src_enc && *src_enc ?
+        streamfilter_find_encoding(src_enc) : streamfilter_enc_unknown;
+    cached_set *p;
+    for(p = cache; p; p = p->next) {
+        if(p->enc == enc && p->par == par && p->tags == tags) {
+            sets_reused++;
+            return p->set;
+        }
+    }
+    p = new cached_set;
+    p->enc = enc;
+    p->par = par;
+    p->tags = tags;
+    p->set = MakeChainSet(src_enc, par, tags);
+    p->next = cache;
+    cache = p;
+    sets_built++;
+    return p->set;
+}
+
+const FilterChainSet* FilterChainMaker::GetChainSet(const ScriptVector &hdr)
+{
+    ScriptVariable encoding;
+    int nlconv;
+    bool tagconv;
+    parse_format_headers(hdr, encoding, nlconv, tagconv);
+    return GetChainSet(encoding.c_str(), nlconv, tagconv);
+}
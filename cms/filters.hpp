@@ -44,14 +44,33 @@ class FilterChainMaker {
     const int * const *utf_to_target_table; // 0 means target is utf
     char **allowed_tags;  // note this field is owned!
     const char *errmsg;
+    struct cached_set {
+        int enc, par;
+        bool tags;
+        FilterChainSet *set;
+        cached_set *next;
+    } *cache;
+    int sets_built, sets_reused;
 public:
     FilterChainMaker(const char *target_enc, const char *tags);
     ~FilterChainMaker();
 
+        // these two return a new object, which the caller must delete
     FilterChainSet *MakeChainSet(const char *src_enc,
                                  int par, bool tags) const;
     FilterChainSet *MakeChainSet(const ScriptVector &headers_dict) const;
 
+        // these two return a set owned by the maker; the sets are
+        // cached by the source encoding and the format, so all texts
+        // having the same ones share the same set
+    const FilterChainSet *GetChainSet(const char *src_enc, int par, bool tags);
+    const FilterChainSet *GetChainSet(const ScriptVector &headers_dict);
+
+        // how many sets GetChainSet had to build, and how many
+        // times it returned one of the already built
+    void GetStats(int &built, int &reused) const
+        { built = sets_built; reused = sets_reused; }
+
     const char *ErrMsg() const { return errmsg; }
 };
 
@@ -2,7 +2,9 @@
 
 #include "database.hpp"
 #include "dbforum.hpp"
+#include "cmtindex.hpp"
 #include "filters.hpp"
+#include "textsink.hpp"
 
 #include "forumgen.hpp"
 
@@ -30,9 +32,8 @@ void ForumGenerator::SetHref(const ScriptVariable &href)
 {
 }
 
-ScriptVariable ForumGenerator::Build()
+void ForumGenerator::Build(TextSink &out)
 {
-    return "";
 }
 
 bool ForumGenerator::Next()
@@ -69,8 +70,11 @@ static void convert_comment_node_to_data(const CommentNode *node,
                                          CommentData *cmt,
                                          const Database *database)
 {
-    FilterChainSet *filt = database->MakeFormatFilter(node->parser);
-    const ScriptVector& hdr = node->parser.GetHeaders();
+        // nodes made up for missing parents have no message at all
+    static const HeadedTextMessage no_message(false);
+    const HeadedTextMessage &msg = node->message ? *node->message : no_message;
+    const FilterChainSet *filt = database->GetFormatFilter(msg);
+    const ScriptVector& hdr = msg.GetHeaders();
     cmt->id = node->id;
     cmt->parent = node->parent;
     int i;
@@ -119,9 +123,7 @@ static void convert_comment_node_to_data(const CommentNode *node,
     if(cmt->date == "")
         fill_date_from_unixtime(*cmt);
 
-    cmt->text = filt->ConvertContent(node->parser.GetBody());
-
-    delete filt;
+    cmt->text = filt->ConvertContent(msg.GetBody());
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -146,15 +148,12 @@ void PlainForumGenerator::ScanPgCount()
     int max = tree->GetMaxId();
     int i;
     for(i = 1; i <= max; i++) {
-        const CommentNode *comnode = tree->GetComment(i);
+            // the index has the flags, so no comment files are read here
+        const CommentNode *comnode = tree->GetNode(i);
         if(!comnode)
             continue;
-        if(!data->hidden_hold_place) {
-            CommentData cmdata;
-            convert_comment_node_to_data(comnode, &cmdata, the_database);
-            if(cmdata.HasFlag("hidden"))
-                continue;
-        }
+        if(!data->hidden_hold_place && (comnode->flags & cmtidx_flag_hidden))
+            continue;
         count++;
     }
     pg_count = (count-1) / data->per_page + 1;
@@ -193,28 +192,26 @@ void PlainForumGenerator::SetHref(const ScriptVariable &href)
     cur_href = href;
 }
 
-ScriptVariable PlainForumGenerator::Build()
+void PlainForumGenerator::Build(TextSink &out)
 {
-    ScriptVariable res;
-    res = the_database->BuildGenericPart(data->top);
-
     int max = tree->GetMaxId();
     bool rev = data->reverse;
 
     ScanPgCount();
+    if(pg_count >= 2 && cur_pg == 0 && !rev) {
+        // the 'main' page is only there for the reverse case
+        out.Put("ERROR: main comment page requested for non-reverse case");
+        return;
+    }
+
+    out.Put(the_database->BuildGenericPart(data->top));
+
     if(pg_count < 2) {   // single-page case is special
         int i;
-        for(i = rev ? max : 1; rev ? (i >= 1) : (i <= max); rev ? i-- : i++) {
-            ScriptVariable c = BuildSingleComment(i);
-            if(c.IsInvalid())
-                continue;
-            res += c;
-        }
+        for(i = rev ? max : 1; rev ? (i >= 1) : (i <= max); rev ? i-- : i++)
+            out.Put(BuildSingleComment(i));
     } else
     if(cur_pg == 0) {    // the 'main' page is another special case
-        if(!rev)
-            return "ERROR: main comment page requested for non-reverse case";
-        // yes, yes, it is reverse
         int count = 0;
         int i;
         for(i = max; i >= 1; i--) {
@@ -223,7 +220,7 @@ ScriptVariable PlainForumGenerator::Build()
                 continue;
             if(c == "" && !data->hidden_hold_place)  // hidden
                 continue;
-            res += c;
+            out.Put(c);
             count++;
             if(count >= data->per_page)
                 break;
@@ -242,14 +239,15 @@ ScriptVariable PlainForumGenerator::Build()
         int len = cv.Length();
         int i;
         for(i = rev ? len-1 : 0; rev ? i >= 0 : i < len; rev ? i-- : i++)
-            res += cv[i];
+            out.Put(cv[i]);
     }
-    res += the_database->BuildGenericPart(data->bottom);
-    return res;
+    out.Put(the_database->BuildGenericPart(data->bottom));
+    tree->ReleaseMessages();
 }
 
 bool PlainForumGenerator::Next()
 {
+    tree->ReleaseMessages();
     ScanPgCount();
     if(pg_count < 2)
         return false;
@@ -268,15 +266,19 @@ bool PlainForumGenerator::Next()
 
 ScriptVariable PlainForumGenerator::BuildSingleComment(int cmt_id)
 {
-    const CommentNode *comnode = tree->GetComment(cmt_id);
+        // the index knows whether the comment is hidden, so the message
+        // file isn't read for a hidden one
+    const CommentNode *comnode = tree->GetNode(cmt_id);
     if(!comnode)
         return ScriptVariableInv();
     uris_of_pages[cmt_id] = cur_href;
+    if(comnode->flags & cmtidx_flag_hidden)
+        return "";
+    comnode = tree->GetComment(cmt_id);
+    if(!comnode)
+        return ScriptVariableInv();
     CommentData cmdata;
     convert_comment_node_to_data(comnode, &cmdata, the_database);
-    bool hidden = cmdata.HasFlag("hidden");
-    if(hidden)
-        return "";
     cmdata.the_tree_aux_params = &(tree->GetAuxParams());
     cmdata.page_of_parent_uri =
         cmdata.parent > 0 && cmdata.parent < uris_of_pages.Length()
@@ -354,116 +356,107 @@ ScriptVariable PlainForumGenerator::MakeCommentMap()
 //////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////
 
-static void int_swap(int *a, int *b)
+static void close_comment(const CommentData *data, bool has_children,
+                          const ForumData *fdata, const Database *database,
+                          TextSink &out)
 {
-    int t = *a;
-    *a = *b;
-    *b = t;
+    if(has_children)
+        out.Put(database->BuildGenericPart(fdata->unindent));
+    out.Put(database->BuildCommentPart(*data, fdata->tail));
 }
 
-static int bubble_sort_child_array(int *arr)
+    // the thread is the subtree starting at the given position of the
+    // layout's order, so it is walked linearly; the comments whose
+    // tails are still to be written are kept in a stack
+static void make_comment_thread(const CommentTreeLayout *lt, int start,
+                                const CommentTree *tree,
+                                const ForumData *fdata,
+                                const Database *database,
+                                TextSink &out)
 {
-    if(!*arr || !arr[1])
-        return *arr ? 1 : 0;
-    bool changed = false;
-    int i;
-        // we need to compute the length, so why don't we use the pass fully?
-    for(i = 1; arr[i]; i++) {
-        if(arr[i] < arr[i-1]) {
-            int_swap(arr+i, arr+(i-1));
-            changed = true;
+    int end = lt->subtree_end[start];
+    int base = lt->depth[start];
+    CommentData **stack = new CommentData*[end - start];
+    int *stack_ids = new int[end - start];
+    int sp = 0;
+    int k = start;
+    while(k < end) {
+        int d = lt->depth[k] - base;
+        while(sp > d) {
+            sp--;
+            close_comment(stack[sp], lt->ChildCount(stack_ids[sp]) > 0,
+                          fdata, database, out);
+            delete stack[sp];
         }
-    }
-    int len = i;
-    if(!changed)
-        return len;
-    int restlen;
-    for(restlen = len; restlen > 1; restlen--) {
-        changed = false;
-        for(i = 1; i < restlen; i++) {
-            if(arr[i] < arr[i-1]) {
-                int_swap(arr+i, arr+(i-1));
-                changed = true;
-            }
+        int id = lt->order[k];
+        CommentData *data = new CommentData;
+        convert_comment_node_to_data(tree->GetComment(id),
+                                     data, database);
+        if(data->HasFlag("hidden")) {   // the subtree is skipped, too
+            delete data;
+            k = lt->subtree_end[k];
+            continue;
         }
-        if(!changed)
-            return len;
+        data->the_tree_aux_params = &(tree->GetAuxParams());
+        out.Put(database->BuildCommentPart(*data, fdata->comment_templ));
+        if(lt->ChildCount(id) > 0)
+            out.Put(database->BuildGenericPart(fdata->indent));
+        stack[sp] = data;
+        stack_ids[sp] = id;
+        sp++;
+        k++;
     }
-    return len;
-}
-
-
-static ScriptVariable make_comment_subtree(const CommentNode *comnode,
-                                           const CommentTree *tree,
-                                           const ForumData *fdata,
-                                           const Database *database)
-{
-    CommentData data;
-    convert_comment_node_to_data(comnode, &data, database);
-    if(data.HasFlag("hidden"))
-        return "";
-    data.the_tree_aux_params = &(tree->GetAuxParams());
-
-    ScriptVariable res;
-
-    res += database->BuildCommentPart(data, fdata->comment_templ);
-    int *chl = comnode->children;
-    if(chl) {
-        res += database->BuildGenericPart(fdata->indent);
-        int len = bubble_sort_child_array(chl);
-        int i;
-        for(i = 0; i < len; i++) {
-            res += make_comment_subtree(tree->GetComment(chl[i]),
-                                        tree, fdata, database);
-        }
-        res += database->BuildGenericPart(fdata->unindent);
+    while(sp > 0) {
+        sp--;
+        close_comment(stack[sp], lt->ChildCount(stack_ids[sp]) > 0,
+                      fdata, database, out);
+        delete stack[sp];
     }
-    res += database->BuildCommentPart(data, fdata->tail);
-
-    return res;
+    delete[] stack_ids;
+    delete[] stack;
 }
 
-ScriptVariable SingleTreeForumGenerator::Build()
+void SingleTreeForumGenerator::Build(TextSink &out)
 {
     if(!tree)       // this means all is done already
-        return "";
+        return;
 
-    ScriptVariable s;
     if(tree->GetMaxId() == 0) {
-        s = the_database->BuildGenericPart(data->no_comments_templ);
+        out.Put(the_database->BuildGenericPart(data->no_comments_templ));
     } else {
-        s = the_database->BuildGenericPart(data->top);
-        int *top_ch = tree->GetComment(0)->children;
-        int len = bubble_sort_child_array(top_ch);
+        out.Put(the_database->BuildGenericPart(data->top));
+        const CommentTreeLayout *lt = tree->GetLayout();
+        int len = lt->ChildCount(0);
+        const int *top_ch = lt->child_list + lt->child_start[0];
         bool rev = data->reverse;
         int i;
         for(i = rev ? len-1 : 0; rev ? (i >= 0) : (i < len); rev ? i-- : i++) {
-            s += make_comment_subtree(tree->GetComment(top_ch[i]),
-                                      tree, data, the_database);
+            make_comment_thread(lt, lt->position[top_ch[i]],
+                                tree, data, the_database, out);
+                // the thread is out, its messages aren't needed anymore
+            tree->ReleaseMessages();
         }
-        s += the_database->BuildGenericPart(data->bottom);
+        out.Put(the_database->BuildGenericPart(data->bottom));
     }
     delete tree;
     tree = 0;
-    return s;
 }
 
 //////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////
 
-ScriptVariable ForestForumGenerator::Build()
+void ForestForumGenerator::Build(TextSink &out)
 {
-    return ""; // XXX stub
+    // XXX stub
 }
 
 //////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////
 
-ScriptVariable ErrorForumGenerator::Build()
+void ErrorForumGenerator::Build(TextSink &out)
 {
     if(!msg.IsInvalid())       // this means all is done already
-        return "";
-    ScriptVariable s = msg;
+        return;
+    out.Put(msg);
     msg.Invalidate();
-    return s;
 }
@@ -13,6 +13,7 @@ struct ForumData {
 };
 
 class Database;
+class TextSink;
 
 // abstract class
 //
@@ -33,8 +34,8 @@ public:
     virtual void GetIndices(int &idx_file, int &idx_array) const;
         // by default, does nothing
     virtual void SetHref(const ScriptVariable &href);
-        // by default, returns empty string
-    virtual ScriptVariable Build();
+        // writes the comment section; by default, writes nothing
+    virtual void Build(TextSink &out);
         // by default, returns false
     virtual bool Next();
 
@@ -66,7 +67,7 @@ public:
     virtual bool GetArrayInfo(int &pg_count, bool &reverse) const;
     virtual void GetIndices(int &idx_file, int &idx_array) const;
     virtual void SetHref(const ScriptVariable &href);
-    virtual ScriptVariable Build();
+    virtual void Build(TextSink &out);
     virtual bool Next();
     virtual ScriptVariable MakeCommentMap(); // by default, returns Inv
 private:
@@ -83,7 +84,7 @@ public:
         : ForumGenerator(db, fd, ct) {}
     virtual ~SingleTreeForumGenerator() {}
 
-    virtual ScriptVariable Build();
+    virtual void Build(TextSink &out);
 };
 
 // multiple page tree comments
@@ -95,7 +96,7 @@ public:
         : ForumGenerator(db, fd, ct) {}
     virtual ~ForestForumGenerator() {}
 
-    virtual ScriptVariable Build();
+    virtual void Build(TextSink &out);
 };
 
 
@@ -108,7 +109,7 @@ public:
         : ForumGenerator(db, 0, 0), msg(m) {}
     virtual ~ErrorForumGenerator() {}
 
-    virtual ScriptVariable Build();
+    virtual void Build(TextSink &out);
 };
 
 
@@ -1,11 +1,17 @@
 #include <errno.h>
 #include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <sys/types.h>
+#include <sys/stat.h>
 
 #include <scriptpp/scrvect.hpp>
 #include <scriptpp/cmd.hpp>
 
 #include "fileops.hpp"
 #include "errlist.hpp"
+#include "workers.hpp"
 
 #include "fpublish.hpp"
 
@@ -35,6 +41,33 @@ bool provide_dest_dir(const ScriptVariable &dir,
     return true;
 }
 
+    // returns -1 on error (which is reported), 1 if the destination was
+    // found up to date, 0 otherwise
+static int publish_regular_file(const ScriptVariable &src,
+                                const ScriptVariable &dest,
+                                int method, ErrorList **err)
+{
+    int res = -1;
+    switch((method & fpm_method_mask)) {
+    case fpm_copy:
+        res = file_copy(src.c_str(), dest.c_str(), method & fpm_mode_mask);
+        break;
+    case fpm_link:
+        res = make_link(src.c_str(), dest.c_str());
+        break;
+    case fpm_symlink:
+        res = make_symlink(src.c_str(), dest.c_str());
+        break;
+    }
+
+    if(res == -1) {
+        ScriptVariable s(63, "Can't publish %s as %s [%s]",
+                         src.c_str(), dest.c_str(), strerror(errno));
+        ErrorList::AddError(err, s);
+    }
+    return res;
+}
+
 static bool
 publish_single_file(const ScriptVariable &src, const ScriptVariable &dest,
                  int method, const ScriptVariable &whatfor, ErrorList **err)
@@ -89,43 +122,83 @@ publish_single_file(const ScriptVariable &src, const ScriptVariable &dest,
     if(!st.IsRegularFile())
         return true;
 
-    // now time to publish the regular file
+    return publish_regular_file(src, dest, method, err) != -1;
+}
 
-    int res;
-    switch((method & fpm_method_mask)) {
-    case fpm_copy:
-        res = file_copy(src.c_str(), dest.c_str(), method & fpm_mode_mask);
-        break;
-    case fpm_link:
-        res = make_link(src.c_str(), dest.c_str());
-        break;
-    case fpm_symlink:
-        res = make_symlink(src.c_str(), dest.c_str());
-        break;
-    }
+//////////////////////////////////////////////////////////////////////////
+// Directory publishing
+// The source tree is scanned once, with openat/fstatat relative to the
+// directory being scanned; the file types are mostly taken from d_type,
+// so regular files are not stat'ed at all during the scan.  Then all the
+// destination directories are created (parents first), and then the
+// entries are published in batches by run_worker_tasks, that is, in
+// parallel if more than one job is allowed.
+//
 
-    if(res == -1) {
-        ScriptVariable s(63, "Can't publish %s as %s [%s]",
-                         src.c_str(), dest.c_str(), strerror(errno));
-        ErrorList::AddError(err, s);
-        return false;
-    }
+enum publish_entry_kind {
+    pek_file,         // regular file, published with the method
+    pek_dir_symlink,  // directory to symlink (non-recursive symlink mode)
+    pek_preserve,     // symlink to be preserved as such
+    pek_broken,       // dangling symlink we can't publish
+    pek_skipped       // its destination directory couldn't be made
+};
 
-    return true;
-}
+    // paths are relative to the roots of the scan
+struct PublishScan {
+    ScriptVector dirs;
+    ScriptVector entries;
+    int *kinds;
+    int kinds_alloc;
 
+    PublishScan() : kinds(0), kinds_alloc(0) {}
+    ~PublishScan() { if(kinds) delete[] kinds; }
+    void AddEntry(const ScriptVariable &rel, int kind);
+};
 
-bool publish_dir(const ScriptVariable &src, const ScriptVariable &dest,
-                 int method, const ScriptVariable &whatfor, ErrorList **err)
+void PublishScan::AddEntry(const ScriptVariable &rel, int kind)
 {
-    if(!provide_dest_dir(dest, whatfor, err))
-        return false;
+    int n = entries.Length();
+    if(n >= kinds_alloc) {
+        int newsize = kinds_alloc ? kinds_alloc * 2 : 256;
+        int *tmp = new int[newsize];
+        int i;
+        for(i = 0; i < n; i++)
+            tmp[i] = kinds[i];
+        if(kinds)
+            delete[] kinds;
+        kinds = tmp;
+        kinds_alloc = newsize;
+    }
+    kinds[n] = kind;
+    entries.AddItem(rel);
+}
 
-    bool result = true;
+static int dirent_type_by_mode(mode_t m)
+{
+    if(S_ISREG(m))
+        return DT_REG;
+    if(S_ISDIR(m))
+        return DT_DIR;
+    if(S_ISLNK(m))
+        return DT_LNK;
+    return DT_UNKNOWN;
+}
 
-    ReadDir dir(src.c_str());
-    const char *nm;
-    while((nm = dir.Next())) {
+    // dfd is consumed (closed) here
+static void scan_publish_dir(int dfd, const ScriptVariable &rel,
+                             const ScriptVariable &srcroot, int method,
+                             PublishScan &sc,
+                             const ScriptVariable &whatfor, ErrorList **err)
+{
+    DIR *d = fdopendir(dfd);
+    if(!d) {
+        close(dfd);
+        return;
+    }
+    int fd = dirfd(d);
+    struct dirent *de;
+    while((de = readdir(d))) {
+        const char *nm = de->d_name;
         if(*nm == '.') {
             if(!(method & fpm_includehidden))
                 continue;
@@ -134,12 +207,213 @@ bool publish_dir(const ScriptVariable &src, const ScriptVariable &dest,
             if(nm[1] == '.' && !nm[2])   // ``..'' entry
                 continue;
         }
-        ScriptVariable srcn = src + "/" + nm;
-        ScriptVariable dstn = dest + "/" + nm;
-        bool ok = publish_single_file(srcn, dstn, method, whatfor, err);
-        result = result && ok;
+        ScriptVariable r = rel == "" ? ScriptVariable(nm) : rel + "/" + nm;
+        struct stat st;
+        int type = de->d_type;
+        if(type == DT_UNKNOWN) {
+            if(fstatat(fd, nm, &st, AT_SYMLINK_NOFOLLOW) == -1)
+                continue;
+            type = dirent_type_by_mode(st.st_mode);
+        }
+        if(type == DT_LNK) {
+            if((method & fpm_slnk_follow)) {
+                if(fstatat(fd, nm, &st, 0) == -1) {
+                    sc.AddEntry(r, (method & fpm_slnk_preserve) ?
+                                   pek_preserve : pek_broken);
+                    continue;
+                }
+                type = dirent_type_by_mode(st.st_mode);
+            } else {
+                if((method & fpm_slnk_preserve))
+                    sc.AddEntry(r, pek_preserve);
+                continue;   // otherwise, successfully ignored
+            }
+        }
+        if(type == DT_DIR) {
+            if((method & fpm_recursive)) {
+                int sub = openat(fd, nm, O_RDONLY|O_DIRECTORY);
+                if(sub == -1) {
+                    ScriptVariable s(63, "couldn't open %s/%s (%s) [%s]",
+                                     srcroot.c_str(), r.c_str(),
+                                     strerror(errno), whatfor.c_str());
+                    ErrorList::AddError(err, s);
+                    continue;
+                }
+                sc.dirs.AddItem(r);
+                scan_publish_dir(sub, r, srcroot, method, sc, whatfor, err);
+            } else
+            if((method & fpm_method_mask) == fpm_symlink) {
+                sc.AddEntry(r, pek_dir_symlink);
+            }
+            continue;   // otherwise, successfully ignored subdir
+        }
+        // okay, we always ignore sockets, fifos and devices
+        if(type == DT_REG)
+            sc.AddEntry(r, pek_file);
     }
-    return result;
+    closedir(d);
+}
+
+class PublishTaskSet : public WorkerTaskSet {
+    enum { batch_size = 256 };
+    const PublishScan *scan;
+    ScriptVariable srcroot, destroot, whatfor;
+    int method;
+    int published, unchanged, failed;
+public:
+    PublishTaskSet(const PublishScan &sc, const ScriptVariable &src,
+                   const ScriptVariable &dest, int meth,
+                   const ScriptVariable &wf)
+        : scan(&sc), srcroot(src), destroot(dest), whatfor(wf),
+        method(meth), published(0), unchanged(0), failed(0) {}
+
+    virtual int Count() const
+        { return (scan->entries.Length() + batch_size - 1) / batch_size; }
+    virtual ScriptVariable Perform(int idx, ErrorList **err);
+    virtual ScriptVariable WorkerSummary();
+    virtual void TakeSummary(const ScriptVariable &s);
+
+    void AddToStats(PublishStats &ps) const;
+private:
+    int PublishEntry(int i, ErrorList **err);
+};
+
+int PublishTaskSet::PublishEntry(int i, ErrorList **err)
+{
+    ScriptVariable src = srcroot + "/" + scan->entries[i];
+    ScriptVariable dst = destroot + "/" + scan->entries[i];
+    int res;
+    switch(scan->kinds[i]) {
+    case pek_file:
+        return publish_regular_file(src, dst, method, err);
+    case pek_dir_symlink:
+        res = make_symlink(src.c_str(), dst.c_str());
+        if(res == -1) {
+            ScriptVariable s(63, "Can't create symlink %s to %s [%s]",
+                             dst.c_str(), src.c_str(), strerror(errno));
+            ErrorList::AddError(err, s);
+        }
+        return res;
+    case pek_preserve:
+        res = preserve_symlink(src, dst);
+        if(res == -1) {
+            ScriptVariable s(63, "couldn't create symlink %s [%s]",
+                             dst.c_str(), whatfor.c_str());
+            ErrorList::AddError(err, s);
+        }
+        return res;
+    case pek_skipped:
+        return -1;   // the directory failure is already reported
+    }
+    ScriptVariable s(63, "couldn't publish %s [%s]",
+                     src.c_str(), whatfor.c_str());
+    ErrorList::AddError(err, s);
+    return -1;
+}
+
+ScriptVariable PublishTaskSet::Perform(int idx, ErrorList **err)
+{
+    int n = scan->entries.Length();
+    int i;
+    for(i = idx * batch_size; i < n && i < (idx + 1) * batch_size; i++) {
+        int res = PublishEntry(i, err);
+        if(res == -1)
+            failed++;
+        else
+        if(res == 1)
+            unchanged++;
+        else
+            published++;
+    }
+    return ScriptVariableInv();
+}
+
+ScriptVariable PublishTaskSet::WorkerSummary()
+{
+    return ScriptNumber(published) + " " + ScriptNumber(unchanged) + " " +
+           ScriptNumber(failed);
+}
+
+void PublishTaskSet::TakeSummary(const ScriptVariable &s)
+{
+    ScriptWordVector v(s);
+    long p, u, f;
+    if(v.Length() != 3 || !v[0].GetLong(p, 10) || !v[1].GetLong(u, 10) ||
+        !v[2].GetLong(f, 10))
+    {
+        return;
+    }
+    published += p;
+    unchanged += u;
+    failed += f;
+}
+
+void PublishTaskSet::AddToStats(PublishStats &ps) const
+{
+    ps.files += published;
+    ps.unchanged += unchanged;
+    ps.failed += failed;
+}
+
+static bool has_any_prefix(const ScriptVariable &rel,
+                           const ScriptVector &prefixes)
+{
+    int i;
+    for(i = 0; i < prefixes.Length(); i++)
+        if(rel.HasPrefix(prefixes[i]))
+            return true;
+    return false;
+}
+
+bool publish_dir(const ScriptVariable &src, const ScriptVariable &dest,
+                 int method, const ScriptVariable &whatfor, ErrorList **err,
+                 int jobs, PublishStats *stats)
+{
+    if(!provide_dest_dir(dest, whatfor, err))
+        return false;
+
+    int dfd = open(src.c_str(), O_RDONLY|O_DIRECTORY);
+    if(dfd == -1)
+        return true;   // nothing to publish
+
+    PublishScan sc;
+    ErrorList *scan_err = 0;
+    scan_publish_dir(dfd, "", src, method, sc, whatfor, &scan_err);
+    bool result = (scan_err == 0);
+    if(scan_err)
+        ErrorList::AppendErrors(err, scan_err);
+
+        // sc.dirs has parents before their children; if a directory
+        // can't be made (or exists but isn't a directory), the whole
+        // subtree is skipped, and provide_dest_dir reports the reason
+    ScriptVector failed_dirs;
+    int i;
+    for(i = 0; i < sc.dirs.Length(); i++) {
+        if(has_any_prefix(sc.dirs[i], failed_dirs))
+            continue;
+        ScriptVariable dn = dest + "/" + sc.dirs[i];
+        if(mkdir(dn.c_str(), 0777) == -1 &&
+            !provide_dest_dir(dn, whatfor, err))
+        {
+            failed_dirs.AddItem(sc.dirs[i] + "/");
+            result = false;
+        }
+    }
+    if(failed_dirs.Length() > 0) {
+        for(i = 0; i < sc.entries.Length(); i++)
+            if(has_any_prefix(sc.entries[i], failed_dirs))
+                sc.kinds[i] = pek_skipped;
+    }
+
+    PublishTaskSet ts(sc, src, dest, method, whatfor);
+    run_worker_tasks(ts, jobs, err);
+    if(stats) {
+        stats->dirs += sc.dirs.Length();
+        ts.AddToStats(*stats);
+    }
+    PublishStats tmp;
+    ts.AddToStats(tmp);
+    return result && tmp.failed == 0;
 }
 
 
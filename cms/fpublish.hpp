@@ -21,11 +21,21 @@ enum file_publish_methods {
 
 struct ErrorList;
 
+    // files counts exclude directories; unchanged are the copies
+    // which were found up to date
+struct PublishStats {
+    int dirs, files, unchanged, failed;
+    PublishStats() : dirs(0), files(0), unchanged(0), failed(0) {}
+};
+
 bool provide_dest_dir(const ScriptVariable &dir,
                       const ScriptVariable &whatfor, ErrorList **err);
 
+    // the files of the tree are published by up to ``jobs'' worker
+    // processes; the counts are added to *stats, if it is given
 bool publish_dir(const ScriptVariable &src, const ScriptVariable &dest,
-                 int method, const ScriptVariable &whatfor, ErrorList **err);
+                 int method, const ScriptVariable &whatfor, ErrorList **err,
+                 int jobs = 1, PublishStats *stats = 0);
 
 bool publish_files(const ScriptVariable &srcdir, const ScriptVariable &destdir,
                    const class ScriptVector &files, int method,
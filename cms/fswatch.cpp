@@ -0,0 +1,94 @@
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#if defined(__linux__)
+#include <sys/inotify.h>
+#endif
+
+#include "fswatch.hpp"
+
+
+#if defined(__linux__)
+
+enum {
+    fswatch_buf_size = 16384,
+        // IN_MODIFY rather than IN_CLOSE_WRITE, because the latter comes
+        // for files opened for writing but not written, such as the
+        // comment indices, which are opened read-write to be locked
+    fswatch_mask = IN_MODIFY | IN_CREATE | IN_DELETE | IN_MOVED_FROM |
+                   IN_MOVED_TO | IN_ATTRIB | IN_DELETE_SELF | IN_MOVE_SELF
+};
+
+FileWatcher::FileWatcher()
+    : buf(0), buf_used(0), buf_pos(0)
+{
+    fd = inotify_init();
+    if(fd == -1)
+        return;
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+    buf = new char[fswatch_buf_size];
+}
+
+FileWatcher::~FileWatcher()
+{
+    if(fd != -1)
+        close(fd);
+    if(buf)
+        delete[] buf;
+}
+
+int FileWatcher::AddDir(const ScriptVariable &dir)
+{
+    if(fd == -1)
+        return -1;
+    return inotify_add_watch(fd, dir.c_str(), fswatch_mask);
+}
+
+void FileWatcher::RemoveDir(int wd)
+{
+    if(fd != -1 && wd != -1)
+        inotify_rm_watch(fd, wd);
+}
+
+bool FileWatcher::ReadEvents()
+{
+    if(fd == -1)
+        return false;
+    int rc;
+    do {
+        rc = read(fd, buf, fswatch_buf_size);
+    } while(rc == -1 && errno == EINTR);
+    if(rc <= 0) {
+        buf_used = buf_pos = 0;
+        return false;
+    }
+    buf_used = rc;
+    buf_pos = 0;
+    return true;
+}
+
+bool FileWatcher::NextEvent(int &wd, ScriptVariable &name)
+{
+    while(buf_pos + (int)sizeof(struct inotify_event) <= buf_used) {
+        struct inotify_event *ev = (struct inotify_event *)(buf + buf_pos);
+        buf_pos += sizeof(struct inotify_event) + ev->len;
+        if(ev->mask & IN_IGNORED)   // the watch is gone, nothing to report
+            continue;
+        wd = (ev->mask & IN_Q_OVERFLOW) ? -1 : ev->wd;
+        name = ev->len > 0 ? ev->name : "";
+        return true;
+    }
+    return false;
+}
+
+#else
+
+FileWatcher::FileWatcher() : fd(-1), buf(0), buf_used(0), buf_pos(0) {}
+FileWatcher::~FileWatcher() {}
+int FileWatcher::AddDir(const ScriptVariable &) { return -1; }
+void FileWatcher::RemoveDir(int) {}
+bool FileWatcher::ReadEvents() { return false; }
+bool FileWatcher::NextEvent(int &, ScriptVariable &) { return false; }
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef FSWATCH_HPP_SENTRY
+#define FSWATCH_HPP_SENTRY
+
+#include <scriptpp/scrvar.hpp>
+
+/*
+    FileWatcher reports changes within the given directories (not
+    recursively); it is a thin wrapper around Linux inotify(7).  Files
+    are watched through their directories, because editors (and our own
+    write-if-changed mode) replace files by renaming, and a watch set on
+    the file itself would be lost after the first such replacement.
+
+    Usage: add the directories, poll(2) the descriptor returned by
+    GetFd() for reading, then call ReadEvents() and fetch the events
+    one by one with NextEvent().  If the kernel's event queue overflowed
+    (so some events are lost), NextEvent() returns an event with the
+    watch id of -1, which means ``anything could have changed''.
+
+    On systems without inotify, IsOk() returns false and the caller
+    must assume everything changes all the time.
+
+    Please note a file being written produces an event per write(2),
+    so the caller should wait for the events to stop coming before it
+    considers the file complete.
+ */
+
+class FileWatcher {
+    int fd;
+    char *buf;
+    int buf_used, buf_pos;
+public:
+    FileWatcher();
+    ~FileWatcher();
+
+    bool IsOk() const { return fd != -1; }
+    int GetFd() const { return fd; }
+
+        // returns the watch id, or -1 if the dir can't be watched;
+        // adding the same directory again returns the same id
+    int AddDir(const ScriptVariable &dir);
+    void RemoveDir(int wd);
+
+        // doesn't block; returns false if there's nothing to read
+    bool ReadEvents();
+        // name is the name of the file within the dir; it is empty if
+        // the event is about the directory itself
+    bool NextEvent(int &wd, ScriptVariable &name);
+};
+
+#endif
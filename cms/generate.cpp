@@ -3,6 +3,7 @@
 #include <unistd.h>
 #include <stdlib.h>
 #include <sys/stat.h>
+#include <sys/time.h>
 #include <sys/types.h>
 #include <fcntl.h>
 #include <errno.h>
@@ -13,10 +14,13 @@
 
 #include "database.hpp"
 #include "forumgen.hpp"
+#include "textsink.hpp"
 #include "arrindex.hpp"
 #include "errlist.hpp"
 #include "fileops.hpp"
 #include "fpublish.hpp"
+#include "workers.hpp"
+#include "depgraph.hpp"
 
 #include "generate.hpp"
 
@@ -26,24 +30,124 @@
 // because (!) variable names are a part of the database format!
 
 
+#ifndef DEPS_FILENAME
+#define DEPS_FILENAME "_deps"
+#endif
 
+    // set for incremental generation only; see GenerationTaskSet
+static DependencyRecorder *output_recorder = 0;
 
-static FILE* start_file(const ScriptVariable &fname,
-                        int chmod_val,
-                        const ScriptVariable &diag_id,
-                        ErrorList **err)
+
+    // see set_write_if_changed
+static bool write_if_changed = false;
+static int files_written = 0, files_unchanged = 0;
+
+    // format filter stats reported by the worker processes
+static int worker_filters_built = 0, worker_filters_reused = 0;
+static long worker_ini_lookups = 0;
+
+    // in the write-if-changed mode, the text goes to a temporary file
+    // in the same directory (so that it can be renamed), and tmpname is
+    // valid; otherwise, it goes right to the target and tmpname is invalid
+struct output_target {
+    ScriptVariable fname, tmpname;
+    int chmod_val;
+    FILE *f;
+};
+
+static bool start_file(output_target &ot,
+                       const ScriptVariable &fname,
+                       int chmod_val,
+                       const ScriptVariable &diag_id,
+                       ErrorList **err)
 {
+    if(output_recorder)
+        output_recorder->NoteOutput(fname);
     make_directory_path(fname.c_str(), 1);
-    FILE* f = fopen(fname.c_str(), "w");
-    if(!f) {
+    ot.fname = fname;
+    ot.chmod_val = chmod_val;
+    ot.tmpname.Invalidate();
+    ot.f = 0;
+    if(write_if_changed) {
+            // like fopen(fname, "w") would, we write through a symlink
+            // (so the file it points to gets replaced) and keep the
+            // target's permissions unless we're told to set them; a
+            // dangling symlink is simply written in place
+        struct stat st;
+        bool exists = lstat(fname.c_str(), &st) == 0;
+        if(exists && S_ISLNK(st.st_mode)) {
+            char *rp = realpath(fname.c_str(), 0);
+            if(rp) {
+                ot.fname = rp;
+                free(rp);
+                exists = stat(ot.fname.c_str(), &st) == 0;
+            } else {
+                exists = false;
+                ot.fname.Invalidate();
+            }
+        }
+        if(ot.fname.IsValid()) {
+            ot.tmpname = ot.fname + ".~tmp" + ScriptNumber(getpid());
+            int fd = open(ot.tmpname.c_str(), O_WRONLY|O_CREAT|O_TRUNC, 0666);
+            if(fd != -1) {
+                if(exists && !chmod_val)
+                    fchmod(fd, st.st_mode & 07777);
+                ot.f = fdopen(fd, "w");
+            }
+        } else {
+            ot.fname = fname;
+            ot.f = fopen(fname.c_str(), "w");
+        }
+    } else {
+        ot.f = fopen(fname.c_str(), "w");
+    }
+    if(!ot.f) {
         ScriptVariable s(63, "Can't create file %s for %s [%s], skipping",
                          fname.c_str(), diag_id.c_str(), strerror(errno));
         ErrorList::AddError(err, s);
-        return 0;
+        return false;
     }
     if(chmod_val)
-        fchmod(fileno(f), chmod_val);
-    return f;
+        fchmod(fileno(ot.f), chmod_val);
+    return true;
+}
+
+    // closes the file; in the write-if-changed mode, the temporary file
+    // either replaces the target or (if they are the same) is removed
+static void finish_file(output_target &ot, const ScriptVariable &diag_id,
+                        ErrorList **err)
+{
+    bool failed = ferror(ot.f);
+    if(fclose(ot.f) == EOF)
+        failed = true;
+    ot.f = 0;
+    if(ot.tmpname.IsInvalid()) {
+        files_written++;
+        return;
+    }
+    if(failed) {
+        ScriptVariable s(63, "Couldn't write file %s for %s [%s], skipping",
+                         ot.fname.c_str(), diag_id.c_str(), strerror(errno));
+        ErrorList::AddError(err, s);
+        unlink(ot.tmpname.c_str());
+        return;
+    }
+    if(files_identical(ot.tmpname.c_str(), ot.fname.c_str())) {
+        unlink(ot.tmpname.c_str());
+        if(ot.chmod_val)
+            chmod(ot.fname.c_str(), ot.chmod_val);
+        files_unchanged++;
+        return;
+    }
+    if(rename(ot.tmpname.c_str(), ot.fname.c_str()) == -1) {
+        ScriptVariable s(63, "Can't rename %s to %s for %s [%s], skipping",
+                         ot.tmpname.c_str(), ot.fname.c_str(),
+                         diag_id.c_str(), strerror(errno));
+        ErrorList::AddError(err, s);
+        unlink(ot.tmpname.c_str());
+        return;
+    }
+    files_written++;
 }
 
 static bool output_file(const ScriptVariable &fname,
@@ -52,18 +156,61 @@ static bool output_file(const ScriptVariable &fname,
                         ErrorList **err,
                         const char *s1, const char *s2 = 0, const char *s3 = 0)
 {
-    FILE *f = start_file(fname, chmod_val, diag_id, err);
-    if(!f)
+    output_target ot;
+    if(!start_file(ot, fname, chmod_val, diag_id, err))
         return false;
-    fputs(s1, f);
+    fputs(s1, ot.f);
     if(s2)
-        fputs(s2, f);
+        fputs(s2, ot.f);
     if(s3)
-        fputs(s3, f);
-    fclose(f);
+        fputs(s3, ot.f);
+    finish_file(ot, diag_id, err);
+    return true;
+}
+
+    // the comment section goes right to the file, see TextSink
+static bool output_page(const ScriptVariable &fname,
+                        const ScriptVariable &diag_id,
+                        ErrorList **err,
+                        const ScriptVariable &main,
+                        ForumGenerator *fg,
+                        const ScriptVariable &tail)
+{
+    output_target ot;
+    if(!start_file(ot, fname, 0, diag_id, err))
+        return false;
+    FileTextSink sink(ot.f);
+    sink.Put(main);
+    if(fg)
+        fg->Build(sink);
+    sink.Put(tail);
+    finish_file(ot, diag_id, err);
     return true;
 }
 
+void set_write_if_changed(bool on)
+{
+    write_if_changed = on;
+}
+
+void get_output_counts(int &written, int &unchanged)
+{
+    written = files_written;
+    unchanged = files_unchanged;
+}
+
+void get_format_filter_stats(const Database &db, int &built, int &reused)
+{
+    db.GetFormatFilterStats(built, reused);
+    built += worker_filters_built;
+    reused += worker_filters_reused;
+}
+
+long get_ini_lookup_count(const Database &db)
+{
+    return db.GetIniLookupCount() + worker_ini_lookups;
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 // Genfiles
@@ -109,6 +256,11 @@ void generate_page(const ScriptVariable& id, Database& database,
     ScriptVariable page_filename;
     page_filename = database.GetPageFilename(id);
     ScriptVariable s = database.BuildPage(id);
+    if(s.IsInvalid()) {
+        ScriptVariable msg(63, "Skipping page %s, check configs", id.c_str());
+        ErrorList::AddError(err, msg);
+        return;
+    }
     int chmod_val = database.GetPageChmod(id);
     ScriptVariable diag_id("page ");
     diag_id += id;
@@ -184,11 +336,7 @@ static void generate_list_item_page(const ListData &listdata,
         ArrayData *save = database.InstallArrayData(0);
         ScriptVariable fname =
             database.GetListItemFilename(listdata.id, itemdata.item_id, 0);
-        ScriptVariable cmts("");
-        if(fg)
-           cmts = fg->Build();
-        output_file(fname, 0, diag_id, err,
-                    mainpg.c_str(), cmts.c_str(), tail.c_str());
+        output_page(fname, diag_id, err, mainpg, fg, tail);
         database.InstallArrayData(save);
         if(fg)
             delete fg;
@@ -223,11 +371,9 @@ static void generate_list_item_page(const ListData &listdata,
             idx_array = 0;
         arrayd.current_page = idx_array;
         fg->SetHref(arrayd.href_array[idx_array]);
-        ScriptVariable compage = fg->Build();
         ScriptVariable fname =
             database.GetListItemFilename(listdata.id, itemdata.item_id, idxf);
-        output_file(fname, 0, diag_id, err,
-                    mainpg.c_str(), compage.c_str(), tail.c_str());
+        output_page(fname, diag_id, err, mainpg, fg, tail);
         ok = fg->Next();
     } while(ok);
 
@@ -244,22 +390,27 @@ static void generate_list_item_page(const ListData &listdata,
     }
 }
 
+static void generate_list_item_page_by_idx(const ListData &list_data, int idx,
+                                           Database& database, ErrorList **err)
+{
+    ListItemData itemdata;
+    if(!database.GetListItemData(list_data, idx, itemdata)) {
+        ErrorList::AddError(err, ScriptVariable("No data for ") +
+                                 list_data.id + "/" + list_data.items[idx]);
+        return;
+    }
+    database.SetMacroData(&list_data, &itemdata);
+    generate_list_item_page(list_data, itemdata, database, err);
+    database.ForgetMacroData();
+}
+
 static void generate_all_list_item_pages(const ListData &list_data,
                                 Database& database, ErrorList **err)
 {
     int max = list_data.items.Length();
     int i;
-    for(i = 0; i < max; i++) {
-        ListItemData itemdata;
-        if(!database.GetListItemData(list_data, i, itemdata)) {
-            ErrorList::AddError(err, ScriptVariable("No data for ") +
-                                     list_data.id + "/" + list_data.items[i]);
-            continue;
-        }
-        database.SetMacroData(&list_data, &itemdata);
-        generate_list_item_page(list_data, itemdata, database, err);
-        database.ForgetMacroData();
-    }
+    for(i = 0; i < max; i++)
+        generate_list_item_page_by_idx(list_data, i, database, err);
 }
 
 void generate_single_list_item_page(const ScriptVariable &list_id,
@@ -312,16 +463,17 @@ static void generate_empty_list(const ListData &list_data,
                                 const ScriptVariable &diag_id,
                                 Database& database, ErrorList **err)
 {
-    FILE *listf = start_file(filename, 0, diag_id, err);
-    if(!listf)
+    output_target ot;
+    if(!start_file(ot, filename, 0, diag_id, err))
         return;
+    FILE *listf = ot.f;
 
     database.SetMacroData(&list_data, 0);
     output_list_head(listf, list_data, database, err);
     output_list_tail(listf, list_data, database, err);
     database.ForgetMacroData();
 
-    fclose(listf);
+    finish_file(ot, diag_id, err);
 }
 
 static void generate_list_segment(const ListData &list_data,
@@ -330,9 +482,10 @@ static void generate_list_segment(const ListData &list_data,
                                   const ScriptVariable &diag_id,
                                   Database& database, ErrorList **err)
 {
-    FILE *listf = start_file(filename, 0, diag_id, err);
-    if(!listf)
+    output_target ot;
+    if(!start_file(ot, filename, 0, diag_id, err))
         return;
+    FILE *listf = ot.f;
 
     database.SetMacroData(&list_data, 0);
     output_list_head(listf, list_data, database, err);
@@ -366,7 +519,7 @@ static void generate_list_segment(const ListData &list_data,
     output_list_tail(listf, list_data, database, err);
     database.ForgetMacroData();
 
-    fclose(listf);
+    finish_file(ot, diag_id, err);
 }
 
 static int start_num_for_main_list_page(int itemcnt, int perpage)
@@ -396,81 +549,123 @@ static ScriptVariable make_uri(ScriptVariable &base, const ScriptVariable &u)
 }
 #endif
 
-void generate_list(const ScriptVariable& id, Database& database,
-                   ErrorList **err)
+static void fill_list_array_data(const ListData &list_data,
+                                 ArrayData &array_data,
+                                 Database& database)
 {
-    int i;
-    ListData list_data;
-    if(!database.GetListData(id, list_data)) {
-        ScriptVariable s(63, "Configuration error for list %s\n", id.c_str());
-        ErrorList::AddError(err, s);
-        return;
-    }
-    if(list_data.pages)
-        generate_all_list_item_pages(list_data, database, err);
-
-    if(list_data.embedded)
-        return;
-
-    ScriptVariable diag_id = "list ";
-    diag_id += id;
-
-    bool rev = list_data.reverse;
     int perpage = list_data.items_per_listpage;
     int itemcnt = list_data.items.Length();
     int pagecnt = perpage <= 0 ? 1 : (itemcnt ? (itemcnt-1)/perpage+1 : 0);
-    ////////////////////////////////
-    ArrayData array_data;
     array_data.page_count = pagecnt;
-    array_data.reverse = rev;
+    array_data.reverse = list_data.reverse;
+    int i;
     for(i = 0; i <= pagecnt; i++)
-        array_data.href_array[i] = database.GetListHref(id, i);
-    if(rev)
+        array_data.href_array[i] = database.GetListHref(list_data.id, i);
+    if(list_data.reverse)
         array_data.href_last = array_data.href_array[0];
     else
         array_data.href_first = array_data.href_array[0];
-    array_data.current_page = rev ? -1 : 1;
-    ////////////////////////////////
-    ArrayData *ad_save = database.InstallArrayData(&array_data);
+    array_data.current_page = list_data.reverse ? -1 : 1;
+}
+
+    // numbers of the list pages to generate besides the main one;
+    // returns false if there are no such pages
+static bool list_numbered_pages(const ListData &list_data,
+                                const ArrayData &array_data,
+                                int &first, int &last)
+{
+    bool rev = list_data.reverse;
+    int perpage = list_data.items_per_listpage;
+    int pagecnt = array_data.page_count;
+    if(list_data.items.Length() < 1)
+        return false;
+    if(pagecnt > 1 || (pagecnt == 1 && perpage > 0 && rev)) {
+             // reverse multipage with only one page is special case
+             // to make the ``permanent links'' work
+                                    // otherwise, the main page is enough
+        first = rev ? 1 : 2;
+        last = pagecnt;
+        return first <= last;
+    }
+    return false;
+}
 
-    ScriptVariable filename;
-    filename = database.GetListFilename(id, -1);
+    // pgnum == 0 means the main list page
+static void generate_list_page(const ListData &list_data,
+                               ArrayData &array_data, int pgnum,
+                               Database& database, ErrorList **err)
+{
+    ScriptVariable diag_id = "list ";
+    diag_id += list_data.id;
 
-    if(itemcnt < 1) {
-            // this case is special because parameters of
-            // generate_list_segment don't allow to specify
-            // zero-length segment
-        generate_empty_list(list_data, filename, diag_id, database, err);
-    } else {
-        int start_num = rev ? itemcnt - 1 : 0;
-        int end_num =
+    bool rev = list_data.reverse;
+    int perpage = list_data.items_per_listpage;
+    int itemcnt = list_data.items.Length();
+
+    ArrayData *ad_save = database.InstallArrayData(&array_data);
+
+    int start_num, end_num;
+    if(pgnum == 0) {
+        array_data.current_page = rev ? -1 : 1;
+        ScriptVariable filename = database.GetListFilename(list_data.id, -1);
+        if(itemcnt < 1) {
+                // this case is special because parameters of
+                // generate_list_segment don't allow to specify
+                // zero-length segment
+            generate_empty_list(list_data, filename, diag_id, database, err);
+            database.InstallArrayData(ad_save);
+            return;
+        }
+        start_num = rev ? itemcnt - 1 : 0;
+        end_num =
             rev ?
                 start_num_for_main_list_page(itemcnt, perpage) :
                 (perpage > 0 ? perpage-1 : itemcnt-1);
         generate_list_segment(list_data, filename, 0, start_num, end_num,
                               diag_id, database, err);
-        if(pagecnt > 1 || (pagecnt == 1 && perpage > 0 && rev)) {
-                 // reverse multipage with only one page is special case
-                 // to make the ``permanent links'' work
-                                        // otherwise, we're already done
-            for(i = rev ? 1 : 2; i <= pagecnt; i++) {
-                array_data.current_page = i;
-                start_num = (i - 1) * perpage;
-                end_num = i * perpage - 1;
-                if(end_num >= itemcnt)
-                    end_num = itemcnt - 1;
-                if(rev)
-                    swapvars(start_num, end_num);
-                filename = database.GetListFilename(id, i);
-                generate_list_segment(list_data, filename, i,
-                                      start_num, end_num,
-                                      diag_id, database, err);
-            }
-        }
+    } else {
+        array_data.current_page = pgnum;
+        start_num = (pgnum - 1) * perpage;
+        end_num = pgnum * perpage - 1;
+        if(end_num >= itemcnt)
+            end_num = itemcnt - 1;
+        if(rev)
+            swapvars(start_num, end_num);
+        ScriptVariable filename =
+            database.GetListFilename(list_data.id, pgnum);
+        generate_list_segment(list_data, filename, pgnum, start_num, end_num,
+                              diag_id, database, err);
     }
     database.InstallArrayData(ad_save);
 }
 
+void generate_list(const ScriptVariable& id, Database& database,
+                   ErrorList **err)
+{
+    ListData list_data;
+    if(!database.GetListData(id, list_data)) {
+        ScriptVariable s(63, "Configuration error for list %s\n", id.c_str());
+        ErrorList::AddError(err, s);
+        return;
+    }
+    if(list_data.pages)
+        generate_all_list_item_pages(list_data, database, err);
+
+    if(list_data.embedded)
+        return;
+
+    ArrayData array_data;
+    fill_list_array_data(list_data, array_data, database);
+
+    generate_list_page(list_data, array_data, 0, database, err);
+    int first, last;
+    if(list_numbered_pages(list_data, array_data, first, last)) {
+        int i;
+        for(i = first; i <= last; i++)
+            generate_list_page(list_data, array_data, i, database, err);
+    }
+}
+
 void generate_all_lists(Database& database, ErrorList **errlst)
 {
     ScriptVector listnames;
@@ -543,11 +738,7 @@ static void build_set_page(const PageSetData &data, int idx,
     if(!multipage_by_comments) {
         // very simple case
         ArrayData *save = database.InstallArrayData(0);
-        ScriptVariable cmts("");
-        if(fg)
-            cmts = fg->Build();
-        output_file(destidx, 0, whatfor, err,
-                    mainpg.c_str(), cmts.c_str(), tail.c_str());
+        output_page(destidx, whatfor, err, mainpg, fg, tail);
         database.InstallArrayData(save);
     } else {
         ////////////////////////////
@@ -582,9 +773,7 @@ static void build_set_page(const PageSetData &data, int idx,
                 idx_array = 0;
             arrayd.current_page = idx_array;
             fg->SetHref(arrayd.href_array[idx_array]);
-            ScriptVariable compage = fg->Build();
-            output_file(sub_filename[idxf], 0, whatfor, err,
-                        mainpg.c_str(), compage.c_str(), tail.c_str());
+            output_page(sub_filename[idxf], whatfor, err, mainpg, fg, tail);
             ok = fg->Next();
         } while(ok);
 
@@ -649,26 +838,58 @@ void generate_all_sets(Database& database, ErrorList **errlst)
 // Defined by [collection id] sections
 // Generally, it is just a directory with files
 
+    // one line per collection published, see get_collection_report
+static ScriptVector collection_report;
+
 void publish_collection(const ScriptVariable& id,
-                        Database& database, ErrorList **err)
+                        Database& database, ErrorList **err, int jobs)
 {
     ScriptVariable srcdir, dstdir;
     int method;
 
     database.GetCollectionData(id, srcdir, dstdir, method);
-    publish_dir(srcdir, dstdir, method, id, err);
+
+    struct timeval start, end;
+    gettimeofday(&start, 0);
+    PublishStats stats;
+    publish_dir(srcdir, dstdir, method, id, err, jobs, &stats);
+    gettimeofday(&end, 0);
+    double secs = (end.tv_sec - start.tv_sec) +
+                  (end.tv_usec - start.tv_usec) / 1000000.0;
+
+    ScriptVariable s(127, "collection %s: %d dirs, %d files published, "
+                     "%d unchanged, %d failed, %.3f s",
+                     id.c_str(), stats.dirs, stats.files,
+                     stats.unchanged, stats.failed, secs);
+    collection_report.AddItem(s);
 }
 
-void publish_all_collections(Database& database, ErrorList **errlst)
+void publish_all_collections(Database& database, ErrorList **errlst,
+                             int jobs)
 {
     ScriptVector collnames;
     database.GetCollections(collnames);
     int i;
     for(i = 0; i < collnames.Length(); i++) {
-        publish_collection(collnames[i], database, errlst);
+        publish_collection(collnames[i], database, errlst, jobs);
     }
 }
 
+const ScriptVector &get_collection_report()
+{
+    return collection_report;
+}
+
+void reset_generation_stats()
+{
+    files_written = 0;
+    files_unchanged = 0;
+    worker_filters_built = 0;
+    worker_filters_reused = 0;
+    worker_ini_lookups = 0;
+    collection_report.Clear();
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 // Binaries
@@ -792,13 +1013,436 @@ void generate_all_alias_sections(Database& database, ErrorList **errlst)
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+// Parallel and incremental generation
+// Every step of generate_everything is split down to independent tasks
+// (a genfile, a page, a list item page, a list page, a set page, ...),
+// which are then performed by a pool of worker processes.  All the
+// data the tasks need (list and set descriptions, list array data) is
+// prepared here, before the workers are forked, so they get it for free.
+// The steps are still done one after another, so that, e.g., the sets
+// are generated only after all the lists are done.
+//
+// For incremental generation, the inputs and outputs of each task are
+// recorded in the dependency manifest, and the tasks found up to date
+// are dropped before the step begins.  Collections, binaries and
+// aliases have no keys, so they are always done.
+//
+// Collections are not tasks here: every collection directory is scanned
+// within the parent, and then its files are published by the workers
+// (see publish_dir).
+//
+
+enum gentask_kind {
+    gtk_genfile, gtk_page, gtk_binary,
+    gtk_list_item, gtk_list_page, gtk_set_page, gtk_aliases
+};
+
+struct GenListJob {
+    ListData data;
+    ArrayData array_data;
+    GenListJob *next;
+};
+
+struct GenSetJob {
+    PageSetData data;
+    GenSetJob *next;
+};
+
+class GenerationTaskSet : public WorkerTaskSet {
+    struct task {
+        int kind;
+        int idx;          // in names, list items, list pages, set pages
+        GenListJob *lj;
+        GenSetJob *sj;
+    };
+    Database *database;
+    DependencyManifest *manifest;
+    DependencyRecorder recorder;
+    ScriptVector names;
+    GenListJob *lists;
+    GenSetJob *sets;
+    task *tasks;
+    int task_count, tasks_alloc;
+    int written_base, unchanged_base;   // output counts before the fork
+    int filt_built_base, filt_reused_base;  // format filter stats, too
+    long lookups_base;                      // and the ini lookup count
+public:
+    GenerationTaskSet(Database &db, DependencyManifest *mf);
+    ~GenerationTaskSet();
+
+    void AddNamed(int kind, const ScriptVector &v);
+    void AddList(const ScriptVariable &id, ErrorList **err);
+    void AddSet(const ScriptVariable &id, ErrorList **err);
+
+        // for incremental generation
+    void DropUpToDate();
+
+    virtual int Count() const { return task_count; }
+    virtual ScriptVariable Perform(int idx, ErrorList **err);
+    virtual void TakeResult(int idx, const ScriptVariable &res);
+    virtual ScriptVariable WorkerSummary();
+    virtual void TakeSummary(const ScriptVariable &s);
+private:
+    void AddTask(int kind, int idx, GenListJob *lj, GenSetJob *sj);
+    ScriptVariable TaskKey(int idx) const;
+    void DoPerform(int idx, ErrorList **err);
+};
+
+GenerationTaskSet::GenerationTaskSet(Database &db, DependencyManifest *mf)
+    : database(&db), manifest(mf), lists(0), sets(0),
+    tasks(0), task_count(0), tasks_alloc(0),
+    written_base(files_written), unchanged_base(files_unchanged)
+{
+    database->GetFormatFilterStats(filt_built_base, filt_reused_base);
+    lookups_base = database->GetIniLookupCount();
+    if(manifest) {
+        database->SetDependencyRecorder(&recorder);
+        output_recorder = &recorder;
+    }
+}
+
+GenerationTaskSet::~GenerationTaskSet()
+{
+    if(manifest) {
+        database->SetDependencyRecorder(0);
+        output_recorder = 0;
+    }
+    while(lists) {
+        GenListJob *tmp = lists;
+        lists = lists->next;
+        delete tmp;
+    }
+    while(sets) {
+        GenSetJob *tmp = sets;
+        sets = sets->next;
+        delete tmp;
+    }
+    if(tasks)
+        delete[] tasks;
+}
+
+void GenerationTaskSet::AddTask(int kind, int idx,
+                                GenListJob *lj, GenSetJob *sj)
+{
+    if(task_count >= tasks_alloc) {
+        int newsize = tasks_alloc ? tasks_alloc * 2 : 64;
+        task *tmp = new task[newsize];
+        int i;
+        for(i = 0; i < task_count; i++)
+            tmp[i] = tasks[i];
+        if(tasks)
+            delete[] tasks;
+        tasks = tmp;
+        tasks_alloc = newsize;
+    }
+    tasks[task_count].kind = kind;
+    tasks[task_count].idx = idx;
+    tasks[task_count].lj = lj;
+    tasks[task_count].sj = sj;
+    task_count++;
+}
+
+void GenerationTaskSet::AddNamed(int kind, const ScriptVector &v)
+{
+    int i;
+    for(i = 0; i < v.Length(); i++) {
+        AddTask(kind, names.Length(), 0, 0);
+        names.AddItem(v[i]);
+    }
+}
+
+void GenerationTaskSet::AddList(const ScriptVariable &id, ErrorList **err)
+{
+    GenListJob *lj = new GenListJob;
+    if(!database->GetListData(id, lj->data)) {
+        ScriptVariable s(63, "Configuration error for list %s\n", id.c_str());
+        ErrorList::AddError(err, s);
+        delete lj;
+        return;
+    }
+    lj->next = lists;
+    lists = lj;
+
+    int i;
+    if(lj->data.pages) {
+        for(i = 0; i < lj->data.items.Length(); i++)
+            AddTask(gtk_list_item, i, lj, 0);
+    }
+    if(lj->data.embedded)
+        return;
+
+    fill_list_array_data(lj->data, lj->array_data, *database);
+    AddTask(gtk_list_page, 0, lj, 0);
+    int first, last;
+    if(list_numbered_pages(lj->data, lj->array_data, first, last)) {
+        for(i = first; i <= last; i++)
+            AddTask(gtk_list_page, i, lj, 0);
+    }
+}
+
+void GenerationTaskSet::AddSet(const ScriptVariable &id, ErrorList **err)
+{
+    GenSetJob *sj = new GenSetJob;
+    if(!database->GetSetData(id, sj->data)) {
+        ErrorList::AddError(err, ScriptVariable("No data for ") + id);
+        delete sj;
+        return;
+    }
+    database->ScanSetDirectory(sj->data);
+    sj->next = sets;
+    sets = sj;
+
+    int i;
+    for(i = 0; i < sj->data.page_ids.Length(); i++)
+        AddTask(gtk_set_page, i, 0, sj);
+}
+
+ScriptVariable GenerationTaskSet::TaskKey(int idx) const
+{
+    const task &t = tasks[idx];
+    switch(t.kind) {
+    case gtk_genfile:
+        return ScriptVariable("genfile=") + names[t.idx];
+    case gtk_page:
+        return ScriptVariable("page=") + names[t.idx];
+    case gtk_list_item:
+        return ScriptVariable("list=") + t.lj->data.id + "=" +
+               t.lj->data.items[t.idx];
+    case gtk_list_page:
+        return ScriptVariable("listpage=") + t.lj->data.id + "=" +
+               ScriptNumber(t.idx);
+    case gtk_set_page:
+        return ScriptVariable("set=") + t.sj->data.id + "=" +
+               t.sj->data.page_ids[t.idx];
+    }
+    return ScriptVariableInv();
+}
+
+void GenerationTaskSet::DropUpToDate()
+{
+    if(!manifest)
+        return;
+    int i, j;
+    j = 0;
+    for(i = 0; i < task_count; i++) {
+        ScriptVariable key = TaskKey(i);
+        if(key.IsValid() && manifest->IsUpToDate(key))
+            continue;
+        tasks[j] = tasks[i];
+        j++;
+    }
+    task_count = j;
+}
+
+    // list pages depend on the list of items, too; for set-sourced
+    // lists it is the tag index file, which is read before the task
+    // starts, so we have to make the database report it once again
+static void note_list_source(const ListData &list_data, Database &database)
+{
+    if(list_data.srctype == listsrc_set) {
+        ScriptVector dummy;
+        database.ScanSetTagItems(list_data.srcname, list_data.tag, dummy);
+    }
+}
+
+void GenerationTaskSet::DoPerform(int idx, ErrorList **err)
+{
+    const task &t = tasks[idx];
+    Database &db = *database;
+    switch(t.kind) {
+    case gtk_genfile:
+        generate_genfile(names[t.idx], db, err);
+        break;
+    case gtk_page:
+        generate_page(names[t.idx], db, err);
+        break;
+    case gtk_binary:
+        publish_binary(names[t.idx], db, err);
+        break;
+    case gtk_list_item:
+        note_list_source(t.lj->data, db);
+        generate_list_item_page_by_idx(t.lj->data, t.idx, db, err);
+        break;
+    case gtk_list_page:
+        note_list_source(t.lj->data, db);
+        generate_list_page(t.lj->data, t.lj->array_data, t.idx, db, err);
+        break;
+    case gtk_set_page:
+        build_set_page(t.sj->data, t.idx, db, err);
+        break;
+    case gtk_aliases:
+        generate_aliases(names[t.idx], db, err);
+        break;
+    }
+}
+
+ScriptVariable GenerationTaskSet::Perform(int idx, ErrorList **err)
+{
+    if(!manifest || TaskKey(idx).IsInvalid()) {
+        DoPerform(idx, err);
+        return ScriptVariableInv();
+    }
+    recorder.Start();
+    ErrorList *task_err = 0;
+    DoPerform(idx, &task_err);
+    ScriptVariable rec = recorder.Finish();
+    if(task_err) {
+            // don't let a failed task be considered up to date
+        ErrorList::AppendErrors(err, task_err);
+        return ScriptVariableInv();
+    }
+    return rec;
+}
+
+void GenerationTaskSet::TakeResult(int idx, const ScriptVariable &res)
+{
+    manifest->SetRecord(TaskKey(idx), res);
+}
+
+    // the output counts of a worker process are passed back to the parent,
+    // as well as the format filter stats and the ini lookup count
+ScriptVariable GenerationTaskSet::WorkerSummary()
+{
+    int built, reused;
+    database->GetFormatFilterStats(built, reused);
+    return ScriptNumber(files_written - written_base) + " " +
+           ScriptNumber(files_unchanged - unchanged_base) + " " +
+           ScriptNumber(built - filt_built_base) + " " +
+           ScriptNumber(reused - filt_reused_base) + " " +
+           ScriptNumber(database->GetIniLookupCount() - lookups_base);
+}
+
+void GenerationTaskSet::TakeSummary(const ScriptVariable &s)
+{
+    ScriptWordVector v(s);
+    long w, u, b, r, l;
+    if(v.Length() != 5 || !v[0].GetLong(w, 10) || !v[1].GetLong(u, 10) ||
+        !v[2].GetLong(b, 10) || !v[3].GetLong(r, 10) || !v[4].GetLong(l, 10))
+    {
+        return;
+    }
+    files_written += w;
+    files_unchanged += u;
+    worker_filters_built += b;
+    worker_filters_reused += r;
+    worker_ini_lookups += l;
+}
+
+static void run_generation_tasks(GenerationTaskSet &ts, int jobs,
+                                 ErrorList **err)
+{
+    ts.DropUpToDate();
+    run_worker_tasks(ts, jobs, err);
+}
+
+static void generate_named_by_tasks(int kind, const ScriptVector &names,
+                                    Database& database, int jobs,
+                                    DependencyManifest *mf, ErrorList **err)
+{
+    GenerationTaskSet ts(database, mf);
+    ts.AddNamed(kind, names);
+    run_generation_tasks(ts, jobs, err);
+}
+
+static void generate_all_lists_by_tasks(Database& database, int jobs,
+                                        DependencyManifest *mf,
+                                        ErrorList **err)
+{
+    ScriptVector listnames;
+    database.GetLists(listnames);
+    GenerationTaskSet ts(database, mf);
+    int i;
+    for(i = 0; i < listnames.Length(); i++)
+        ts.AddList(listnames[i], err);
+    run_generation_tasks(ts, jobs, err);
+}
+
+static void generate_all_sets_by_tasks(Database& database, int jobs,
+                                       DependencyManifest *mf,
+                                       ErrorList **err)
+{
+    ScriptVector setnames;
+    database.GetSets(setnames);
+    GenerationTaskSet ts(database, mf);
+    int i;
+    for(i = 0; i < setnames.Length(); i++)
+        ts.AddSet(setnames[i], err);
+    run_generation_tasks(ts, jobs, err);
+}
+
+static ErrorList*
+generate_everything_by_tasks(Database& database, int jobs,
+                             DependencyManifest *mf)
+{
+    ErrorList *errls = 0;
+    ScriptVector names;
+
+    make_directory_path(database.GetFilePrefix().c_str(), 0);
+
+    database.GetGenfiles(names);
+    generate_named_by_tasks(gtk_genfile, names, database, jobs, mf, &errls);
+    database.GetPages(names);
+    generate_named_by_tasks(gtk_page, names, database, jobs, mf, &errls);
+        // every collection is spread among the workers on its own
+    publish_all_collections(database, &errls, jobs);
+    database.GetBinaries(names);
+    generate_named_by_tasks(gtk_binary, names, database, jobs, 0, &errls);
+
+    generate_all_lists_by_tasks(database, jobs, mf, &errls);
+    generate_all_sets_by_tasks(database, jobs, mf, &errls);
+       /* _sets should be after _lists to have access to some list info */
+
+    database.GetAliasSections(names);
+    generate_named_by_tasks(gtk_aliases, names, database, jobs, 0, &errls);
+
+    return errls;
+}
+
+static ErrorList* generate_incrementally(Database& database, int jobs)
+{
+    ScriptVariable spooldir = database.GetSpoolDir();
+    make_directory_path(spooldir.c_str(), 0);
+    DependencyManifest mf(spooldir + "/" DEPS_FILENAME);
+    const ScriptVector &inifiles = database.GetLoadedFiles();
+    int i;
+    for(i = 0; i < inifiles.Length(); i++)
+        mf.AddGlobal(inifiles[i]);
+    mf.AddParam("rootdir", database.GetFilePrefix());
+    ScriptVariable optsel = database.GetOptSelector();
+    mf.AddParam("opt_selector", optsel.IsValid() ? optsel : "");
+    mf.Load();   // if it fails, we just do everything
+
+    ErrorList *errls = generate_everything_by_tasks(database, jobs, &mf);
+
+    if(!mf.Save()) {
+        ScriptVariable s(63, "couldn't save the dependency manifest in %s",
+                         spooldir.c_str());
+        ErrorList::AddError(&errls, s);
+    }
+    return errls;
+}
+
+
+bool get_recorded_inputs(const Database &database, ScriptVector &paths)
+{
+    DependencyManifest mf(database.GetSpoolDir() + "/" DEPS_FILENAME);
+    return mf.ListInputs(paths);
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////
 
 
     // database isn't const, 'cause generate_list affects the object
-ErrorList* generate_everything(Database& database)
+ErrorList* generate_everything(Database& database, int jobs, bool incremental)
 {
+    if(incremental)
+        return generate_incrementally(database, jobs);
+    if(jobs > 1)
+        return generate_everything_by_tasks(database, jobs, 0);
+
     ErrorList *errls = 0;
 
     make_directory_path(database.GetFilePrefix().c_str(), 0);
@@ -12,9 +12,13 @@ void generate_genfile(const ScriptVariable &id, Database &database,
                       ErrorList **err);
 void generate_all_genfiles(Database &database, ErrorList **err);
 
+    // jobs > 1 means to publish the files with worker processes
 void publish_collection(const ScriptVariable &id, Database &database,
-                        ErrorList **err);
-void publish_all_collections(Database &database, ErrorList **err);
+                        ErrorList **err, int jobs = 1);
+void publish_all_collections(Database &database, ErrorList **err,
+                             int jobs = 1);
+    // file counts and timing of every collection published so far
+const class ScriptVector &get_collection_report();
 
 void publish_binary(const ScriptVariable &id, Database &database,
                     ErrorList **err);
@@ -40,6 +44,36 @@ void generate_aliases(const ScriptVariable &id, Database &database,
                       ErrorList **err);
 void generate_all_alias_sections(Database &database, ErrorList **err);
 
-struct ErrorList *generate_everything(Database &database);
+    // in the write-if-changed mode, every file is first generated into a
+    // temporary file in the same directory, which then either replaces
+    // the target (by rename(2)), or is removed if the target already has
+    // exactly the same content; so the unchanged files keep their mtimes,
+    // and a half-written file is never seen under the target name
+void set_write_if_changed(bool on);
+    // files generated since the start, either written or (only in the
+    // write-if-changed mode) left unchanged
+void get_output_counts(int &written, int &unchanged);
+    // format filter sets built and reused, see FilterChainMaker::GetStats;
+    // the worker processes' figures are included
+void get_format_filter_stats(const class Database &db,
+                             int &built, int &reused);
+    // configuration parameter lookups, the workers' ones included
+long get_ini_lookup_count(const class Database &db);
+
+    // zero the output counts, the workers' filter and lookup stats and
+    // the collection report, so that a resident process (see main_srv.cpp)
+    // reports every request on its own; the stats kept by the database
+    // itself aren't affected
+void reset_generation_stats();
+
+    // the input files and directories recorded in the dependency
+    // manifest by the last incremental run, see DependencyManifest
+bool get_recorded_inputs(const Database &database, class ScriptVector &paths);
+
+    // jobs > 1 means to use that many worker processes;
+    // incremental means to only redo what the dependency manifest
+    // (kept in the spool dir) doesn't consider up to date
+struct ErrorList *generate_everything(Database &database, int jobs = 1,
+                                      bool incremental = false);
 
 #endif
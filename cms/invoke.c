@@ -1,5 +1,7 @@
 #include <stdlib.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 
@@ -41,3 +43,35 @@ int invoke_command(char * const *argv, const char *input, int inputlen)
         return -2;
     return 0;
 }
+
+int invoke_command_detached(char * const *argv)
+{
+    int pid, wpid, status, fd;
+    pid = fork();
+    if(pid == -1)
+        return -1;
+    if(pid == 0) { /* child; its child is reparented to init, no zombies */
+        pid = fork();
+        if(pid != 0)
+            _exit(pid == -1 ? 1 : 0);
+        setsid();
+            /* the web server waits for EOF on our stdout, so none of
+               the caller's descriptors may be left open */
+        fd = open("/dev/null", O_RDWR);
+        if(fd != -1) {
+            dup2(fd, 0);
+            dup2(fd, 1);
+            dup2(fd, 2);
+        }
+        for(fd = 3; fd < 1024; fd++)
+            close(fd);
+        execvp(*argv, argv);
+        _exit(253);
+    }
+    do {
+        wpid = waitpid(pid, &status, 0);
+    } while(wpid == -1 && errno == EINTR);
+    if(wpid != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        return -1;
+    return 0;
+}
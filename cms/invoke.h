@@ -14,6 +14,14 @@ extern "C" {
  */
 int invoke_command(char * const *argv, const char *input, int inputlen);
 
+/*
+  runs the command in background, detached from the caller (in its own
+  session, stdin/stdout/stderr redirected to /dev/null), not waiting
+  for it to finish; returns 0 if the command was launched, -1 if fork
+  failed; whether exec succeeded is not known
+ */
+int invoke_command_detached(char * const *argv);
+
 #ifdef __cplusplus
 }
 #endif
@@ -6,24 +6,38 @@
 #include <unistd.h>
 #include <errno.h>
 #include <string.h>
+#include <signal.h>
+#include <poll.h>
+#include <sys/time.h>
 
 
 #include <scriptpp/scrvar.hpp>
 #include <scriptpp/scrvect.hpp>
 #include <scriptpp/cmd.hpp>
+#include <scriptpp/scrmap.hpp>
 
 #include "main_all.hpp"
 #include "main_gen.hpp"
+#include "main_srv.hpp"
 
 #include "database.hpp"
 #include "fileops.hpp"
 #include "fpublish.hpp"
 #include "generate.hpp"
 #include "errlist.hpp"
+#include "fswatch.hpp"
 
 
 #ifndef DIRLOCK_FILENAME
 #define DIRLOCK_FILENAME "_LOCK"
+#endif
+
+    // see watch_and_regenerate
+#ifndef THALASSA_WATCH_QUIET_MS
+#define THALASSA_WATCH_QUIET_MS 200
+#endif
+#ifndef THALASSA_WATCH_MAX_DELAY_MS
+#define THALASSA_WATCH_MAX_DELAY_MS 2000
 #endif
 
 void help_gen(FILE *stream)
@@ -36,15 +50,47 @@ void help_gen(FILE *stream)
         "where <options> are:\n"
         "\n"
         "    -a             generate everything\n"
+        "    -c             write-if-(c)hanged: generate every file into a\n"
+        "                   temporary one, then either rename it to the\n"
+        "                   target or, if the target has the same content,\n"
+        "                   remove it; the counts of written and unchanged\n"
+        "                   files are reported in the end\n"
+        "    -d <socket>    pass the job to the resident server listening\n"
+        "                   on the given socket (see ``thalassa help\n"
+        "                   serve''); if there's no server, do the job\n"
+        "                   as usual\n"
         "    -g <targets>   targets to generate (see below)\n"
+        "    -j <N>         use N parallel workers (with -a, -r, -u or -m)\n"
+        "                   (the result is the same as without ``-j'')\n"
+        "    -m             (m)onitor: do what ``-u'' does, then watch the\n"
+        "                   ini files and all the inputs recorded in the\n"
+        "                   dependency manifest; once they change (and\n"
+        "                   the changes stop coming for a moment), do\n"
+        "                   ``-u'' again; runs until SIGTERM/SIGINT\n"
         "    -r             (r)ebuild: generate everything into a temporary\n"
         "                   dir, then rename the rootdir to have a suffix\n"
         "                   (.1, .2, ...) and rename the temporary dir to\n"
         "                   be the new rootdir;\n"
         "    -s             use the spool directory and locking (see the\n"
-        "                   documentation for details)\n"
+        "                   documentation for details); with no other\n"
+        "                   options, just generate the targets that are\n"
+        "                   already in the spool (e.g. put there by the\n"
+        "                   CGI program)\n"
         "    -t <dir>       generate (t)o the given dir "
                           /* sic! -> */  "(override [general]/rootdir)\n"
+        "    -u             (u)pdate: like ``-a'', but only regenerate\n"
+        "                   what changed since the previous ``-u'' run\n"
+        "                   (the dependency manifest is kept in the spool\n"
+        "                   dir); collections, binaries and aliases are\n"
+        "                   processed anyway\n"
+        "    -w <sec>       with ``-s'', (w)ait the given number of seconds\n"
+        "                   after the spool is locked and before the\n"
+        "                   targets are processed, so that the targets\n"
+        "                   spooled meanwhile are done in the same run\n"
+        "    -v             (v)erbose: report the file counts and timing\n"
+        "                   for every collection published, and how many\n"
+        "                   format filters were built and reused, and how\n"
+        "                   many times the configuration was looked up\n"
         "\n"
         "For -g, <targets> may be a comma- and/or space-separated list\n"
         "(be sure to use quotes to make it a single argument if you use\n"
@@ -71,11 +117,15 @@ void help_gen(FILE *stream)
 }
 
 struct GenCmdline {
-    bool gen_all, rebuild, spool;
+    bool gen_all, rebuild, spool, incremental, if_changed, verbose, watch;
+    int jobs, spool_wait;
     ScriptVector targets;
-    ScriptVariable target_dir;
+    ScriptVariable target_dir, server_socket;
 
-    GenCmdline() : gen_all(false), rebuild(false), spool(false) {}
+    GenCmdline()
+        : gen_all(false), rebuild(false), spool(false), incremental(false),
+        if_changed(false), verbose(false), watch(false),
+        jobs(1), spool_wait(0) {}
 };
 
 static int max_target_args(const ScriptVariable &t)
@@ -129,7 +179,8 @@ static bool parse_gen_cmdl(int argc, const char *const *argv, GenCmdline &cm)
             fprintf(stderr, "option ``%s'' unrecognized\n", argv[c]);
             return false;
         }
-        if(argv[c][1] == 'g' || argv[c][1] == 't')
+        if(argv[c][1] == 'g' || argv[c][1] == 't' || argv[c][1] == 'j' ||
+            argv[c][1] == 'w' || argv[c][1] == 'd')
         {
             if(!argv[c+1] || argv[c+1][0] == '-') {
                 fprintf(stderr, "option ``%s'' requires parameter\n", argv[c]);
@@ -154,6 +205,10 @@ static bool parse_gen_cmdl(int argc, const char *const *argv, GenCmdline &cm)
                 fprintf(stderr, "multiple ``-r'' not allowed\n");
                 return false;
             }
+            if(cm.incremental) {
+                fprintf(stderr, "``-r'' incompatible with ``-u''\n");
+                return false;
+            }
             if(cm.targets.Length() != 0) {
                 fprintf(stderr, "``-r'' incompatible with ``-g''\n");
                 return false;
@@ -161,6 +216,18 @@ static bool parse_gen_cmdl(int argc, const char *const *argv, GenCmdline &cm)
             cm.rebuild = true;
             c++;
             break;
+        case 'c':
+            if(cm.if_changed) {
+                fprintf(stderr, "multiple ``-c'' not allowed\n");
+                return false;
+            }
+            cm.if_changed = true;
+            c++;
+            break;
+        case 'v':
+            cm.verbose = true;
+            c++;
+            break;
         case 's':
             if(cm.spool) {
                 fprintf(stderr, "multiple ``-s'' not allowed\n");
@@ -174,6 +241,10 @@ static bool parse_gen_cmdl(int argc, const char *const *argv, GenCmdline &cm)
                 fprintf(stderr, "``-g'' incompatible with ``-a''\n");
                 return false;
             }
+            if(cm.incremental) {
+                fprintf(stderr, "``-g'' incompatible with ``-u''\n");
+                return false;
+            }
             ok = get_gen_targets(argv[c+1], cm.targets);
             if(!ok)
                 return false;
@@ -183,6 +254,50 @@ static bool parse_gen_cmdl(int argc, const char *const *argv, GenCmdline &cm)
             cm.target_dir = argv[c+1];
             c += 2;
             break;
+        case 'd':
+            cm.server_socket = argv[c+1];
+            c += 2;
+            break;
+        case 'u':
+            if(cm.incremental) {
+                fprintf(stderr, "multiple ``-u'' not allowed\n");
+                return false;
+            }
+            if(cm.rebuild || cm.targets.Length() != 0) {
+                fprintf(stderr, "``-u'' incompatible with ``-r''/``-g''\n");
+                return false;
+            }
+            cm.incremental = true;
+            c++;
+            break;
+        case 'm':
+            if(cm.watch) {
+                fprintf(stderr, "multiple ``-m'' not allowed\n");
+                return false;
+            }
+            cm.watch = true;
+            c++;
+            break;
+        case 'j': {
+            long n;
+            if(!ScriptVariable(argv[c+1]).GetLong(n, 10) || n < 1) {
+                fprintf(stderr, "``-j'' needs a positive number\n");
+                return false;
+            }
+            cm.jobs = n;
+            c += 2;
+            break;
+        }
+        case 'w': {
+            long n;
+            if(!ScriptVariable(argv[c+1]).GetLong(n, 10) || n < 0) {
+                fprintf(stderr, "``-w'' needs a non-negative number\n");
+                return false;
+            }
+            cm.spool_wait = n;
+            c += 2;
+            break;
+        }
         default:
             fprintf(stderr, "unknown option ``%s''\n", argv[c]);
             return false;
@@ -195,7 +310,20 @@ static bool parse_gen_cmdl(int argc, const char *const *argv, GenCmdline &cm)
         return false;
     }
 
-    if(!cm.gen_all && !cm.rebuild && cm.targets.Length() == 0) {
+    if(cm.watch && (cm.gen_all || cm.rebuild || cm.targets.Length() != 0 ||
+                    sv_is_set(cm.server_socket)))
+    {
+        fprintf(stderr,
+                "``-m'' incompatible with ``-a''/``-r''/``-g''/``-d''\n");
+        return false;
+    }
+    if(cm.spool_wait > 0 && !cm.spool) {
+        fprintf(stderr, "``-w'' only makes sense with ``-s''\n");
+        return false;
+    }
+    if(!cm.gen_all && !cm.rebuild && !cm.incremental &&
+        cm.targets.Length() == 0 && !cm.spool && !cm.watch)
+    {
         fprintf(stderr, "nothing to generate, try ``-a'', ``-r'' or ``-g''\n");
         return false;
     }
@@ -262,7 +390,7 @@ static void perform_single_target(const ScriptVariable &targ, Database &db,
 
     if(t == "genfile") {
         if(sv_is_set(v[1])) {
-            generate_page(v[1], db, err);
+            generate_genfile(v[1], db, err);
         } else {
             generate_all_genfiles(db, err);
         }
@@ -326,7 +454,8 @@ static void perform_single_target(const ScriptVariable &targ, Database &db,
     }
 }
 
-void do_spooled_targets(const ScriptVariable &spooldir,
+    // returns true if at least one target was processed
+bool do_spooled_targets(const ScriptVariable &spooldir,
                         Database &db, ErrorList **err)
 {
         /* Please note that during a single pass through the directory,
@@ -334,7 +463,7 @@ void do_spooled_targets(const ScriptVariable &spooldir,
            complicated) logic.
          */
     ReadDir dir(spooldir.c_str());
-    bool something_done;
+    bool something_done, anything_done = false;
     for(;;) {
         something_done = false;
         const char *nm;
@@ -346,15 +475,28 @@ void do_spooled_targets(const ScriptVariable &spooldir,
                 continue;
             perform_single_target(nm, db, err);
             something_done = true;
+            anything_done = true;
         }
         if(!something_done)
             break;
         dir.Rewind();
     }
+    return anything_done;
+}
+
+static bool spool_has_targets(const ScriptVariable &spooldir)
+{
+    ReadDir dir(spooldir.c_str());
+    const char *nm;
+    while((nm = dir.Next()))
+        if(*nm != '.' && *nm != '_')
+            return true;
+    return false;
 }
 
 static ErrorList *
-perform_targets_with_spool(const ScriptVector &targets, Database &db)
+perform_targets_with_spool(const ScriptVector &targets, Database &db,
+                           int wait)
 {
     ErrorList *err = 0;
     ScriptVariable spooldir = db.GetSpoolDir();
@@ -362,16 +504,27 @@ perform_targets_with_spool(const ScriptVector &targets, Database &db)
     // first, we need to spool up all ``new'' targets, no locking needed
     spool_the_targets(spooldir, targets, &err);
 
-    bool lock_ok = trylock_spooldir(spooldir);
-    if(!lock_ok) {
-        ErrorList::AddError(&err,
-            "NOTICE: couldn't lock, targets spooled for later processing");
-        return err;
-    }
-
-    do_spooled_targets(spooldir, db, &err);
-
-    unlock_spooldir(spooldir);
+        // someone may spool a target after our last pass through the
+        // directory, but before we unlock it; the process launched to
+        // handle it will fail to lock and give up, so we recheck (unless
+        // the spool only has something we can't remove)
+    bool done;
+    do {
+        bool lock_ok = trylock_spooldir(spooldir);
+        if(!lock_ok) {
+            if(targets.Length() > 0) {
+                ErrorList::AddError(&err, "NOTICE: couldn't lock, "
+                                    "targets spooled for later processing");
+            }
+            return err;
+        }
+        if(wait > 0) {
+            sleep(wait);
+            wait = 0;
+        }
+        done = do_spooled_targets(spooldir, db, &err);
+        unlock_spooldir(spooldir);
+    } while(done && spool_has_targets(spooldir));
     return err;
 }
 
@@ -419,14 +572,14 @@ static bool rename_to_backups(ScriptVariable base, int level)
     return res != -1;
 }
 
-static ErrorList* do_rebuild(Database& database, bool use_lock)
+static ErrorList* do_rebuild(Database& database, bool use_lock, int jobs)
 {
     ScriptVariable orig_target_dir = database.GetFilePrefix();
     ScriptVariable rand_dir = mk_rand_dir_name(orig_target_dir);
     database.SetFilePrefix(rand_dir);
 
         // generation into a fresh dir doesn't require locking
-    ErrorList *err = generate_everything(database);
+    ErrorList *err = generate_everything(database, jobs);
 
     ScriptVariableInv spooldir;
     if(use_lock) {
@@ -464,7 +617,8 @@ quit:
     return err;
 }
 
-static ErrorList* generate_everything_with_spool_lock(Database& database)
+static ErrorList*
+generate_everything_with_spool_lock(Database& database, int jobs, bool incr)
 {
     ErrorList *err = 0;
     ScriptVariable spooldir = database.GetSpoolDir();
@@ -474,7 +628,7 @@ static ErrorList* generate_everything_with_spool_lock(Database& database)
             "FATAL: spool dir lock failed, exiting; try again later");
         return err;
     }
-    err = generate_everything(database);
+    err = generate_everything(database, jobs, incr);
 
         // may look strange, but new targets could be added to the spool
         //    _after_ they were regenerated during ``generate_everything'',
@@ -487,50 +641,399 @@ static ErrorList* generate_everything_with_spool_lock(Database& database)
 
 
 
-int perform_gen(cmdline_common &cmd_com, int argc, const char * const *argv)
+//////////////////////////////////////////////////////////////////////////
+// The watch mode (-m)
+// The site is regenerated incrementally, then the directories of all
+// the inputs recorded in the dependency manifest are watched, along
+// with those of the ini files and the pagesets' source dirs.  Only the
+// events concerning these inputs count (so the files we write ourselves
+// don't wake us up); once they stop coming for a while, the next
+// incremental run is done, which, thanks to the manifest, only
+// regenerates what depends on the changed files.  If an ini file
+// changed, the database is reloaded first (the manifest is void in
+// this case, so everything is regenerated).
+//
+
+static volatile sig_atomic_t watch_stop = 0;
+
+static void watch_stop_handler(int)
 {
-    bool ok;
+    watch_stop = 1;
+}
 
-    GenCmdline cmdl;
-    ok = parse_gen_cmdl(argc, argv, cmdl);
-    if(!ok) {
-        fprintf(stderr, "try ``%s help gen''\n", argv[0]);
-        return 1;
+    // a directory is watched for every name within it, a file (which
+    // may not exist, as well as its directory) by its name within the
+    // nearest existing directory; the watch ids go to wds
+static void watch_input(FileWatcher &w, ScriptSet &relevant, ScriptSet &wds,
+                        const ScriptVariable &path)
+{
+    FileStat fs(path.c_str());
+    if(fs.Exists() && fs.IsDir()) {
+        int wd = w.AddDir(path);
+        if(wd != -1) {
+            relevant.AddItem(ScriptNumber(wd) + "/*");
+            wds.AddItem(ScriptNumber(wd));
+        }
+        return;
+    }
+    ScriptVariable dir, fname;
+    split_file_path(path, dir, fname);
+    while(dir != "." && dir != "/" && !FileStat(dir.c_str()).Exists()) {
+        ScriptVariable parent;
+        split_file_path(dir, parent, fname);
+        dir = parent;
+    }
+    int wd = w.AddDir(dir);
+    if(wd != -1) {
+        relevant.AddItem(ScriptNumber(wd) + "/" + fname);
+        wds.AddItem(ScriptNumber(wd));
+    }
+}
+
+    // watched holds the ids of the watches set up for the previous run;
+    // adding a directory again gives the same id, so the ids not seen
+    // this time are for the dirs we don't need anymore, and they are
+    // removed, lest the watch set grow during a long session
+static void setup_gen_watches(FileWatcher &w, ScriptSet &relevant,
+                              ScriptSet &watched, Database &db)
+{
+    relevant.Clear();
+    ScriptSet current;
+    int i;
+    const ScriptVector &ini = db.GetLoadedFiles();
+    for(i = 0; i < ini.Length(); i++)
+        watch_input(w, relevant, current, ini[i]);
+    ScriptVector sets;
+    db.GetSets(sets);
+    for(i = 0; i < sets.Length(); i++) {
+        PageSetData data;
+        if(db.GetSetData(sets[i], data) && data.source_dir != "")
+            watch_input(w, relevant, current, data.source_dir);
     }
+    ScriptVector inputs;
+    get_recorded_inputs(db, inputs);
+    for(i = 0; i < inputs.Length(); i++)
+        watch_input(w, relevant, current, inputs[i]);
 
-    Database database;
-    ok = load_inifiles(database, cmd_com.inifiles, cmd_com.opt_selector);
-    if(!ok)
+    ScriptSet::Iterator old(watched);
+    ScriptVariable s;
+    while((s = old.GetNext()).IsValid()) {
+        long wd;
+        if(!current.Contains(s) && s.GetLong(wd, 10))
+            w.RemoveDir(wd);
+    }
+    watched.Clear();
+    ScriptSet::Iterator cur(current);
+    while((s = cur.GetNext()).IsValid())
+        watched.AddItem(s);
+}
+
+static ScriptVariable ini_files_stamp(const Database &db)
+{
+    ScriptVariable res;
+    const ScriptVector &ini = db.GetLoadedFiles();
+    int i;
+    for(i = 0; i < ini.Length(); i++) {
+        struct stat st;
+        if(stat(ini[i].c_str(), &st) == -1) {
+            res += "- ";
+            continue;
+        }
+        res += ScriptVariable(64, "%lld.%09ld/%lld ",
+                              (long long)st.st_mtim.tv_sec,
+                              (long)st.st_mtim.tv_nsec,
+                              (long long)st.st_size);
+    }
+    return res;
+}
+
+static long ms_since(const struct timeval &t)
+{
+    struct timeval now;
+    gettimeofday(&now, 0);
+    return (now.tv_sec - t.tv_sec) * 1000 + (now.tv_usec - t.tv_usec) / 1000;
+}
+
+    // waits for a relevant event, then until no more relevant events
+    // come for THALASSA_WATCH_QUIET_MS (but no longer than for
+    // THALASSA_WATCH_MAX_DELAY_MS); false means we're told to stop
+static bool wait_for_changes(FileWatcher &w, const ScriptSet &relevant)
+{
+    bool seen = false;
+    struct timeval first, last;
+    for(;;) {
+        int timeout = -1;
+        if(seen) {
+            long quiet = THALASSA_WATCH_QUIET_MS - ms_since(last);
+            long total = THALASSA_WATCH_MAX_DELAY_MS - ms_since(first);
+            timeout = quiet < total ? quiet : total;
+            if(timeout <= 0)
+                return true;
+        }
+        struct pollfd pfd;
+        pfd.fd = w.GetFd();
+        pfd.events = POLLIN;
+        int rc = poll(&pfd, 1, timeout);
+        if(watch_stop)
+            return false;
+        if(rc == -1) {
+            if(errno == EINTR)
+                continue;
+            perror("poll");
+            return false;
+        }
+        if(rc == 0)
+            continue;    // the timeout is recomputed (and is over)
+        bool rel = false;
+        while(w.ReadEvents()) {
+            int wd;
+            ScriptVariable name;
+            while(w.NextEvent(wd, name)) {
+                if(rel)
+                    continue;   // just drain them
+                ScriptVariable key = ScriptNumber(wd) + "/";
+                rel = wd == -1 || name == "" ||
+                    relevant.Contains(key + "*") ||
+                    relevant.Contains(key + name);
+            }
+        }
+        if(rel) {
+            gettimeofday(&last, 0);
+            if(!seen)
+                first = last;
+            seen = true;
+        }
+    }
+}
+
+    // incremental run, under the spool lock if requested; a spool lock
+    // failure is no error here, the run is just to be retried later
+static ErrorList *watch_run(Database &db, const GenCmdline &cmdl,
+                            bool &lock_failed)
+{
+    lock_failed = false;
+    if(!cmdl.spool)
+        return generate_everything(db, cmdl.jobs, true);
+    ScriptVariable spooldir = db.GetSpoolDir();
+    make_directory_path(spooldir.c_str(), 0);
+    if(!trylock_spooldir(spooldir)) {
+        lock_failed = true;
+        return 0;
+    }
+    ErrorList *err = generate_everything(db, cmdl.jobs, true);
+    do_spooled_targets(spooldir, db, &err);
+    unlock_spooldir(spooldir);
+    return err;
+}
+
+static int watch_and_regenerate(cmdline_common &cmd_com,
+                                const GenCmdline &cmdl)
+{
+    FileWatcher watcher;
+    if(!watcher.IsOk()) {
+        fprintf(stderr, "``-m'': no file change notification available\n");
         return 1;
+    }
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = watch_stop_handler;
+    sa.sa_flags = SA_RESTART;      // poll(2) is interrupted anyway
+    sigaction(SIGTERM, &sa, 0);
+    sigaction(SIGINT, &sa, 0);
+
+    set_write_if_changed(cmdl.if_changed);
+
+    Database *db = 0;
+    ScriptVariable ini_stamp;
+    ScriptSet relevant, watched;
+    while(!watch_stop) {
+        if(!db || ini_files_stamp(*db) != ini_stamp) {
+            Database *newdb = new Database;
+            bool ok = load_inifiles(*newdb, cmd_com.inifiles,
+                                    cmd_com.opt_selector);
+            if(ok) {
+                if(db)
+                    delete db;
+                db = newdb;
+                ini_stamp = ini_files_stamp(*db);
+                if(sv_is_set(cmdl.target_dir))
+                    db->SetFilePrefix(cmdl.target_dir);
+            } else {
+                delete newdb;
+                if(!db)
+                    return 1;
+                fprintf(stderr, "the old configuration is kept until "
+                                "the ini files are fixed\n");
+                    // don't retry until they change once again
+                ini_stamp = ini_files_stamp(*db);
+            }
+        }
+
+        struct timeval start;
+        gettimeofday(&start, 0);
+        reset_generation_stats();
+        bool lock_failed;
+        ErrorList *err = watch_run(*db, cmdl, lock_failed);
+        if(lock_failed) {
+            if(cmdl.verbose)
+                printf("spool dir is locked, will retry\n");
+            sleep(1);
+            continue;
+        }
+        setup_gen_watches(watcher, relevant, watched, *db);
+
+        if(cmdl.verbose || cmdl.if_changed) {
+            time_t t = time(0);
+            char tm[32];
+            strftime(tm, sizeof(tm), "%H:%M:%S", localtime(&t));
+            int written, unchanged;
+            get_output_counts(written, unchanged);
+            printf("%s: %d file(s) written, %d unchanged, %.3f s\n",
+                   tm, written, unchanged, ms_since(start) / 1000.0);
+            fflush(stdout);
+        }
+        if(err) {
+            ErrorList *t;
+            for(t = err; t; t = t->next)
+                fprintf(stderr, "%s\n", t->message.c_str());
+            delete err;
+        }
 
+        if(!wait_for_changes(watcher, relevant))
+            break;
+    }
+    if(db)
+        delete db;
+    return 0;
+}
+
+
+    // the lines to print are collected in out and errs, rather than
+    // printed, so that the resident server can pass them to its client
+static int run_gen(const GenCmdline &cmdl, Database &database,
+                   ScriptVector &out, ScriptVector &errs)
+{
     if(sv_is_set(cmdl.target_dir))
         database.SetFilePrefix(cmdl.target_dir);
 
     struct ErrorList *err = 0;
 
-    if(cmdl.gen_all) {
+    reset_generation_stats();
+    int filt_built_base, filt_reused_base;
+    get_format_filter_stats(database, filt_built_base, filt_reused_base);
+    long lookups_base = get_ini_lookup_count(database);
+
+    set_write_if_changed(cmdl.if_changed);
+
+    if(cmdl.gen_all || cmdl.incremental) {
         err = cmdl.spool ?
-            generate_everything_with_spool_lock(database) :
-            generate_everything(database);
+            generate_everything_with_spool_lock(database, cmdl.jobs,
+                                                cmdl.incremental) :
+            generate_everything(database, cmdl.jobs, cmdl.incremental);
     } else
     if(cmdl.rebuild) {
-        err = do_rebuild(database, cmdl.spool);
+        err = do_rebuild(database, cmdl.spool, cmdl.jobs);
     } else
-    if(cmdl.targets.Length() > 0) {
+    if(cmdl.targets.Length() > 0 || cmdl.spool) {
         err = cmdl.spool ?
-            perform_targets_with_spool(cmdl.targets, database) :
+            perform_targets_with_spool(cmdl.targets, database,
+                                       cmdl.spool_wait) :
             perform_the_targets(cmdl.targets, database);
     } else {
-        fprintf(stderr, "It seems I've got nothing to do.  Strange.\n");
+        errs.AddItem("It seems I've got nothing to do.  Strange.");
         return 3;
     }
+    if(cmdl.verbose) {
+        const ScriptVector &rep = get_collection_report();
+        int i;
+        for(i = 0; i < rep.Length(); i++)
+            out.AddItem(rep[i]);
+        int built, reused;
+        get_format_filter_stats(database, built, reused);
+        out.AddItem(ScriptVariable(63, "format filters: %d built, %d reused",
+                                   built - filt_built_base,
+                                   reused - filt_reused_base));
+        out.AddItem(ScriptVariable(63, "ini lookups: %ld",
+                                   get_ini_lookup_count(database) -
+                                   lookups_base));
+    }
+    if(cmdl.if_changed) {
+        int written, unchanged;
+        get_output_counts(written, unchanged);
+        out.AddItem(ScriptVariable(63, "%d file(s) written, %d unchanged",
+                                   written, unchanged));
+    }
     if(err) {
         ErrorList *t;
         for(t = err; t; t = t->next)
-            fprintf(stderr, "%s\n", t->message.c_str());
+            errs.AddItem(t->message);
         delete err;
         return 4;
     }
-
     return 0;
 }
+
+int perform_gen_with_db(Database &database, int argc, const char * const *argv,
+                        ScriptVector &out, ScriptVector &errs)
+{
+    GenCmdline cmdl;
+    if(!parse_gen_cmdl(argc, argv, cmdl) || sv_is_set(cmdl.server_socket) ||
+        cmdl.watch)
+    {
+        errs.AddItem("malformed gen request");
+        return 1;
+    }
+        // -t and -r change the file prefix, but it must not outlive
+        // the request
+    ScriptVariable prefix = database.GetFilePrefix();
+    int res = run_gen(cmdl, database, out, errs);
+    database.SetFilePrefix(prefix);
+    return res;
+}
+
+int perform_gen(cmdline_common &cmd_com, int argc, const char * const *argv)
+{
+    bool ok;
+
+    GenCmdline cmdl;
+    ok = parse_gen_cmdl(argc, argv, cmdl);
+    if(!ok) {
+        fprintf(stderr, "try ``%s help gen''\n", argv[0]);
+        return 1;
+    }
+
+    if(sv_is_set(cmdl.server_socket)) {
+            // pass everything but the ``-d <socket>'' to the server
+        ScriptVector args;
+        int i;
+        for(i = 0; i < argc; i++) {
+            if(ScriptVariable(argv[i]) == "-d") {
+                i++;
+                continue;
+            }
+            args.AddItem(argv[i]);
+        }
+        int res = ask_gen_server(cmdl.server_socket, args);
+        if(res != -1)
+            return res;
+        // no server there, so let's do it on our own
+    }
+
+    if(cmdl.watch)
+        return watch_and_regenerate(cmd_com, cmdl);
+
+    Database database;
+    ok = load_inifiles(database, cmd_com.inifiles, cmd_com.opt_selector);
+    if(!ok)
+        return 1;
+
+    ScriptVector out, errs;
+    int res = run_gen(cmdl, database, out, errs);
+    int i;
+    for(i = 0; i < out.Length(); i++)
+        printf("%s\n", out[i].c_str());
+    for(i = 0; i < errs.Length(); i++)
+        fprintf(stderr, "%s\n", errs[i].c_str());
+    return res;
+}
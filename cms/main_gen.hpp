@@ -2,8 +2,16 @@
 #define MAIN_GEN_HPP_SENTRY
 
 struct cmdline_common;
+class Database;
+class ScriptVector;
 
 void help_gen(FILE *stream);
 int perform_gen(cmdline_common &cmdc, int argc, const char * const *argv);
 
+    // performs the gen command against the already loaded database
+    // (for the resident server); the lines to be printed to stdout and
+    // stderr are stored in out and errs; the exit code is returned
+int perform_gen_with_db(Database &database, int argc, const char * const *argv,
+                        ScriptVector &out, ScriptVector &errs);
+
 #endif
@@ -0,0 +1,472 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+
+
+#include <scriptpp/scrvar.hpp>
+#include <scriptpp/scrvect.hpp>
+
+#include "main_all.hpp"
+#include "main_gen.hpp"
+#include "main_srv.hpp"
+
+#include "database.hpp"
+#include "fileops.hpp"
+#include "fswatch.hpp"
+#include "unixsock.hpp"
+
+
+/*
+    The resident server keeps the Database loaded and performs ``gen''
+    jobs sent to it through a UNIX domain socket, so a job doesn't pay
+    for loading the ini files, building the substitutions etc.
+
+    The protocol: the client sends the gen command line (``gen'' and
+    the options), every argument terminated with a zero byte, and an
+    extra zero byte in the end, then shuts its side of the connection
+    down (arguments may be empty, so it's the shutdown that ends the
+    request); the server replies with text lines,
+    each starting with a letter and a space: ``o'' for a line to be
+    printed to stdout, ``e'' -- to stderr, and the last one is ``x''
+    followed by the exit code.  One connection is one job; jobs are
+    performed one by one, in the order they come.
+
+    Whatever the database caches must either remain valid or be dropped
+    once the sources change.  The ini files and the tag index files are
+    watched with inotify (see fswatch.hpp); if an ini file changes, the
+    whole database is reloaded before the next job; if a pageset's
+    source dir changes, the tag indices of the set are forgotten.  The
+    parsed set items are checked against the files' mtimes anyway, and
+    the comments are read anew for every page.
+ */
+
+#ifndef THALASSA_SERVER_REQUEST_LIMIT
+#define THALASSA_SERVER_REQUEST_LIMIT 65536
+#endif
+
+#ifndef THALASSA_SERVER_READ_TIMEOUT
+#define THALASSA_SERVER_READ_TIMEOUT 10  /* seconds */
+#endif
+
+
+void help_serve(FILE *stream)
+{
+    fprintf(stream,
+        "The ``serve'' command runs the resident generation server:\n"
+        "\n"
+        "    thalassa [...] serve [-v] <socket>\n"
+        "\n"
+        "The server loads the ini files once, then listens on the given\n"
+        "UNIX domain socket and performs the jobs passed to it with\n"
+        "\n"
+        "    thalassa [...] gen -d <socket> <gen_options>\n"
+        "\n"
+        "(e.g., ``thalassa gen -d thalassa.sock -g set=blog=p017''), so\n"
+        "that a job doesn't need to load and parse the configuration.\n"
+        "The ini files and the pagesets' source directories are watched\n"
+        "for changes; the configuration is reloaded once it changes.\n"
+        "Relative paths (e.g., given with ``-t'') are relative to the\n"
+        "server's working directory.  The socket file's permissions are\n"
+        "determined by the umask.\n"
+        "\n"
+        "The server runs in the foreground until SIGTERM or SIGINT.\n"
+        "With ``-v'', every job is logged to stderr along with the time\n"
+        "it took.\n"
+    );
+}
+
+
+struct ServerWatch {
+    int wd;
+    ScriptVariable fname;    // for the ini files: the name within the dir
+    ScriptVariable set_id;   // for the pagesets' source directories
+    ServerWatch *next;
+};
+
+struct ServerState {
+    const cmdline_common *cmdc;
+    Database *db;
+    bool stale;              // reload the db before the next job
+    bool verbose;
+    FileWatcher watcher;
+    ServerWatch *watches;
+
+    ServerState() : cmdc(0), db(0), stale(true), verbose(false), watches(0) {}
+    ~ServerState();
+    void DropWatches();
+    void AddWatch(const ScriptVariable &dir, const ScriptVariable &fname,
+                  const ScriptVariable &set_id);
+};
+
+ServerState::~ServerState()
+{
+    DropWatches();
+    if(db)
+        delete db;
+}
+
+void ServerState::DropWatches()
+{
+    while(watches) {
+        ServerWatch *tmp = watches;
+        watches = tmp->next;
+        watcher.RemoveDir(tmp->wd);
+        delete tmp;
+    }
+}
+
+void ServerState::AddWatch(const ScriptVariable &dir,
+                           const ScriptVariable &fname,
+                           const ScriptVariable &set_id)
+{
+    int wd = watcher.AddDir(dir);
+    if(wd == -1)
+        return;
+    ServerWatch *tmp = new ServerWatch;
+    tmp->wd = wd;
+    tmp->fname = fname;
+    tmp->set_id = set_id;
+    tmp->next = watches;
+    watches = tmp;
+}
+
+static void setup_watches(ServerState &st)
+{
+    st.DropWatches();
+    if(!st.watcher.IsOk())
+        return;
+    int i;
+    const ScriptVector &ini = st.db->GetLoadedFiles();
+    for(i = 0; i < ini.Length(); i++) {
+        ScriptVariable dir, fname;
+        split_file_path(ini[i], dir, fname);
+        st.AddWatch(dir, fname, ScriptVariableInv());
+    }
+    ScriptVector sets;
+    st.db->GetSets(sets);
+    for(i = 0; i < sets.Length(); i++) {
+        PageSetData data;
+        if(st.db->GetSetData(sets[i], data) && data.source_dir != "")
+            st.AddWatch(data.source_dir, ScriptVariableInv(), sets[i]);
+    }
+}
+
+static bool load_database(ServerState &st)
+{
+    Database *db = new Database;
+    bool ok = load_inifiles(*db, st.cmdc->inifiles, st.cmdc->opt_selector);
+    if(!ok) {
+        delete db;
+        return false;
+    }
+    if(st.db)
+        delete st.db;
+    st.db = db;
+        // without inotify, we never know whether anything changed
+    st.stale = !st.watcher.IsOk();
+    setup_watches(st);
+    return true;
+}
+
+static void handle_fs_events(ServerState &st)
+{
+    while(st.watcher.ReadEvents()) {
+        int wd;
+        ScriptVariable name;
+        while(st.watcher.NextEvent(wd, name)) {
+            if(wd == -1) {    // events lost, so who knows what changed
+                st.stale = true;
+                continue;
+            }
+            ServerWatch *w;
+            for(w = st.watches; w; w = w->next) {
+                if(w->wd != wd)
+                    continue;
+                if(w->set_id.IsValid()) {
+                    if(name == "" || name[0] == '_')
+                        st.db->ForgetSetListIndices(w->set_id);
+                } else {
+                    if(name == "" || name == w->fname)
+                        st.stale = true;
+                }
+            }
+        }
+    }
+}
+
+
+static bool write_all(int fd, const char *buf, int len)
+{
+    while(len > 0) {
+        int rc = write(fd, buf, len);
+        if(rc == -1) {
+            if(errno == EINTR)
+                continue;
+            return false;
+        }
+        buf += rc;
+        len -= rc;
+    }
+    return true;
+}
+
+static void add_reply_lines(ScriptVariable &reply, char kind,
+                            const ScriptVector &lines)
+{
+    int i;
+    for(i = 0; i < lines.Length(); i++) {
+        ScriptTokenVector v(lines[i], "\n");
+        int j;
+        for(j = 0; j < v.Length(); j++) {
+            reply += kind;
+            reply += ' ';
+            reply += v[j];
+            reply += '\n';
+        }
+    }
+}
+
+    // the request ends where the client shuts its side down (arguments
+    // may be empty, so a double zero byte doesn't mean the end); returns
+    // the number of arguments, or -1 if the request is broken
+static int read_request(int fd, char *buf, int bufsize)
+{
+    int used = 0;
+    for(;;) {
+        if(used >= bufsize)
+            return -1;
+        int rc = read(fd, buf + used, bufsize - used);
+        if(rc == -1 && errno == EINTR)
+            continue;
+        if(rc == -1)
+            return -1;
+        if(rc == 0)
+            break;
+        used += rc;
+    }
+    if(used < 2 || buf[used-1] != 0 || buf[used-2] != 0)
+        return -1;
+    int i, argc = 0;
+    for(i = 0; i < used - 1; i++)
+        if(buf[i] == 0)
+            argc++;
+    return argc;
+}
+
+static double seconds_since(const struct timeval &start)
+{
+    struct timeval now;
+    gettimeofday(&now, 0);
+    return (now.tv_sec - start.tv_sec) +
+           (now.tv_usec - start.tv_usec) / 1000000.0;
+}
+
+static void serve_client(ServerState &st, int fd)
+{
+    struct timeval tv;
+    tv.tv_sec = THALASSA_SERVER_READ_TIMEOUT;
+    tv.tv_usec = 0;
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+    static char buf[THALASSA_SERVER_REQUEST_LIMIT];
+    int argc = read_request(fd, buf, sizeof(buf));
+    if(argc < 1)
+        return;
+    const char **argv = new const char*[argc + 1];
+    const char *p = buf;
+    int i;
+    for(i = 0; i < argc; i++) {
+        argv[i] = p;
+        p += strlen(p) + 1;
+    }
+    argv[argc] = 0;
+
+    struct timeval start;
+    gettimeofday(&start, 0);
+
+        // the client could change a file right before sending the job,
+        // so the events must be taken into account right now
+    handle_fs_events(st);
+
+    ScriptVector out, errs;
+    int res;
+    if(strcmp(argv[0], "gen") != 0) {
+        errs.AddItem(ScriptVariable("unsupported command ") + argv[0]);
+        res = 1;
+    } else
+    if(st.stale && !load_database(st)) {
+        errs.AddItem("the configuration can't be loaded (see the server's "
+                     "stderr); the job isn't done");
+        res = 1;
+    } else {
+        res = perform_gen_with_db(*st.db, argc, argv, out, errs);
+        if(!st.watcher.IsOk())
+            st.stale = true;
+    }
+
+    ScriptVariable reply;
+    add_reply_lines(reply, 'o', out);
+    add_reply_lines(reply, 'e', errs);
+    reply += ScriptVariable(16, "x %d\n", res);
+    write_all(fd, reply.c_str(), reply.Length());
+
+    if(st.verbose) {
+        ScriptVariable cmdline;
+        for(i = 0; i < argc; i++) {
+            if(i > 0)
+                cmdline += ' ';
+            cmdline += argv[i];
+        }
+        fprintf(stderr, "%s: %d (%.3f s)\n",
+                cmdline.c_str(), res, seconds_since(start));
+    }
+    delete[] argv;
+}
+
+
+static volatile sig_atomic_t stop_requested = 0;
+
+static void stop_handler(int)
+{
+    stop_requested = 1;
+}
+
+static void set_signals()
+{
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = SIG_IGN;
+    sigaction(SIGPIPE, &sa, 0);
+    sa.sa_handler = stop_handler;   // no SA_RESTART, so poll is broken
+    sigaction(SIGTERM, &sa, 0);
+    sigaction(SIGINT, &sa, 0);
+}
+
+int perform_serve(cmdline_common &cmdc, int argc, const char * const *argv)
+{
+    ServerState st;
+    st.cmdc = &cmdc;
+    int c = 1;
+    if(argv[c] && 0 == strcmp(argv[c], "-v")) {
+        st.verbose = true;
+        c++;
+    }
+    if(!argv[c] || argv[c][0] == '-' || argv[c+1]) {
+        help_serve(stderr);
+        return 1;
+    }
+    ScriptVariable path = argv[c];
+
+    if(!st.watcher.IsOk())
+        fprintf(stderr, "WARNING: no file change notification, the "
+                        "configuration will be reloaded for every job\n");
+    if(!load_database(st))
+        return 1;
+
+    int ls = unix_socket_listen(path);
+    if(ls == -1)
+        return 2;
+    set_signals();
+
+    while(!stop_requested) {
+        struct pollfd pfd[2];
+        pfd[0].fd = ls;
+        pfd[0].events = POLLIN;
+        pfd[1].fd = st.watcher.GetFd();
+        pfd[1].events = POLLIN;
+        int rc = poll(pfd, st.watcher.IsOk() ? 2 : 1, -1);
+        if(rc == -1) {
+            if(errno == EINTR)
+                continue;
+            perror("poll");
+            break;
+        }
+        if(st.watcher.IsOk() && pfd[1].revents)
+            handle_fs_events(st);
+        if(pfd[0].revents & POLLIN) {
+            int fd = accept(ls, 0, 0);
+            if(fd == -1)
+                continue;
+            serve_client(st, fd);
+            close(fd);
+        }
+    }
+
+    close(ls);
+    unlink(path.c_str());
+    return 0;
+}
+
+
+int ask_gen_server(const ScriptVariable &socket_path, const ScriptVector &args)
+{
+    int fd = unix_socket_connect(socket_path);
+    if(fd == -1)
+        return -1;
+
+    signal(SIGPIPE, SIG_IGN);
+    int i, reqlen = 0;
+    for(i = 0; i < args.Length(); i++)
+        reqlen += args[i].Length() + 1;
+    char *reqbuf = new char[reqlen + 1];
+    char *p = reqbuf;
+    for(i = 0; i < args.Length(); i++) {
+        memcpy(p, args[i].c_str(), args[i].Length() + 1);
+        p += args[i].Length() + 1;
+    }
+    *p = 0;
+    bool ok = write_all(fd, reqbuf, reqlen + 1);
+    delete[] reqbuf;
+    if(!ok) {
+        close(fd);
+        return -1;
+    }
+    shutdown(fd, SHUT_WR);
+
+    ScriptVariable reply;
+    char buf[4096];
+    int rc;
+    while((rc = read(fd, buf, sizeof(buf))) != 0) {
+        if(rc == -1) {
+            if(errno == EINTR)
+                continue;
+            break;
+        }
+        reply += ScriptVariable(buf, rc);
+    }
+    close(fd);
+
+    int res = -2;
+    ScriptTokenVector lines(reply, "\n");
+    for(i = 0; i < lines.Length(); i++) {
+        const ScriptVariable &ln = lines[i];
+        if(ln.Length() < 2 || ln[1] != ' ')
+            continue;
+        const char *text = ln.c_str() + 2;
+        switch(ln[0]) {
+        case 'o':
+            printf("%s\n", text);
+            break;
+        case 'e':
+            fprintf(stderr, "%s\n", text);
+            break;
+        case 'x':
+            res = atoi(text);
+            break;
+        }
+    }
+    if(res == -2) {
+        fprintf(stderr, "%s: the server didn't complete the job\n",
+                socket_path.c_str());
+        return 4;
+    }
+    return res;
+}
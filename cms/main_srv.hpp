@@ -0,0 +1,16 @@
+#ifndef MAIN_SRV_HPP_SENTRY
+#define MAIN_SRV_HPP_SENTRY
+
+struct cmdline_common;
+class ScriptVariable;
+class ScriptVector;
+
+void help_serve(FILE *stream);
+int perform_serve(cmdline_common &cmdc, int argc, const char * const *argv);
+
+    // the client side: passes the gen command line (starting with the
+    // command name) to the server, prints what the server replies;
+    // returns the exit code, or -1 if there's no server on the socket
+int ask_gen_server(const ScriptVariable &socket_path, const ScriptVector &args);
+
+#endif
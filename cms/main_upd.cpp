@@ -608,18 +608,11 @@ static void do_update_teaser(HeadedTextMessage &parser)
 static bool proceed_update_headedtext(const cmdline_update &opts)
 {
     const char *fp = opts.filename.c_str();
-    FILE *s = fopen(fp, "r");
-    if(!s) {
+    HeadedTextMessage parser;
+    if(!parser.ReadFile(fp)) {
         perror(fp);
         return false;
     }
-    HeadedTextMessage parser;
-    int c;
-    while((c = fgetc(s)) != EOF) {
-        if(!parser.FeedChar(c))   // int, ok
-            break;
-    }
-    fclose(s);
 
     if(opts.dry_run || opts.verbose) {
         fprintf(stderr, "== header fields before changes ==============\n");
@@ -660,7 +653,7 @@ static bool proceed_update_headedtext(const cmdline_update &opts)
     }
 
     // save parser to file
-    s = fopen(fp, "w");
+    FILE *s = fopen(fp, "w");
     if(!s) {
         perror(fp);
         return false;
@@ -794,18 +787,11 @@ int perform_inspect(cmdline_common &cmd_com, int argc, const char *const *argv)
                         options.filename.c_str());
 
     const char *fp = options.filename.c_str();
-    FILE *s = fopen(fp, "r");
-    if(!s) {
+    HeadedTextMessage parser;
+    if(!parser.ReadFile(fp)) {
         perror(fp);
         return false;
     }
-    HeadedTextMessage parser;
-    int c;
-    while((c = fgetc(s)) != EOF) {
-        if(!parser.FeedChar(c))   // int, ok
-            break;
-    }
-    fclose(s);
 
     print_headers(parser, stdout);
     fputc('\n', stdout);
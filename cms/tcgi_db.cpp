@@ -31,6 +31,13 @@ ThalassaCgiDb::~ThalassaCgiDb()
         delete access_checker;
 }
 
+void ThalassaCgiDb::SetRequest(const Cgi *cgi)
+{
+    delete subst;
+    subst = new ThalassaCgiDbSubstitution(this, cgi);
+    the_session = 0;
+}
+
 bool ThalassaCgiDb::Load(const ScriptVariable &filename)
 {
     conf_file = filename;
@@ -61,6 +68,14 @@ ScriptVariable ThalassaCgiDb::GetUserdataDirectory() const
                                      THALASSA_DEFAULT_USERDATA_DIR);
 }
 
+void ThalassaCgiDb::
+GetSessionStoreParameters(ScriptVariable &kind, int &size) const
+{
+    kind = inifile->GetTextParameter("general", 0, "session_store", "files");
+    kind.Trim().Tolower();
+    size = inifile->GetIntegerParameter("general", 0, "session_table_size", 0);
+}
+
 #if 0
 ScriptVariable ThalassaCgiDb::GetSessionsDirectory() const
 {
@@ -87,6 +102,17 @@ GetCaptchaParameters(ScriptVariable &secret, int &time_to_live) const
         inifile->GetIntegerParameter("captcha", 0, "expire", 300);
 }
 
+void ThalassaCgiDb::GetCaptchaPoolParameters(ScriptVariable &dir,
+                                             int &size) const
+{
+    size = inifile->GetIntegerParameter("captcha", 0, "pool_size", 0);
+    const char *tmp = inifile->GetTextParameter("captcha", 0, "pool_dir", 0);
+    if(tmp)
+        dir = tmp;
+    else
+        dir = GetUserdataDirectory() + "/_captcha_pool";
+}
+
 ScriptVariable ThalassaCgiDb::GetHtmlSnippet(const ScriptVariable &name) const
 {
     return inifile->GetTextParameter("html", 0, name.c_str(), "");
@@ -535,6 +561,19 @@ bool ThalassaCgiDb::MakeCommentPageRegenCmd(ScriptVector &result) const
     return true;
 }
 
+bool ThalassaCgiDb::GetCommentPageRegenSpool(ScriptVariable &spooldir,
+                                              ScriptVector &targets) const
+{
+    const char *sd, *tg;
+    sd = inifile->GetTextParameter("comments", 0, "regen_spool", 0);
+    tg = inifile->GetTextParameter("comments", 0, "regen_targets", 0);
+    if(!sd || !tg)
+        return false;
+    spooldir = (*subst)(sd).Trim();
+    targets = ScriptWordVector((*subst)(tg), ", \t\r\n");
+    return spooldir != "" && targets.Length() > 0;
+}
+
 bool ThalassaCgiDb::CanPost(bool &bypass_premod) const
 {
     if(!the_session)   // this is actually a bug!
@@ -21,9 +21,6 @@ class ThalassaCgiDb {
     class IniFileParser *inifile;
     class ThalassaCgiDbSubstitution *subst;
     ScriptVariable conf_file;
-#if 0
-    class Cgi *the_request;
-#endif
     class SessionData *the_session;
     class AccessChecker *access_checker;
 public:
@@ -35,18 +32,22 @@ public:
 
     void GetFormatData(const char *&encd, const char *&allowed_tags) const;
 
-#if 0
-        // this is only for the macroprocessor to have access to the req.
-    void SetRequest(Cgi *req) { the_request = req; }
-    Cgi *GetRequest() const { return the_request; }
-#endif
+        // a persistent process keeps the database loaded between the
+        // requests and calls this for every new request; the macros'
+        // per-request data (the page, the message etc.) is forgotten,
+        // and so is the session
+    void SetRequest(const Cgi *cgi);
 
     void SetSession(SessionData *sd) { the_session = sd; }
     SessionData *GetSession() const { return the_session; }
 
     ScriptVariable GetUserdataDirectory() const;
+        // [general] session_store and session_table_size (see tcgi_sst.hpp)
+    void GetSessionStoreParameters(ScriptVariable &kind, int &size) const;
 
     void GetCaptchaParameters(ScriptVariable &secret, int &time_to_live) const;
+        // [captcha] pool_size (0 means no pool) and pool_dir
+    void GetCaptchaPoolParameters(ScriptVariable &dir, int &size) const;
 
     ScriptVariable GetHtmlSnippet(const ScriptVariable &name) const;
 
@@ -95,6 +96,11 @@ public:
                            struct DiscussionInfo &result) const;
 
     bool MakeCommentPageRegenCmd(ScriptVector &result) const;
+        // [comments] regen_spool and regen_targets; if both are set,
+        // the targets are put into the generator's spool directory
+        // and the regen command is run in background
+    bool GetCommentPageRegenSpool(ScriptVariable &spooldir,
+                                  ScriptVector &targets) const;
 
     bool CanPost(bool &bypass_premod) const;
     bool CanSeeHidden(const ScriptVariable &comment_owner_id) const;
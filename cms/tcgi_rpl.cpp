@@ -14,6 +14,7 @@
 #include "filters.hpp"
 #include "fileops.hpp"
 #include "fpublish.hpp"
+#include "cmtindex.hpp"
 
 #include "tcgi_rpl.hpp"
 
@@ -44,6 +45,14 @@ static bool read_headed_text(ScriptVariable fname, HeadedTextMessage &parser,
     if(fname.IsInvalid() || fname == "")
         return false;
 
+    if(read_body) {
+        if(!parser.ReadFile(fname.c_str()))
+            return false;
+        int code, line;
+        return !parser.Error(code, line);
+    }
+
+        // only the headers are needed, so we read until the body begins
     static unsigned char buf[4096];    // unsignedness is critical here!
     int fd, rc;
     fd = open(fname.c_str(), O_RDONLY);
@@ -95,12 +104,12 @@ void get_owner_and_date_from_htm(const HeadedTextMessage &htm,
 }
 
 static void get_data_from_hm(const HeadedTextMessage &hm,
-                             const FilterChainMaker &filt_maker,
+                             FilterChainMaker &filt_maker,
                              DiscussDisplayData &result,
                              bool get_body)
 {
     const ScriptVector &hdr = hm.GetHeaders();
-    FilterChainSet *fcs = filt_maker.MakeChainSet(hdr);
+    const FilterChainSet *fcs = filt_maker.GetChainSet(hdr);
 
     get_owner_and_date_from_htm(hm, result.user_id, result.unixtime);
 
@@ -129,8 +138,6 @@ static void get_data_from_hm(const HeadedTextMessage &hm,
         result.body = fcs->ConvertContent(hm.GetBody());
         result.bodysrc = fcs->ConvertEncOnly(hm.GetBody());
     }
-
-    delete fcs;
 }
 
 ScriptVariable get_body_from_html(const DiscussionInfo &src)
@@ -350,10 +357,20 @@ int save_new_comment(const ScriptVariable &cmtdir,
 {
     if(-1 == check_and_make_dir(cmtdir))
         return -1;
+
+        // the index must be loaded before we create the file, or else
+        // it would look stale; if it can't be locked, it is left alone
+        // so it will be rebuilt by the next reader
+    CommentIndex idx(cmtdir);
+    idx.Lock();
+    idx.Load(false);
+
     ScriptVariable hintfname = cmtdir + "/" HINT_FNAME;
     int max_id = read_hint(hintfname.c_str());
     if(max_id < 1 || max_id > MAX_COMMENT_ID)    // missing or corrupt
         max_id = 0;
+    if(max_id < idx.GetMaxId())
+        max_id = idx.GetMaxId();
 
     int fd;
     int new_id = max_id;
@@ -374,6 +391,8 @@ int save_new_comment(const ScriptVariable &cmtdir,
     close(fd);
 
     write_hint(hintfname.c_str(), new_id);
+    idx.UpdateRecord(new_id);
+    idx.Save();
 
     if(cmt_filename)
         *cmt_filename = fname;
@@ -420,6 +439,9 @@ bool save_comment(const DiscussionInfo &src, const HeadedTextMessage &result)
 {
     ScriptVariable fname =
         src.cmt_tree_dir + ScriptVariable(16, "/%04d", src.comment_id);
+    CommentIndex idx(src.cmt_tree_dir);
+    idx.Lock();
+    idx.Load(false);
     int fd = open(fname.c_str(), O_WRONLY|O_TRUNC);
     if(fd == -1)
         return false;
@@ -429,6 +451,8 @@ bool save_comment(const DiscussionInfo &src, const HeadedTextMessage &result)
     fsync(fd);
     close(fd);
 
+    idx.UpdateRecord(src.comment_id);
+    idx.Save();
     return true;
 }
 
@@ -436,28 +460,27 @@ bool delete_comment(const DiscussionInfo &src)
 {
     ScriptVariable fname =
         src.cmt_tree_dir + ScriptVariable(16, "/%04d", src.comment_id);
+    CommentIndex idx(src.cmt_tree_dir);
+    idx.Lock();
+    idx.Load(false);
     int res = unlink(fname.c_str());
-    return res != -1;
+    if(res == -1)
+        return false;
+    idx.RemoveRecord(src.comment_id);
+    idx.Save();
+    return true;
 }
 
 bool get_comment_list(ScriptVariable dir, ScriptVariable subd,
                       ScriptVector &result)
 {
-    ScriptVariable fname = dir + "/" + subd;
-    ReadDir rdir(fname.c_str());
-    if(!rdir.OpenOk())
+    CommentIndex idx(dir + "/" + subd);
+    if(!idx.Load(false))
         return false;
     result.Clear();
-    const char *s;
-    while((s = rdir.Next())) {
-        if(!*s || *s == '.' || *s == '_')
-            continue;
-        ScriptVariable sv(s);
-        long n;
-        if(!sv.GetLong(n, 10) || n < 1)
-            continue;
-        result.AddItem(ScriptNumber(n)); // so leading zeroes are dropped
-    }
+    int i;
+    for(i = 0; i < idx.Count(); i++)
+        result.AddItem(ScriptNumber(idx[i].id));
     return true;
 }
 
@@ -478,7 +501,7 @@ void get_encoded_fields_from_hm(const HeadedTextMessage &hm,
     FilterChainMaker filt_maker(target_encoding, allowed_tags);
 
     const ScriptVector &hdr = hm.GetHeaders();
-    FilterChainSet *fcs = filt_maker.MakeChainSet(hdr);
+    const FilterChainSet *fcs = filt_maker.GetChainSet(hdr);
 
     ScriptVariable tmp;
     ScriptVariableInv inv;
@@ -487,6 +510,4 @@ void get_encoded_fields_from_hm(const HeadedTextMessage &hm,
     title = tmp.IsValid() ? fcs->ConvertUserdata(tmp) : inv;
     tmp = hm.FindHeader("from");
     username = tmp.IsValid() ? fcs->ConvertUserdata(tmp) : inv;
-
-    delete fcs;
 }
@@ -20,15 +20,14 @@ enum {
     email_change_cooldown = (24*3600)    // 1 day
 };
 
-#define SESS_SUBDIR "_sessions"
 #define USER_SUBDIR "_users"
 #define USER_FILENAME "_data"
 #define EMAIL_SUBDIR "_email"
 #define PREMOD_QUEUE_SUBDIR "_premod_queue"
 
 
-SessionData::SessionData(const ScriptVariable &dirpath)
-    : dirname(dirpath), just_created(false), just_removed(false),
+SessionData::SessionData(const ScriptVariable &dirpath, SessionStore *st)
+    : dirname(dirpath), store(st), just_created(false), just_removed(false),
     username(ScriptVariableInv()), userinfo_read(false), logged_in(false),
     email_data(0)
 {
@@ -80,25 +79,21 @@ bool SessionData::Validate(ScriptVariable sid)
     ScriptVariable fn = delimpos.Before().Get();
     ScriptVariable token = delimpos.After().Get();
 
-    ScriptVariable fname = dirname + "/" SESS_SUBDIR "/" + fn;
-    info.Clear();
-    if(!info.FOpen(fname.c_str()))
-        return false;
-    bool rr = info.RunParser();
-    info.FClose();
-    if(!rr)
+    rec.Clear();
+    if(!store->Load(fn, rec))
         return false;
 
-    ScriptVariable tk = info.GetItem("token");
-    ScriptVariable oldtk = info.GetItem("old_token");
-    if(token != tk && token != oldtk)
+    if(token == "")
         return false;
+    if(token != rec.token &&
+        (rec.old_token.IsInvalid() || token != rec.old_token))
+    {
+        return false;
+    }
 
     sess_fn = fn;
-    username = info.GetItem("user");
-    ScriptVariable lgg = info.GetItem("logged_in");
-    lgg.Trim().Tolower();
-    logged_in = lgg == "yes";
+    username = rec.user;
+    logged_in = rec.logged_in;
     if(logged_in)
         UpdateUserLastSeen();
     return true;
@@ -144,17 +139,17 @@ bool SessionData::Create(int time_to_live)
     fill_random(tok, sizeof(tok));
 
     sess_fn = uchar2hex(id, sizeof(id));
-    unsigned long now = time(0);
-    info.Clear();
-    info.AddItem("token", uchar2hex(tok, sizeof(tok)));
-    info.AddItem("created", ScriptNumber(now));
-    info.AddItem("expire", ScriptNumber(now + time_to_live));
+    long long now = time(0);
+    rec.Clear();
+    rec.token = uchar2hex(tok, sizeof(tok));
+    rec.created = now;
+    rec.expire = now + time_to_live;
     just_created = true;
     bool ok = Save(true);
     if(ok)
         return true;
     sess_fn = "";
-    info.Clear();
+    rec.Clear();
     return false;
 }
 
@@ -162,22 +157,19 @@ bool SessionData::Renew(int time_to_live)
 {
     if(!IsValid())
         return false;
-    ScriptVariable oldold = info.GetItem("oldtoken");
-    ScriptVariable old = info.GetItem("token");
-
     unsigned char tok[8];
     fill_random(tok, sizeof(tok));
 
-    info.SetItem("token", uchar2hex(tok, sizeof(tok)));
-    info.SetItem("oldtoken", old);
-    unsigned long now = time(0);
-    info.SetItem("expire", ScriptNumber(now + time_to_live));
+    rec.old_token = rec.token;
+    rec.token = uchar2hex(tok, sizeof(tok));
+    long long now = time(0);
+    rec.expire = now + time_to_live;
 
     bool ok = Save(false);
     if(ok)
         return true;
     sess_fn = "";
-    info.Clear();
+    rec.Clear();
     return false;
 }
 
@@ -194,7 +186,7 @@ ScriptVariable SessionData::GetId0() const
 ScriptVariable SessionData::GetId() const
 {
     if(sess_fn.IsValid() && sess_fn != "")
-        return sess_fn + '_' + info.GetItem("token");
+        return sess_fn + '_' + rec.token;
     return ScriptVariableInv();
 }
 
@@ -202,9 +194,8 @@ void SessionData::Remove()
 {
     if(sess_fn.IsInvalid() || sess_fn == "")
         return;
-    ScriptVariable fname = dirname + "/" SESS_SUBDIR "/" + sess_fn;
-    unlink(fname.c_str());
-    info.Clear();
+    store->Remove(sess_fn);
+    rec.Clear();
     sess_fn.Invalidate();
     just_removed = true;
 }
@@ -282,15 +273,20 @@ bool SessionData::CheckUserStatus(ScriptVariable login, bool allow_pending)
         allow_pending ? (status.Trim().Tolower() == "blocked") :
                         (status.Trim().Tolower() != "active"))
     {
-        username.Invalidate();
-        userinfo.Clear();
-        userinfo_read = false;
-        logged_in = false;
+        ForgetUser();
         return false;
     }
     return true;
 }
 
+void SessionData::ForgetUser()
+{
+    username.Invalidate();
+    userinfo.Clear();
+    userinfo_read = false;
+    logged_in = false;
+}
+
 bool SessionData::Login(ScriptVariable lgn, ScriptVariable pt)
 {
     lgn.Tolower();
@@ -299,6 +295,9 @@ bool SessionData::Login(ScriptVariable lgn, ScriptVariable pt)
     pt.Toupper();
     if(!check_username_safe(lgn.c_str()) || !check_passtoken_safe(pt.c_str()))
         return false;
+        // before a one-time password is used up
+    if(!store->CanKeepUser(lgn))
+        return false;
 
     bool ok = CheckUserStatus(lgn, true);
     if(!ok)
@@ -330,13 +329,17 @@ bool SessionData::Login(ScriptVariable lgn, ScriptVariable pt)
     }
 
     // okay, successfully passed
+    SessionRecord old = rec;
     username = lgn;
     logged_in = true;
-    unsigned long now = time(0);
-    info.SetItem("user", username);
-    info.SetItem("logged_in", "yes");
-    info.SetItem("login_time", ScriptNumber(now));
-    Save(false);
+    rec.user = username;
+    rec.logged_in = true;
+    rec.login_time = time(0);
+    if(!Save(false)) {
+        rec = old;
+        ForgetUser();
+        return false;
+    }
     UpdateUserLastLogin();
     return true;
 }
@@ -346,7 +349,7 @@ bool SessionData::SetUser(ScriptVariable lgn)
     lgn.Tolower();
     if(HasUser() && username != lgn)
         return false;
-    if(!check_username_safe(lgn.c_str()))
+    if(!check_username_safe(lgn.c_str()) || !store->CanKeepUser(lgn))
         return false;
 
 #if 0
@@ -361,9 +364,14 @@ bool SessionData::SetUser(ScriptVariable lgn)
     if(!ok)
         return false;
 
-    info.SetItem("user", username);
-    info.SetItem("logged_in", logged_in ? "yes" : "no");
-    Save(false);
+    SessionRecord old = rec;
+    rec.user = username;
+    rec.logged_in = logged_in;
+    if(!Save(false)) {
+        rec = old;
+        ForgetUser();
+        return false;
+    }
     return true;
 }
 
@@ -481,18 +489,7 @@ static ScriptVariable serialize_script_map(const ScriptMap &map)
 
 bool SessionData::Save(bool creation)
 {
-    if(creation)
-        make_dir_if_necessary((dirname + "/" SESS_SUBDIR).c_str());
-    ScriptVariable infostr = serialize_script_map(info);
-    ScriptVariable fname = dirname + "/" SESS_SUBDIR "/" + sess_fn;
-    int fd = open(fname.c_str(),
-                  creation ? O_WRONLY|O_CREAT|O_EXCL : O_WRONLY|O_TRUNC,
-                  0600);
-    if(fd == -1)
-        return false;
-    int wc = write(fd, infostr.c_str(), infostr.Length());
-    int cr = close(fd);
-    return wc == infostr.Length() && cr != -1;
+    return store->Save(sess_fn, rec, creation);
 }
 
 bool SessionData::SaveUserinfo()
@@ -570,7 +567,7 @@ int SessionData::CreateUser(ScriptVariable lgn, const ScriptVariable &name,
     lgn.Tolower();
     if(logged_in || (HasUser() && username != lgn))
         return cu_bug;
-    if(!check_username_acceptable(lgn.c_str()))
+    if(!check_username_acceptable(lgn.c_str()) || !store->CanKeepUser(lgn))
         return cu_bad_id;
 
     ConfigInformation prof;
@@ -610,9 +607,14 @@ int SessionData::CreateUser(ScriptVariable lgn, const ScriptVariable &name,
     make_dir_if_necessary((dirname + "/" USER_SUBDIR "/" + username).c_str());
     UpdateUserLastPwdsent();   // this will save userinfo
 
-    info.SetItem("user", username);
-    info.SetItem("logged_in", "no");
-    Save(false);
+    SessionRecord old = rec;
+    rec.user = username;
+    rec.logged_in = false;
+    if(!Save(false)) {
+        rec = old;
+        ForgetUser();
+        return cu_conf_error;
+    }
 
     return cu_success;
 }
@@ -778,158 +780,7 @@ void SessionData::RemoveFromPremodQueue(const ScriptVariable &pgid, int cmtid)
     unlink(linkname.c_str());
 }
 
-////////////////////////////////////////////////////////
-// cleanup implementation
-
-#define CLEANUP_LOCK_FILENAME "__cleanup_lock"
-#define CLEANUP_TIME_FILENAME "__next_cleanup"
-#define CLEANUP_PERIOD (3*3600)
-#define CLEANUP_LOCK_REMOVAL_ADDITION 600
-
-
-static bool write_next_cleanup_time(const ScriptVariable &dir, long long tm)
-{
-    ScriptVariable fname = dir + "/" + CLEANUP_TIME_FILENAME;
-    ScriptVariable fname_tmp = fname + "." + ScriptNumber(getpid());
-    int fd = open(fname_tmp.c_str(), O_WRONLY|O_CREAT|O_EXCL, 0600);
-    if(fd == -1)
-        return false;
-    int wc = write(fd, &tm, sizeof(tm));
-    close(fd);
-    if(wc != sizeof(tm)) {
-        unlink(fname_tmp.c_str());
-        return false;
-    }
-    return -1 != rename(fname_tmp.c_str(), fname.c_str());
-}
-
-static long long get_next_cleanup_time(const ScriptVariable &dir)
-{
-    ScriptVariable fname = dir + "/" + CLEANUP_TIME_FILENAME;
-    int fd = open(fname.c_str(), O_RDONLY);
-    if(fd == -1)
-        return -1;
-    long long tm;
-    int rc;
-    rc = read(fd, &tm, sizeof(tm));
-    close(fd);
-    if(rc != sizeof(tm))
-        return -1;
-    return tm;
-}
-
-static void
-remove_expired_session_files(const ScriptVariable &dir, long long now)
+void SessionData::PerformCleanup(int max_count)
 {
-    const char *s;
-    ReadDir rd(dir.c_str());
-    while((s = rd.Next())) {
-        ConfigInformation info;
-        bool ok = info.FOpen((dir + "/" + s).c_str());
-        if(!ok)
-            continue;
-        bool rd = info.RunParser();
-        info.FClose();
-        if(!rd)
-            continue;
-        ScriptVariable expire = info.GetItem("expire");
-        bool remv;
-        if(expire.IsInvalid())
-            remv = true;
-        else {
-            long long et;
-            if(expire.GetLongLong(et, 10))
-                remv = et < now;
-            else
-                remv = true;
-        }
-        if(remv)
-            unlink((dir + "/" + s).c_str());
-    }
-}
-
-static bool have_group(unsigned int gid)
-{
-    if(getegid() == gid)
-        return true;
-    int cnt = getgroups(0, 0);
-    gid_t *v = new gid_t[cnt];
-    getgroups(cnt, v);
-    int i;
-    bool res = false;
-    for(i = 0; i < cnt; i++) {
-        if(gid == v[i]) {
-            res = true;
-            break;
-        }
-    }
-    delete[] v;
-    return res;
+    store->Cleanup(time(0), max_count);
 }
-
-void SessionData::PerformCleanup(int ttl)
-{
-    if(dirname.IsInvalid() || dirname == "")
-        return;
-
-    struct stat st;
-    int res;
-
-    long long now = time(0);
-
-    ScriptVariable sessdirname = dirname + "/" SESS_SUBDIR;
-
-        // most of the time we don't proceed because the time didn't come
-        // so this check is to be done first
-    long long tt = get_next_cleanup_time(sessdirname);
-    if(tt != -1 && tt >= now)
-        return;
-
-    // now check if the directory exists and is accessible
-    // note that we really need full access to the directory, including
-    // read access, or else we will not be able to perform cleanup
-    res = stat(sessdirname.c_str(), &st);
-    if(res == -1)
-        return;
-    bool accessible =                ((0007 & st.st_mode) == 0007)  ||
-        (have_group(st.st_gid)    && ((0070 & st.st_mode) == 0070)) ||
-        ((geteuid() == st.st_uid) && ((0700 & st.st_mode) == 0700));
-    if(!accessible)
-        return;
-
-    // now check the lock (may be someone else is already doing this)
-    ScriptVariable lockfname = sessdirname + "/" CLEANUP_LOCK_FILENAME;
-    res = stat(lockfname.c_str(), &st);
-    if(res != -1) {
-        // Lock exists, but if it is too old, we will remove it
-        // so that someone else will be able to perform the cleanup when
-        // the time comes.  In this case, we'll add some time to the
-        // next cleanup time so that some time has to pass before
-        // someone actually clenup
-        if(st.st_mtime < now - CLEANUP_PERIOD) {
-            long long tt = now + CLEANUP_LOCK_REMOVAL_ADDITION;
-            if(!write_next_cleanup_time(sessdirname, tt))
-                return;
-            sync();
-            unlink(lockfname.c_str());
-        }
-        return;
-    }
-
-    // well, seems we're to go!  try to get the lock
-
-    int fd = open(lockfname.c_str(), O_WRONLY|O_CREAT|O_EXCL, 0600);
-    if(fd == -1)    // failed to get the lock, let someone else try :-)
-        return;
-    close(fd);
-
-    if(!write_next_cleanup_time(sessdirname, now + CLEANUP_PERIOD))
-        return;
-
-    // now the cleanup!!!
-    remove_expired_session_files(sessdirname, now);
-
-    // remove the lock
-    unlink(lockfname.c_str());
-}
-
@@ -4,19 +4,23 @@
 #include <scriptpp/scrvar.hpp>
 #include <scriptpp/confinfo.hpp>
 
+#include "tcgi_sst.hpp"
+
 class ScriptVector;
 
 class SessionData {
     ScriptVariable dirname;
+    SessionStore *store;
     ScriptVariable sess_fn;
     bool just_created, just_removed;
-    ConfigInformation info;
+    SessionRecord rec;
     ScriptVariable username;
     ConfigInformation userinfo;
     bool userinfo_read, logged_in;
     class EmailData *email_data;
 public:
-    SessionData(const ScriptVariable &dirpath);
+        // the store is owned by the caller
+    SessionData(const ScriptVariable &dirpath, SessionStore *store);
     ~SessionData();
 
     bool Validate(ScriptVariable sess_id);
@@ -31,7 +35,8 @@ public:
 
     void Remove();
 
-    void PerformCleanup(int time_to_live);
+        // removes at most max_count expired sessions (of anyone)
+    void PerformCleanup(int max_count);
 
     void GetCurrentRoles(ScriptVector &roles) const;
 
@@ -93,6 +98,7 @@ private:
     long long GetUserLastEvent(const char *id) const;
     bool UpdateUserLastEvent(const char *event);
 
+    void ForgetUser();
     bool Save(bool creation);
     bool SaveUserinfo();
 };
@@ -0,0 +1,559 @@
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#include <scriptpp/scrvar.hpp>
+#include <scriptpp/scrvect.hpp>
+
+#include "xcgi.hpp"
+#include "unixsock.hpp"
+
+#include "tcgi_srv.hpp"
+
+
+#ifndef THALASSA_CGI_SCGI_HEAD_LIMIT
+#define THALASSA_CGI_SCGI_HEAD_LIMIT 65536
+#endif
+
+#ifndef THALASSA_CGI_SCGI_TIMEOUT
+#define THALASSA_CGI_SCGI_TIMEOUT 10  /* seconds */
+#endif
+
+#ifndef THALASSA_CGI_SCGI_MAX_REQUESTS
+#define THALASSA_CGI_SCGI_MAX_REQUESTS 10000
+#endif
+
+
+ScgiServerOptions::ScgiServerOptions()
+    : max_requests(THALASSA_CGI_SCGI_MAX_REQUESTS), status_socket(0)
+{
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    workers = n > 0 ? n : 1;
+}
+
+
+static bool read_exactly(int fd, char *buf, int len)
+{
+    while(len > 0) {
+        int rc = read(fd, buf, len);
+        if(rc == -1 && errno == EINTR)
+            continue;
+        if(rc < 1)
+            return false;
+        buf += rc;
+        len -= rc;
+    }
+    return true;
+}
+
+    // the header is a netstring: ``<length>:<data>,'', where the data is
+    // the variables' names and values, each terminated with a zero byte;
+    // the length prefix is read by bytes so that nothing is read beyond
+    // the header, the body is left for the Cgi object to read
+static bool read_scgi_head(int fd, ScriptVector &vars)
+{
+    long len = 0;
+    int digits = 0;
+    for(;;) {
+        char c;
+        if(!read_exactly(fd, &c, 1))
+            return false;
+        if(c == ':')
+            break;
+        if(c < '0' || c > '9' || ++digits > 7)
+            return false;
+        len = len * 10 + (c - '0');
+    }
+    if(digits == 0 || len < 1 || len > THALASSA_CGI_SCGI_HEAD_LIMIT)
+        return false;
+
+    char *buf = new char[len+1];
+    bool ok = read_exactly(fd, buf, len+1) &&
+              buf[len] == ',' && buf[len-1] == '\0';
+    const char *p = buf;
+    while(ok && p < buf + len) {
+        int l = strlen(p);
+        vars.AddItem(ScriptVariable(p, l));
+        p += l + 1;
+    }
+    delete[] buf;
+    return ok && vars.Length() % 2 == 0;
+}
+
+static void set_timeouts(int fd)
+{
+    struct timeval tv;
+    tv.tv_sec = THALASSA_CGI_SCGI_TIMEOUT;
+    tv.tv_usec = 0;
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+}
+
+static void serve_connection(int fd, ScgiRequestHandler &handler)
+{
+    set_timeouts(fd);
+    ScriptVector vars;
+    if(!read_scgi_head(fd, vars)) {
+        static const char bad[] = "Status: 400 Bad Request\r\n\r\n";
+        write(fd, bad, sizeof(bad)-1);
+        return;
+    }
+    Cgi cgi;
+    cgi.SetRequest(vars, fd, fd);
+    handler.Handle(cgi);
+}
+
+
+/////////////////////////////////////////////////////////////////
+// the statistics, kept in memory shared by the supervisor and the workers
+
+    // the latency histogram's upper bounds, in microseconds; the last
+    // bucket is for everything longer
+static const long latency_bounds[] = {
+    100, 200, 500, 1000, 2000, 5000, 10000, 20000, 50000,
+    100000, 200000, 500000, 1000000
+};
+enum { latency_buckets = sizeof(latency_bounds)/sizeof(*latency_bounds) + 1 };
+
+    // a worker only updates the slot while it's the slot's current
+    // worker, so a retiring worker finishing its request doesn't spoil
+    // the figures of the one which replaces it; the supervisor is the
+    // only one to change pid and the restart counts
+struct WorkerSlot {
+    volatile int pid;             // 0 if there's no worker now
+    volatile int busy;
+    volatile long requests;       // served by the current worker
+    volatile long total;          // by all the slot's workers
+    volatile long long usec_total;
+    volatile long hist[latency_buckets];
+    volatile long counters[scgi_handler_counters];   // the handler's
+    int restarts, crashes;
+    time_t start_time, respawn_at;
+};
+
+static void note_request(WorkerSlot *slot, int pid, const struct timeval &t0,
+                         ScgiRequestHandler &handler)
+{
+    struct timeval t1;
+    gettimeofday(&t1, 0);
+    long long usec = (long long)(t1.tv_sec - t0.tv_sec) * 1000000 +
+                     (t1.tv_usec - t0.tv_usec);
+    long cnt[scgi_handler_counters];
+    int b;
+    for(b = 0; b < scgi_handler_counters; b++)
+        cnt[b] = 0;
+    handler.TakeCounters(cnt);
+    if(!slot || slot->pid != pid)
+        return;
+    for(b = 0; b < scgi_handler_counters; b++)
+        slot->counters[b] += cnt[b];
+    for(b = 0; b < latency_buckets-1 && usec >= latency_bounds[b]; b++)
+        {}
+    slot->hist[b]++;
+    slot->usec_total += usec;
+    slot->requests++;
+    slot->total++;
+    slot->busy = 0;
+}
+
+static void add_hist_line(ScriptVariable &res, const char *title,
+                          const volatile long *hist)
+{
+    res += ScriptVariable(0, "%5s", title);
+    int b;
+    for(b = 0; b < latency_buckets; b++)
+        res += ScriptVariable(0, " %7ld", hist[b]);
+    res += "\n";
+}
+
+static ScriptVariable make_status_report(const WorkerSlot *slots, int n,
+                                         time_t start_time)
+{
+    long total = 0, busy = 0, restarts = 0, crashes = 0;
+    long sum[latency_buckets];
+    int i, b;
+    for(b = 0; b < latency_buckets; b++)
+        sum[b] = 0;
+    for(i = 0; i < n; i++) {
+        total += slots[i].total;
+        busy += slots[i].busy;
+        restarts += slots[i].restarts;
+        crashes += slots[i].crashes;
+        for(b = 0; b < latency_buckets; b++)
+            sum[b] += slots[i].hist[b];
+    }
+    ScriptVariable res(0, "workers: %d (%ld busy), up %ld s, requests: %ld, "
+                          "restarts: %ld, crashes: %ld\n\n",
+                       n, busy, (long)(time(0) - start_time), total,
+                       restarts, crashes);
+    res += " slot     pid busy  current    total restarts crashes  avg,ms\n";
+    for(i = 0; i < n; i++) {
+        const WorkerSlot &s = slots[i];
+        double avg = s.total > 0 ? s.usec_total / 1000.0 / s.total : 0;
+        res += ScriptVariable(0, "%5d %7d %4d %8ld %8ld %8d %7d %7.3f\n",
+                              i, s.pid, s.busy, s.requests, s.total,
+                              s.restarts, s.crashes, avg);
+    }
+    res += "\nlatency, ms:\n slot";
+    for(b = 0; b < latency_buckets-1; b++)
+        res += ScriptVariable(0, " %7s",
+            (ScriptVariable("<") +
+             ScriptVariable(0, "%g", latency_bounds[b] / 1000.0)).c_str());
+    res += ScriptVariable(0, " %7s\n",
+        (ScriptVariable(">=") +
+         ScriptVariable(0, "%g", latency_bounds[b-1] / 1000.0)).c_str());
+    for(i = 0; i < n; i++)
+        add_hist_line(res, ScriptNumber(i).c_str(), slots[i].hist);
+    add_hist_line(res, "all", sum);
+    return res;
+}
+
+static void send_status(int statfd, const WorkerSlot *slots, int n,
+                        time_t start_time, ScgiRequestHandler &handler)
+{
+    int fd = accept(statfd, 0, 0);
+    if(fd == -1)
+        return;
+    set_timeouts(fd);
+    ScriptVariable rep = make_status_report(slots, n, start_time);
+    long cnt[scgi_handler_counters];
+    int i, b;
+    for(b = 0; b < scgi_handler_counters; b++) {
+        cnt[b] = 0;
+        for(i = 0; i < n; i++)
+            cnt[b] += slots[i].counters[b];
+    }
+    ScriptVariable more = handler.StatusReport(cnt);
+    if(more.IsValid() && more != "")
+        rep += ScriptVariable("\n") + more;
+    const char *p = rep.c_str();
+    int len = rep.Length();
+    while(len > 0) {
+        int rc = write(fd, p, len);
+        if(rc < 1)
+            break;
+        p += rc;
+        len -= rc;
+    }
+    close(fd);
+}
+
+
+/////////////////////////////////////////////////////////////////
+// signals
+
+static volatile sig_atomic_t stop_requested = 0;
+static volatile sig_atomic_t reload_requested = 0;
+
+static void stop_handler(int)
+{
+    stop_requested = 1;
+}
+
+static void reload_handler(int)
+{
+    reload_requested = 1;
+}
+
+static void child_handler(int)
+{
+    // nothing to do, the point is to break poll
+}
+
+    // SA_RESTART is set, so the request being served isn't broken by the
+    // signal (poll is broken anyway, so we don't stay in it)
+static void set_worker_signals()
+{
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = SIG_IGN;
+    sigaction(SIGPIPE, &sa, 0);
+    sigaction(SIGHUP, &sa, 0);     // it's for the supervisor
+    sa.sa_handler = SIG_DFL;
+    sigaction(SIGCHLD, &sa, 0);
+    sa.sa_handler = stop_handler;
+    sa.sa_flags = SA_RESTART;
+    sigaction(SIGTERM, &sa, 0);
+    sigaction(SIGINT, &sa, 0);
+}
+
+static void set_supervisor_signals()
+{
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = SIG_IGN;
+    sigaction(SIGPIPE, &sa, 0);
+    sa.sa_handler = stop_handler;
+    sigaction(SIGTERM, &sa, 0);
+    sigaction(SIGINT, &sa, 0);
+    sa.sa_handler = reload_handler;
+    sigaction(SIGHUP, &sa, 0);
+    sa.sa_handler = child_handler;
+    sigaction(SIGCHLD, &sa, 0);
+}
+
+
+/////////////////////////////////////////////////////////////////
+// workers
+
+    // serves requests until stopped or (if the slot is given) until
+    // max_requests are served
+static void worker_main(int ls, WorkerSlot *slot, int max_requests,
+                        ScgiRequestHandler &handler)
+{
+    int mypid = getpid();
+    while(!stop_requested) {
+        if(slot && max_requests > 0 && slot->requests >= max_requests)
+            break;
+        struct pollfd pfd;
+        pfd.fd = ls;
+        pfd.events = POLLIN;
+        int rc = poll(&pfd, 1, -1);
+        if(rc == -1) {
+            if(errno == EINTR)
+                continue;
+            perror("poll");
+            break;
+        }
+            // the listening socket is non-blocking, as another worker
+            // may take the connection first
+        int fd = accept(ls, 0, 0);
+        if(fd == -1) {
+            if(errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR ||
+                errno == ECONNABORTED)
+            {
+                continue;
+            }
+            perror("accept");
+            break;
+        }
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_NONBLOCK);
+            // the commands we run must not keep the connection open
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+        struct timeval t0;
+        gettimeofday(&t0, 0);
+        if(slot && slot->pid == mypid)
+            slot->busy = 1;
+        serve_connection(fd, handler);
+        close(fd);
+        note_request(slot, mypid, t0, handler);
+    }
+}
+
+struct Supervisor {
+    int ls, statfd;
+    const ScgiServerOptions *opts;
+    ScgiRequestHandler *handler;
+    WorkerSlot *slots;
+    int *retiring;        // the workers replaced on SIGHUP
+    int retiring_count;
+    time_t start_time;
+};
+
+static void start_worker(Supervisor &sv, int idx)
+{
+    WorkerSlot &slot = sv.slots[idx];
+    fflush(0);   // don't let the child flush our buffers once again
+    int pid = fork();
+    if(pid == -1) {
+        perror("fork");
+        slot.respawn_at = time(0) + 1;
+        return;
+    }
+    if(pid == 0) {   // child
+        if(sv.statfd != -1)
+            close(sv.statfd);
+        stop_requested = 0;
+        reload_requested = 0;
+        set_worker_signals();
+        slot.pid = getpid();
+        slot.requests = 0;
+        slot.busy = 0;
+        sv.handler->WorkerStarted();
+        worker_main(sv.ls, &slot, sv.opts->max_requests, *sv.handler);
+        fflush(0);
+        _exit(0);
+    }
+    slot.pid = pid;
+    slot.start_time = time(0);
+    slot.respawn_at = 0;
+}
+
+static void reap_workers(Supervisor &sv)
+{
+    int pid, status;
+    while((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+        bool known = false;
+        int i;
+        for(i = 0; i < sv.retiring_count; i++) {
+            if(sv.retiring[i] == pid) {
+                sv.retiring[i] = sv.retiring[--sv.retiring_count];
+                known = true;
+                break;
+            }
+        }
+        for(i = 0; i < sv.opts->workers; i++) {
+            WorkerSlot &slot = sv.slots[i];
+            if(slot.pid != pid)
+                continue;
+            known = true;
+            slot.pid = 0;
+            slot.busy = 0;
+            slot.restarts++;
+            if(WIFEXITED(status) && WEXITSTATUS(status) == 0)
+                break;    // served its max_requests
+            slot.crashes++;
+            if(WIFSIGNALED(status))
+                fprintf(stderr, "worker %d (pid %d) killed by signal %d\n",
+                        i, pid, WTERMSIG(status));
+            else
+                fprintf(stderr, "worker %d (pid %d) exited with code %d\n",
+                        i, pid, WEXITSTATUS(status));
+                // don't restart a worker crashing right away too often
+            if(time(0) - slot.start_time < 1)
+                slot.respawn_at = time(0) + 1;
+            break;
+        }
+        if(!known)   // one of the handler's
+            sv.handler->ChildExited(pid, status);
+    }
+}
+
+static void replace_workers(Supervisor &sv)
+{
+    sv.handler->Reload();
+    int i;
+    for(i = 0; i < sv.opts->workers; i++) {
+        WorkerSlot &slot = sv.slots[i];
+        if(slot.pid) {
+            kill(slot.pid, SIGTERM);
+            sv.retiring[sv.retiring_count++] = slot.pid;
+            slot.pid = 0;
+            slot.busy = 0;
+        }
+        start_worker(sv, i);
+    }
+}
+
+static void stop_workers(Supervisor &sv)
+{
+    int i;
+    for(i = 0; i < sv.opts->workers; i++)
+        if(sv.slots[i].pid)
+            kill(sv.slots[i].pid, SIGTERM);
+    for(i = 0; i < sv.retiring_count; i++)
+        kill(sv.retiring[i], SIGTERM);
+    sv.handler->Stopping();
+    int status;
+    while(wait(&status) > 0 || errno == EINTR)
+        {}
+}
+
+static void supervise(Supervisor &sv)
+{
+    int n = sv.opts->workers;
+    int i;
+    for(i = 0; i < n; i++)
+        start_worker(sv, i);
+    time_t last_tick = 0;
+    while(!stop_requested) {
+        struct pollfd pfd;
+        pfd.fd = sv.statfd;
+        pfd.events = POLLIN;
+            // the timeout is for the signals which come between the
+            // checks below and the poll call
+        int rc = poll(&pfd, sv.statfd != -1 ? 1 : 0, 1000);
+        if(rc == -1 && errno != EINTR) {
+            perror("poll");
+            break;
+        }
+        reap_workers(sv);
+            // if the workers replaced by the previous SIGHUP are still
+            // running, the reload waits for them to exit
+        if(reload_requested && sv.retiring_count <= n) {
+            reload_requested = 0;
+            fprintf(stderr, "SIGHUP: replacing the workers\n");
+            replace_workers(sv);
+        }
+        time_t now = time(0);
+        for(i = 0; i < n; i++)
+            if(!sv.slots[i].pid && sv.slots[i].respawn_at <= now)
+                start_worker(sv, i);
+        if(now != last_tick) {
+            last_tick = now;
+            sv.handler->Tick();
+        }
+        if(rc > 0 && (pfd.revents & POLLIN))
+            send_status(sv.statfd, sv.slots, n, sv.start_time, *sv.handler);
+    }
+    stop_workers(sv);
+}
+
+int run_scgi_server(const ScriptVariable &socket_path,
+                    const ScgiServerOptions &opts,
+                    ScgiRequestHandler &handler)
+{
+    int ls = unix_socket_listen(socket_path);
+    if(ls == -1)
+        return 2;
+    fcntl(ls, F_SETFL, fcntl(ls, F_GETFL) | O_NONBLOCK);
+
+    if(opts.workers < 1) {
+        set_worker_signals();
+        handler.Reload();
+        handler.WorkerStarted();
+        worker_main(ls, 0, 0, handler);
+        close(ls);
+        unlink(socket_path.c_str());
+        return 0;
+    }
+
+    Supervisor sv;
+    sv.ls = ls;
+    sv.statfd = -1;
+    if(opts.status_socket.IsValid()) {
+        sv.statfd = unix_socket_listen(opts.status_socket);
+        if(sv.statfd == -1) {
+            close(ls);
+            unlink(socket_path.c_str());
+            return 2;
+        }
+    }
+    void *shm = mmap(0, opts.workers * sizeof(WorkerSlot),
+                     PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+    if(shm == MAP_FAILED) {
+        perror("mmap");
+        return 2;
+    }
+    sv.slots = (WorkerSlot*)shm;
+    memset(shm, 0, opts.workers * sizeof(WorkerSlot));
+    sv.opts = &opts;
+    sv.handler = &handler;
+    sv.retiring = new int[2 * opts.workers];
+    sv.retiring_count = 0;
+    sv.start_time = time(0);
+
+    set_supervisor_signals();
+    handler.Reload();
+    supervise(sv);
+
+    delete[] sv.retiring;
+    munmap(shm, opts.workers * sizeof(WorkerSlot));
+    close(ls);
+    unlink(socket_path.c_str());
+    if(sv.statfd != -1) {
+        close(sv.statfd);
+        unlink(opts.status_socket.c_str());
+    }
+    return 0;
+}
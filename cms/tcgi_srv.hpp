@@ -0,0 +1,81 @@
+#ifndef TCGI_SRV_HPP_SENTRY
+#define TCGI_SRV_HPP_SENTRY
+
+#include <scriptpp/scrvar.hpp>
+
+class Cgi;
+
+/*
+    The persistent mode of thalcgi.cgi: rather than being started by the
+    web server for every request, the program runs as a daemon, listens
+    on a UNIX domain socket and receives the requests through it by the
+    SCGI protocol (see https://python.ca/scgi/protocol.txt); one
+    connection is one request.
+
+    For every request, the handler gets a Cgi object set up to take the
+    request's variables from the SCGI header rather than the environment,
+    to read the body from the connection and to send the response there.
+
+    The listening socket is opened once, then the given number of worker
+    processes are forked, all accepting connections on it; every worker
+    serves its requests one by one.  The main process (the supervisor)
+    doesn't serve requests: it restarts the workers which crash or exit
+    after serving max_requests requests, and on SIGHUP it calls Reload
+    and replaces all the workers, letting the old ones finish the
+    requests they are serving.  SIGTERM or SIGINT stops everything.
+
+    Every worker counts its requests and their latencies (and whatever
+    the handler counts, see TakeCounters) in memory shared with the
+    supervisor; if the status socket is given, the supervisor
+    listens on it and replies with a text report to every connection
+    (e.g., ``nc -U <status_socket>'').
+
+    With zero workers, the requests are served by the process itself, no
+    restarting, no reloading, no status, no Tick.
+ */
+
+    // the number of the counters a handler may keep (see TakeCounters)
+enum { scgi_handler_counters = 4 };
+
+class ScgiRequestHandler {
+public:
+    virtual ~ScgiRequestHandler() {}
+        // called before the workers are started, and then on SIGHUP,
+        // within the main process, so the workers inherit the results
+    virtual void Reload() {}
+        // called within every worker once it is started
+    virtual void WorkerStarted() {}
+    virtual void Handle(Cgi &cgi) = 0;
+        // called within the main process about once a second, for the
+        // housekeeping; the main process reaps all its children, so
+        // the handler must not wait for those it starts, it is told
+        // when they exit instead (status is as wait(2) gives it)
+    virtual void Tick() {}
+    virtual void ChildExited(int pid, int status) {}
+        // called within the main process when it stops, before it waits
+        // for all its children; the handler should stop the ones it has
+        // started
+    virtual void Stopping() {}
+        // called within a worker after every request; the handler adds
+        // to counters what it counted since the previous call, and the
+        // sums are kept in the memory shared with the main process
+    virtual void TakeCounters(long *counters) {}
+        // added to the end of the status report; counters are the sums
+        // of what TakeCounters gave, for all the workers
+    virtual ScriptVariable StatusReport(const long *counters)
+        { return ScriptVariable(""); }
+};
+
+struct ScgiServerOptions {
+    int workers;
+    int max_requests;               // zero means no limit
+    ScriptVariable status_socket;   // invalid means no status
+    ScgiServerOptions();   // the number of CPUs, 10000, no status
+};
+
+    // serves until SIGTERM or SIGINT; returns the exit code
+int run_scgi_server(const ScriptVariable &socket_path,
+                    const ScgiServerOptions &opts,
+                    ScgiRequestHandler &handler);
+
+#endif
@@ -0,0 +1,867 @@
+#include <stdio.h>    // for rename, tmpfile
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/file.h>
+#include <fcntl.h>
+#include <time.h>
+
+#include <scriptpp/confinfo.hpp>
+
+#include "fileops.hpp"
+
+#include "tcgi_sst.hpp"
+
+
+void SessionRecord::Clear()
+{
+    token.Invalidate();
+    old_token.Invalidate();
+    user.Invalidate();
+    logged_in = false;
+    created = expire = login_time = indexed_expire = 0;
+}
+
+
+/////////////////////////////////////////////////////////////////
+// the traditional store: a file per session
+//
+// Besides the session files, there's the expiration index: for every
+// session, an empty file named by the session id is kept within the
+// _expire/<N> subdirectory, where N is the number of the hour the
+// session expires within (that is, expire / SESSION_EXPIRE_BUCKET).
+// The cleanup takes the oldest hours that are entirely in the past
+// and removes the sessions listed there, at most the given number of
+// entries per call; the sessions that haven't expired are never even
+// looked at.  An entry may be stale (the session was renewed or
+// removed by other means), so the session file is checked before it
+// is removed.
+//
+// The session files made before the index existed are indexed by the
+// cleanup as well, by portions.  First, their names are listed into the
+// _expire/_todo file (this is only a readdir(3), and it is done once);
+// then every call reads at most the given number of the files, and the
+// position reached is kept in the _todo file's header.  Once the list
+// is over, the file is removed and _ready is made.
+
+#define SESS_SUBDIR "_sessions"
+#define EXPIRE_SUBDIR "_expire"
+#define EXPIRE_READY_FILENAME "_ready"
+#define EXPIRE_TODO_FILENAME "_todo"
+
+#define CLEANUP_LOCK_FILENAME "__cleanup_lock"
+#define CLEANUP_TIME_FILENAME "__next_cleanup"
+
+#ifndef SESSION_EXPIRE_BUCKET
+#define SESSION_EXPIRE_BUCKET 3600
+#endif
+
+class FileSessionStore : public SessionStore {
+    ScriptVariable dir;
+public:
+    FileSessionStore(const ScriptVariable &userdata_dir)
+        : dir(userdata_dir + "/" SESS_SUBDIR) {}
+    virtual bool Load(const ScriptVariable &id, SessionRecord &rec);
+    virtual bool Save(const ScriptVariable &id, SessionRecord &rec,
+                      bool creation);
+    virtual void Remove(const ScriptVariable &id);
+    virtual void Cleanup(long long now, int limit);
+private:
+    ScriptVariable BucketDir(long long expire) const;
+    void AddToIndex(const ScriptVariable &id, long long expire);
+    long long ExpireOf(const char *id) const;   // -1 if no valid file
+    bool ListOldSessions(const ScriptVariable &todo);
+    long long IndexOldSessions(long long now, int limit);
+    void MarkIndexReady();
+    long long CleanupBuckets(long long now, int limit);
+};
+
+static bool is_service_name(const char *s)
+{
+    return !*s || *s == '.' || *s == '_';
+}
+
+static long long get_time_item(const ConfigInformation &info, const char *nm)
+{
+    long long t;
+    ScriptVariable s = info.GetItem(nm);
+    if(s.IsInvalid() || !s.GetLongLong(t, 10))
+        return 0;
+    return t;
+}
+
+bool FileSessionStore::Load(const ScriptVariable &id, SessionRecord &rec)
+{
+    ConfigInformation info;
+    if(!info.FOpen((dir + "/" + id).c_str()))
+        return false;
+    bool rr = info.RunParser();
+    info.FClose();
+    if(!rr)
+        return false;
+
+    rec.token = info.GetItem("token");
+    rec.old_token = info.GetItem("oldtoken");
+    if(rec.old_token.IsInvalid())
+        rec.old_token = info.GetItem("old_token");
+    rec.user = info.GetItem("user");
+    ScriptVariable lgg = info.GetItem("logged_in");
+    lgg.Trim().Tolower();
+    rec.logged_in = lgg == "yes";
+    rec.created = get_time_item(info, "created");
+    rec.expire = get_time_item(info, "expire");
+    rec.login_time = get_time_item(info, "login_time");
+    rec.indexed_expire = rec.expire;
+    return true;
+}
+
+static void add_item(ScriptVariable &res, const char *name,
+                     const ScriptVariable &val)
+{
+    if(val.IsInvalid())
+        return;
+    res += name;
+    res += " = ";
+    res += val;
+    res += "\n\n";
+}
+
+static bool make_dir_if_necessary(const ScriptVariable &path)
+{
+    return mkdir(path.c_str(), 0700) != -1 || errno == EEXIST;
+}
+
+bool FileSessionStore::Save(const ScriptVariable &id,
+                            SessionRecord &rec, bool creation)
+{
+    ScriptVariable text("");
+    add_item(text, "token", rec.token);
+    add_item(text, "oldtoken", rec.old_token);
+    add_item(text, "created", ScriptNumber(rec.created));
+    add_item(text, "expire", ScriptNumber(rec.expire));
+    if(rec.user.IsValid()) {
+        add_item(text, "user", rec.user);
+        add_item(text, "logged_in", rec.logged_in ? "yes" : "no");
+    }
+    if(rec.login_time)
+        add_item(text, "login_time", ScriptNumber(rec.login_time));
+
+        // a brand new directory has no sessions made before the index
+    if(creation && mkdir(dir.c_str(), 0700) != -1)
+        MarkIndexReady();
+    ScriptVariable fname = dir + "/" + id;
+    int fd = open(fname.c_str(),
+                  creation ? O_WRONLY|O_CREAT|O_EXCL : O_WRONLY|O_TRUNC,
+                  0600);
+    if(fd == -1)
+        return false;
+    int wc = write(fd, text.c_str(), text.Length());
+    int cr = close(fd);
+    if(wc != text.Length() || cr == -1)
+        return false;
+
+        // renewals mostly stay within the same hour
+    long long oldb = rec.indexed_expire / SESSION_EXPIRE_BUCKET;
+    if(creation || oldb != rec.expire / SESSION_EXPIRE_BUCKET) {
+        AddToIndex(id, rec.expire);
+        if(!creation)
+            unlink((BucketDir(rec.indexed_expire) + "/" + id).c_str());
+    }
+    rec.indexed_expire = rec.expire;
+    return true;
+}
+
+void FileSessionStore::Remove(const ScriptVariable &id)
+{
+        // the index entry is left for the cleanup, which will find
+        // the file missing
+    unlink((dir + "/" + id).c_str());
+}
+
+ScriptVariable FileSessionStore::BucketDir(long long expire) const
+{
+    return dir + "/" EXPIRE_SUBDIR "/" +
+        ScriptNumber(expire / SESSION_EXPIRE_BUCKET);
+}
+
+void FileSessionStore::AddToIndex(const ScriptVariable &id, long long expire)
+{
+    ScriptVariable bdir = BucketDir(expire);
+    ScriptVariable fname = bdir + "/" + id;
+    int fd = open(fname.c_str(), O_WRONLY|O_CREAT, 0600);
+    if(fd == -1 && errno == ENOENT) {
+        make_dir_if_necessary(dir + "/" EXPIRE_SUBDIR);
+        make_dir_if_necessary(bdir);
+        fd = open(fname.c_str(), O_WRONLY|O_CREAT, 0600);
+    }
+    if(fd != -1)
+        close(fd);
+}
+
+long long FileSessionStore::ExpireOf(const char *id) const
+{
+    ConfigInformation info;
+    if(!info.FOpen((dir + "/" + id).c_str()))
+        return -1;
+    bool rr = info.RunParser();
+    info.FClose();
+    if(!rr)
+        return -1;
+    ScriptVariable expire = info.GetItem("expire");
+    long long et;
+    if(expire.IsInvalid() || !expire.GetLongLong(et, 10))
+        return -1;
+    return et;
+}
+
+static bool write_next_cleanup_time(const ScriptVariable &dir, long long tm)
+{
+    ScriptVariable fname = dir + "/" + CLEANUP_TIME_FILENAME;
+    ScriptVariable fname_tmp = fname + "." + ScriptNumber(getpid());
+    int fd = open(fname_tmp.c_str(), O_WRONLY|O_CREAT|O_EXCL, 0600);
+    if(fd == -1)
+        return false;
+    int wc = write(fd, &tm, sizeof(tm));
+    close(fd);
+    if(wc != sizeof(tm)) {
+        unlink(fname_tmp.c_str());
+        return false;
+    }
+    return -1 != rename(fname_tmp.c_str(), fname.c_str());
+}
+
+static long long get_next_cleanup_time(const ScriptVariable &dir)
+{
+    ScriptVariable fname = dir + "/" + CLEANUP_TIME_FILENAME;
+    int fd = open(fname.c_str(), O_RDONLY);
+    if(fd == -1)
+        return -1;
+    long long tm;
+    int rc;
+    rc = read(fd, &tm, sizeof(tm));
+    close(fd);
+    if(rc != sizeof(tm))
+        return -1;
+    return tm;
+}
+
+    // the header is the position (within the file) of the next name
+bool FileSessionStore::ListOldSessions(const ScriptVariable &todo)
+{
+    ScriptVariable tmpname = todo + "." + ScriptNumber(getpid());
+    FILE *f = fopen(tmpname.c_str(), "w");
+    if(!f)
+        return false;
+    long long pos = sizeof(pos);
+    bool ok = fwrite(&pos, sizeof(pos), 1, f) == 1;
+    const char *s;
+    ReadDir rd(dir.c_str());
+    while(ok && (s = rd.Next()))
+        if(!is_service_name(s))
+            ok = fprintf(f, "%s\n", s) > 0;
+    if(fclose(f) != 0)
+        ok = false;
+    if(!ok || rename(tmpname.c_str(), todo.c_str()) == -1) {
+        unlink(tmpname.c_str());
+        return false;
+    }
+    return true;
+}
+
+    // returns the time the next call has something to do
+long long FileSessionStore::IndexOldSessions(long long now, int limit)
+{
+    ScriptVariable todo = dir + "/" EXPIRE_SUBDIR "/" EXPIRE_TODO_FILENAME;
+    int fd = open(todo.c_str(), O_RDWR);
+    if(fd == -1) {
+        make_dir_if_necessary(dir + "/" EXPIRE_SUBDIR);
+        if(!ListOldSessions(todo))
+            return now + 60;    // don't retry on every request
+        fd = open(todo.c_str(), O_RDWR);
+        if(fd == -1)
+            return now + 60;
+    }
+    long long pos;
+    if(pread(fd, &pos, sizeof(pos), 0) != sizeof(pos)) {
+        close(fd);
+        unlink(todo.c_str());   // broken, let it be listed once again
+        return now;
+    }
+    int bufsize = limit * 257;    // enough for limit names (NAME_MAX+1)
+    char *buf = new char[bufsize];
+    int rc = pread(fd, buf, bufsize, pos);
+    if(rc <= 0) {
+        close(fd);
+        delete[] buf;
+        if(rc == 0) {
+            MarkIndexReady();
+            unlink(todo.c_str());
+        }
+        return now;
+    }
+    int start = 0, done = 0;
+    int i;
+    for(i = 0; i < rc && done < limit; i++) {
+        if(buf[i] != '\n')
+            continue;
+        buf[i] = 0;
+        const char *s = buf + start;
+        start = i + 1;
+        done++;
+        long long et = ExpireOf(s);
+        if(et == -1)
+            continue;    // removed since the list was made
+        if(et < now)
+            unlink((dir + "/" + s).c_str());
+        else
+            AddToIndex(s, et);
+    }
+    delete[] buf;
+    pos += start;
+    pwrite(fd, &pos, sizeof(pos), 0);
+    close(fd);
+    return now;
+}
+
+void FileSessionStore::MarkIndexReady()
+{
+    make_dir_if_necessary(dir + "/" EXPIRE_SUBDIR);
+    int fd = open((dir + "/" EXPIRE_SUBDIR "/" EXPIRE_READY_FILENAME).c_str(),
+                  O_WRONLY|O_CREAT, 0600);
+    if(fd != -1)
+        close(fd);
+}
+
+    // returns the time the next call has something to do
+long long FileSessionStore::CleanupBuckets(long long now, int limit)
+{
+    ScriptVariable idxdir = dir + "/" EXPIRE_SUBDIR;
+        // there's a bucket per hour of the session lifetime, so they
+        // are not too many
+    long long *buckets = 0;
+    int bcount = 0, balloc = 0;
+    const char *s;
+    ReadDir rd(idxdir.c_str());
+    while((s = rd.Next())) {
+        long long b;
+        if(is_service_name(s) || !ScriptVariable(s).GetLongLong(b, 10))
+            continue;
+        if(bcount >= balloc) {
+            balloc = balloc ? balloc * 2 : 64;
+            long long *tmp = new long long[balloc];
+            int i;
+            for(i = 0; i < bcount; i++)
+                tmp[i] = buckets[i];
+            delete[] buckets;
+            buckets = tmp;
+        }
+        buckets[bcount++] = b;
+    }
+
+    long long next = now + SESSION_EXPIRE_BUCKET;
+    int done = 0;
+    while(bcount > 0) {
+        int i, m = 0;
+        for(i = 1; i < bcount; i++)
+            if(buckets[i] < buckets[m])
+                m = i;
+        long long b = buckets[m];
+        if((b + 1) * SESSION_EXPIRE_BUCKET > now) {
+                // not entirely in the past, it will be by then
+            next = (b + 1) * SESSION_EXPIRE_BUCKET;
+            break;
+        }
+        if(done >= limit) {
+            next = now;
+            break;
+        }
+        ScriptVariable bdir = idxdir + "/" + ScriptNumber(b);
+        ReadDir brd(bdir.c_str());
+        while(done < limit && (s = brd.Next())) {
+            if(*s == '.')
+                continue;
+            long long et = ExpireOf(s);
+            if(et != -1 && et < now)
+                unlink((dir + "/" + s).c_str());
+            unlink((bdir + "/" + s).c_str());
+            done++;
+        }
+        if(done >= limit) {
+            next = now;
+            break;
+        }
+        rmdir(bdir.c_str());
+        buckets[m] = buckets[--bcount];
+    }
+    delete[] buckets;
+    return next;
+}
+
+void FileSessionStore::Cleanup(long long now, int limit)
+{
+        // most of the time we don't proceed because the time didn't come
+        // so this check is to be done first
+    long long tt = get_next_cleanup_time(dir);
+    if(tt != -1 && tt > now)
+        return;
+
+        // if someone else is doing this right now, let them
+    ScriptVariable lockfname = dir + "/" CLEANUP_LOCK_FILENAME;
+    int fd = open(lockfname.c_str(), O_WRONLY|O_CREAT, 0600);
+    if(fd == -1)
+        return;
+    if(flock(fd, LOCK_EX|LOCK_NB) == -1) {
+        close(fd);
+        return;
+    }
+
+    FileStat ready((dir + "/" EXPIRE_SUBDIR "/" EXPIRE_READY_FILENAME).c_str());
+    if(!ready.Exists())
+        tt = IndexOldSessions(now, limit);
+    else
+        tt = CleanupBuckets(now, limit);
+    write_next_cleanup_time(dir, tt);
+
+    close(fd);   // this releases the lock as well
+}
+
+
+/////////////////////////////////////////////////////////////////
+// the table: open addressing (linear probing) over a fixed number of
+// slots, plus a binary heap of the slot numbers ordered by expiration
+// time; every slot knows its position within the heap, so a renewed
+// session is moved within the heap in O(log n)
+
+#define SESSION_TABLE_FILENAME "_sessions.tab"
+#define SESSION_TABLE_MAGIC "ThSesTb1"
+
+enum {
+    sess_id_len = 16,
+    sess_token_len = 16,
+    session_table_default_size = 65536,
+    session_table_min_size = 64
+};
+
+struct SessionTableHeader {
+    char magic[8];
+    int slot_size;       // to detect files made by an incompatible build
+    int slot_count;
+    int used;            // which is the heap size as well
+    int reserved;
+};
+
+struct SessionTableSlot {
+    char id[sess_id_len+1];          // empty if the slot is free
+    char token[sess_token_len+1];
+    char old_token[sess_token_len+1];
+    char user[SESSION_TABLE_USER_LEN];
+    char logged_in;
+    int heap_pos;
+    long long created, expire, login_time;
+};
+
+class SessionTable : public SessionStore {
+    int fd;              // only for locking, if the table isn't in a file
+    void *map;
+    long long map_size;
+    SessionTableHeader *hdr;
+    SessionTableSlot *slots;
+    int *heap;
+public:
+    SessionTable() : fd(-1), map(0), map_size(0) {}
+    ~SessionTable();
+        // path invalid means the table is kept in (shared) memory
+    bool Open(const ScriptVariable &path, int size);
+
+    virtual bool Load(const ScriptVariable &id, SessionRecord &rec);
+    virtual bool Save(const ScriptVariable &id, SessionRecord &rec,
+                      bool creation);
+    virtual void Remove(const ScriptVariable &id);
+    virtual void Cleanup(long long now, int limit);
+    virtual bool CanKeepUser(const ScriptVariable &user) const
+        { return user.Length() < SESSION_TABLE_USER_LEN; }
+
+private:
+    void Lock(bool write);
+    void Unlock();
+    void SetMap(void *m, long long size);
+
+    unsigned int Home(const char *id) const;
+    int FindSlot(const char *id) const;   // -1 if not found
+    void RemoveAt(int idx);
+
+    void HeapSet(int pos, int idx);
+    bool Earlier(int pos1, int pos2) const;
+    void HeapFix(int pos);
+    void HeapInsert(int idx);
+    void HeapRemove(int pos);
+};
+
+static long long table_map_size(int slot_count)
+{
+    return sizeof(SessionTableHeader) +
+           (long long)slot_count * (sizeof(SessionTableSlot) + sizeof(int));
+}
+
+static void init_table_header(SessionTableHeader *h, int slot_count)
+{
+    memset(h, 0, sizeof(*h));
+    memcpy(h->magic, SESSION_TABLE_MAGIC, sizeof(h->magic));
+    h->slot_size = sizeof(SessionTableSlot);
+    h->slot_count = slot_count;
+    h->used = 0;
+}
+
+static bool table_header_ok(const SessionTableHeader &h)
+{
+    return 0 == memcmp(h.magic, SESSION_TABLE_MAGIC, sizeof(h.magic)) &&
+        h.slot_size == (int)sizeof(SessionTableSlot) &&
+        h.slot_count >= session_table_min_size &&
+        h.used >= 0 && h.used <= h.slot_count;
+}
+
+SessionTable::~SessionTable()
+{
+    if(map)
+        munmap(map, map_size);
+    if(fd != -1)
+        close(fd);
+}
+
+void SessionTable::SetMap(void *m, long long size)
+{
+    map = m;
+    map_size = size;
+    hdr = (SessionTableHeader*)m;
+    slots = (SessionTableSlot*)(hdr + 1);
+    heap = (int*)(slots + hdr->slot_count);
+}
+
+bool SessionTable::Open(const ScriptVariable &path, int size)
+{
+    if(size < session_table_min_size)
+        size = session_table_min_size;
+
+    if(path.IsInvalid()) {
+            // the lock needs a file, but nobody else needs its name
+        FILE *f = tmpfile();
+        if(!f) {
+            perror("tmpfile");
+            return false;
+        }
+        fd = dup(fileno(f));
+        fclose(f);
+        if(fd == -1)
+            return false;
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+        long long msz = table_map_size(size);
+        void *m = mmap(0, msz, PROT_READ|PROT_WRITE,
+                       MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+        if(m == MAP_FAILED) {
+            perror("mmap");
+            return false;
+        }
+        init_table_header((SessionTableHeader*)m, size);
+        SetMap(m, msz);
+        return true;
+    }
+
+    fd = open(path.c_str(), O_RDWR|O_CREAT, 0600);
+    if(fd == -1) {
+        perror(path.c_str());
+        return false;
+    }
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+    Lock(true);
+    SessionTableHeader h;
+    struct stat st;
+    bool stat_ok = fstat(fd, &st) != -1;
+    bool ok = stat_ok &&
+        st.st_size >= (off_t)sizeof(h) &&
+        pread(fd, &h, sizeof(h), 0) == sizeof(h) &&
+        table_header_ok(h) &&
+        st.st_size >= table_map_size(h.slot_count);
+    if(!ok) {
+        if(stat_ok && st.st_size > 0)
+            fprintf(stderr, "%s: not a session table, recreated\n",
+                    path.c_str());
+        init_table_header(&h, size);
+        ok = ftruncate(fd, 0) != -1 &&
+            ftruncate(fd, table_map_size(size)) != -1 &&
+            pwrite(fd, &h, sizeof(h), 0) == sizeof(h);
+        if(!ok) {
+            perror(path.c_str());
+            Unlock();
+            return false;
+        }
+    }
+    long long msz = table_map_size(h.slot_count);
+    void *m = mmap(0, msz, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    Unlock();
+    if(m == MAP_FAILED) {
+        perror("mmap");
+        return false;
+    }
+    SetMap(m, msz);
+    return true;
+}
+
+void SessionTable::Lock(bool write)
+{
+    struct flock fl;
+    memset(&fl, 0, sizeof(fl));
+    fl.l_type = write ? F_WRLCK : F_RDLCK;
+    fl.l_whence = SEEK_SET;
+    fl.l_start = 0;
+    fl.l_len = 0;
+    while(fcntl(fd, F_SETLKW, &fl) == -1 && errno == EINTR)
+        {}
+}
+
+void SessionTable::Unlock()
+{
+    struct flock fl;
+    memset(&fl, 0, sizeof(fl));
+    fl.l_type = F_UNLCK;
+    fl.l_whence = SEEK_SET;
+    fcntl(fd, F_SETLK, &fl);
+}
+
+    // the ids are random, but the table file may be edited by someone
+    // not so nice, so we don't just take their bits
+unsigned int SessionTable::Home(const char *id) const
+{
+    unsigned int h = 2166136261u;
+    for(; *id; id++) {
+        h ^= (unsigned char)*id;
+        h *= 16777619u;
+    }
+    return h % (unsigned int)hdr->slot_count;
+}
+
+int SessionTable::FindSlot(const char *id) const
+{
+    int n = hdr->slot_count;
+    int i = Home(id);
+        // the table is never full, so there's a free slot to stop at
+    while(slots[i].id[0]) {
+        if(0 == strcmp(slots[i].id, id))
+            return i;
+        i = (i + 1) % n;
+    }
+    return -1;
+}
+
+    // the slots after the removed one are shifted back, so that no
+    // ``deleted'' marks are needed and the lookups stay short
+void SessionTable::RemoveAt(int idx)
+{
+    HeapRemove(slots[idx].heap_pos);
+    slots[idx].id[0] = 0;
+    int n = hdr->slot_count;
+    int j = idx;
+    for(;;) {
+        j = (j + 1) % n;
+        if(!slots[j].id[0])
+            break;
+        int k = Home(slots[j].id);
+            // leave the entry if its home is cyclically within (idx, j]
+        if(idx <= j ? (idx < k && k <= j) : (idx < k || k <= j))
+            continue;
+        slots[idx] = slots[j];
+        heap[slots[idx].heap_pos] = idx;
+        slots[j].id[0] = 0;
+        idx = j;
+    }
+}
+
+void SessionTable::HeapSet(int pos, int idx)
+{
+    heap[pos] = idx;
+    slots[idx].heap_pos = pos;
+}
+
+bool SessionTable::Earlier(int pos1, int pos2) const
+{
+    return slots[heap[pos1]].expire < slots[heap[pos2]].expire;
+}
+
+void SessionTable::HeapFix(int pos)
+{
+    while(pos > 0 && Earlier(pos, (pos-1)/2)) {
+        int parent = (pos-1)/2;
+        int tmp = heap[parent];
+        HeapSet(parent, heap[pos]);
+        HeapSet(pos, tmp);
+        pos = parent;
+    }
+    int count = hdr->used;
+    for(;;) {
+        int least = pos;
+        int c = 2*pos + 1;
+        if(c < count && Earlier(c, least))
+            least = c;
+        if(c + 1 < count && Earlier(c + 1, least))
+            least = c + 1;
+        if(least == pos)
+            break;
+        int tmp = heap[least];
+        HeapSet(least, heap[pos]);
+        HeapSet(pos, tmp);
+        pos = least;
+    }
+}
+
+void SessionTable::HeapInsert(int idx)
+{
+    int pos = hdr->used;
+    hdr->used++;
+    HeapSet(pos, idx);
+    HeapFix(pos);
+}
+
+void SessionTable::HeapRemove(int pos)
+{
+    hdr->used--;
+    if(pos == hdr->used)
+        return;
+    HeapSet(pos, heap[hdr->used]);
+    HeapFix(pos);
+}
+
+static bool sess_id_fits(const ScriptVariable &id)
+{
+    return id.IsValid() && id.Length() > 0 && id.Length() <= sess_id_len;
+}
+
+static void put_str(char *dest, int size, const ScriptVariable &s)
+{
+    memset(dest, 0, size);
+    if(s.IsValid())
+        strncpy(dest, s.c_str(), size - 1);
+}
+
+bool SessionTable::Load(const ScriptVariable &id, SessionRecord &rec)
+{
+    if(!sess_id_fits(id))
+        return false;
+    Lock(false);
+    int i = FindSlot(id.c_str());
+    if(i != -1) {
+        const SessionTableSlot &s = slots[i];
+        rec.token = s.token;
+        rec.old_token = s.old_token;
+        if(s.user[0])
+            rec.user = s.user;
+        else
+            rec.user.Invalidate();
+        rec.logged_in = s.logged_in;
+        rec.created = s.created;
+        rec.expire = s.expire;
+        rec.login_time = s.login_time;
+    }
+    Unlock();
+    return i != -1;
+}
+
+bool SessionTable::Save(const ScriptVariable &id, SessionRecord &rec,
+                        bool creation)
+{
+    if(!sess_id_fits(id) ||
+        (rec.token.IsValid() && rec.token.Length() > sess_token_len) ||
+        (rec.old_token.IsValid() && rec.old_token.Length() > sess_token_len) ||
+        (rec.user.IsValid() && !CanKeepUser(rec.user)))
+    {
+        return false;
+    }
+    Lock(true);
+    int i = FindSlot(id.c_str());
+    if((i != -1) == creation) {   // exists when created, or vice versa
+        Unlock();
+        return false;
+    }
+    if(creation) {
+        int n = hdr->slot_count;
+        if(hdr->used >= n - n / 8)
+            RemoveAt(heap[0]);      // the one to expire first
+        i = Home(id.c_str());
+        while(slots[i].id[0])
+            i = (i + 1) % n;
+        put_str(slots[i].id, sizeof(slots[i].id), id);
+    }
+    SessionTableSlot &s = slots[i];
+    put_str(s.token, sizeof(s.token), rec.token);
+    put_str(s.old_token, sizeof(s.old_token), rec.old_token);
+    put_str(s.user, sizeof(s.user), rec.user);
+    s.logged_in = rec.logged_in;
+    s.created = rec.created;
+    s.expire = rec.expire;
+    s.login_time = rec.login_time;
+    if(creation)
+        HeapInsert(i);
+    else
+        HeapFix(s.heap_pos);
+    Unlock();
+    return true;
+}
+
+void SessionTable::Remove(const ScriptVariable &id)
+{
+    if(!sess_id_fits(id))
+        return;
+    Lock(true);
+    int i = FindSlot(id.c_str());
+    if(i != -1)
+        RemoveAt(i);
+    Unlock();
+}
+
+void SessionTable::Cleanup(long long now, int limit)
+{
+        // this is done for every request, and mostly there's nothing
+        // to remove, so the exclusive lock is only taken if there is
+    Lock(false);
+    bool expired = hdr->used > 0 && slots[heap[0]].expire < now;
+    Unlock();
+    if(!expired)
+        return;
+    Lock(true);
+    int done;
+    for(done = 0; done < limit && hdr->used > 0; done++) {
+        if(slots[heap[0]].expire >= now)
+            break;
+        RemoveAt(heap[0]);
+    }
+    Unlock();
+}
+
+
+/////////////////////////////////////////////////////////////////
+
+SessionStore *make_session_store(const ScriptVariable &kind,
+                                 const ScriptVariable &userdata_dir,
+                                 int table_size, bool persistent)
+{
+    if(kind.IsInvalid() || kind == "" || kind == "files")
+        return new FileSessionStore(userdata_dir);
+    if(kind != "table" && kind != "memory") {
+        fprintf(stderr, "unknown session_store: %s\n", kind.c_str());
+        return 0;
+    }
+    if(table_size <= 0)
+        table_size = session_table_default_size;
+    SessionTable *t = new SessionTable;
+    bool ok;
+    if(kind == "memory" && persistent)
+        ok = t->Open(ScriptVariableInv(), table_size);
+    else
+        ok = t->Open(userdata_dir + "/" SESSION_TABLE_FILENAME, table_size);
+    if(!ok) {
+        delete t;
+        return 0;
+    }
+    return t;
+}
@@ -0,0 +1,84 @@
+#ifndef TCGI_SST_HPP_SENTRY
+#define TCGI_SST_HPP_SENTRY
+
+#include <scriptpp/scrvar.hpp>
+
+/*
+    Session stores.  A session is identified by a 16-char id (the
+    persistent part of the cookie); the store keeps the session's
+    current and previous tokens, its expiration time and the user it
+    belongs to.  SessionData (see tcgi_ses.hpp) knows nothing about how
+    the sessions are kept, it only loads and saves SessionRecords.
+
+    The stores are selected by [general] session_store:
+
+      files   one text file per session within the _sessions subdir of
+              the userdata dir (the traditional way, the default), plus
+              an index of empty files grouped by the hour the sessions
+              expire within;
+      table   one file (_sessions.tab within the userdata dir) holding
+              a fixed number of slots (session_table_size, 65536 by
+              default), mmap'ed and looked up by the id's hash, plus
+              an index ordered by expiration time;
+      memory  the same table kept in shared memory; it lives as long as
+              the persistent process (see tcgi_srv.hpp) and is shared by
+              its workers; in the CGI mode, it is the same as ``table''.
+
+    With both indices, the cleanup only touches the sessions it removes,
+    and it is done by small portions, so that no request waits for
+    all of the expired sessions to be removed.
+
+    The table can't grow: once it is 7/8 full, the session to expire
+    first is dropped to make room for a new one.  The number of slots is
+    only used when the table file is created; to change it, remove the
+    file (all sessions will be lost).  Users with names longer than
+    SESSION_TABLE_USER_LEN-1 chars can't log in with the table stores.
+
+    The table is accessed by several processes at once, under fcntl(2)
+    locks; they are owned by processes rather than descriptors, so a
+    table opened before fork(2) remains properly locked in the children.
+ */
+
+struct SessionRecord {
+    ScriptVariable token, old_token;
+    ScriptVariable user;      // invalid if none
+    bool logged_in;
+    long long created, expire, login_time;   // login_time is 0 if none
+        // the expiration time the store's index knows for the session,
+        // maintained by the store's Load and Save
+    long long indexed_expire;
+
+    SessionRecord() { Clear(); }
+    void Clear();
+};
+
+class SessionStore {
+public:
+    virtual ~SessionStore() {}
+        // false if there's no such session
+    virtual bool Load(const ScriptVariable &id, SessionRecord &rec) = 0;
+        // with creation, fails if the session already exists
+    virtual bool Save(const ScriptVariable &id, SessionRecord &rec,
+                      bool creation) = 0;
+    virtual void Remove(const ScriptVariable &id) = 0;
+        // removes at most limit expired sessions, the oldest first; it
+        // is meant to be called for every request, so it returns at
+        // once if there's nothing to do
+    virtual void Cleanup(long long now, int limit) = 0;
+        // false if the user's sessions can't be kept here (see below)
+    virtual bool CanKeepUser(const ScriptVariable &user) const
+        { return true; }
+};
+
+#ifndef SESSION_TABLE_USER_LEN
+#define SESSION_TABLE_USER_LEN 40
+#endif
+
+    // kind is the session_store value; persistent means the process
+    // serves many requests; returns 0 for an unknown kind or if the
+    // table can't be opened (the diagnostics go to stderr)
+SessionStore *make_session_store(const ScriptVariable &kind,
+                                 const ScriptVariable &userdata_dir,
+                                 int table_size, bool persistent);
+
+#endif
@@ -0,0 +1,8 @@
+#include "textsink.hpp"
+
+
+void FileTextSink::Put(const ScriptVariable &s)
+{
+    if(s.IsValid())
+        fwrite(s.c_str(), 1, s.Length(), stream);
+}
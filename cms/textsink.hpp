@@ -0,0 +1,28 @@
+#ifndef TEXTSINK_HPP_SENTRY
+#define TEXTSINK_HPP_SENTRY
+
+#include <stdio.h>
+
+#include <scriptpp/scrvar.hpp>
+
+/*
+    TextSink receives the generated text piece by piece, so that a page
+    (e.g., one with thousands of comments) doesn't have to be built in
+    memory as a whole before it is written out.
+    Invalidated strings are silently ignored.
+ */
+class TextSink {
+public:
+    virtual ~TextSink() {}
+    virtual void Put(const ScriptVariable &s) = 0;
+};
+
+    // the text goes right to the (buffered) stream, which is not owned
+class FileTextSink : public TextSink {
+    FILE *stream;
+public:
+    FileTextSink(FILE *f) : stream(f) {}
+    virtual void Put(const ScriptVariable &s);
+};
+
+#endif
@@ -8,6 +8,7 @@
 #include "main_gen.hpp"
 #include "main_lst.hpp"
 #include "main_upd.hpp"
+#include "main_srv.hpp"
 
 
 
@@ -61,6 +62,9 @@ static void help(const char *subcommand, FILE *stream)
         else
         if(sc == "inspect")
             help_inspect(stream);
+        else
+        if(sc == "serve")
+            help_serve(stream);
         else
             fprintf(stderr, "unknown subcommand ``%s''\n", subcommand);
         return;
@@ -81,6 +85,7 @@ static void help(const char *subcommand, FILE *stream)
                                                  "(PARTIALLY IMPLEMENTED)\n"
         "    update       update a page or comment file\n"
         "    inspect      show a page or comment file's content\n"
+        "    serve        run the resident generation server\n"
         "\n"
         "Try    thalassa help <command> (e.g. thalassa help gen) for\n"
         "command-specific help text\n"
@@ -224,6 +229,8 @@ int main(int argc, const char *const *argv)
         return perform_update(cmdc, argc - used_args, argv + used_args);
     if(cmdc.command == "inspect")
         return perform_inspect(cmdc, argc - used_args, argv + used_args);
+    if(cmdc.command == "serve")
+        return perform_serve(cmdc, argc - used_args, argv + used_args);
 
 
     fprintf(stderr, "unknown command ``%s''\n\n", argv[1]);
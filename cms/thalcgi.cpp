@@ -1,9 +1,12 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
 #include <fcntl.h>
+#include <signal.h>
 #include <unistd.h>
 
 #include <scriptpp/scrvar.hpp>
@@ -20,6 +23,8 @@
 #include "invoke.h"
 #include "emailval.h"
 #include "fnchecks.h"
+#include "fileops.hpp"
+#include "tcgi_srv.hpp"
 
 #ifndef THALASSA_CGI_CONFIG_PATH
 #define THALASSA_CGI_CONFIG_PATH "thalcgi.ini"
@@ -27,6 +32,16 @@
 
 #ifndef THALASSA_CGI_SESSION_TTL
 #define THALASSA_CGI_SESSION_TTL (2*24*3600)
+#endif
+
+    // expired sessions removed per request at most
+#ifndef THALASSA_CGI_SESSION_CLEANUP_BATCH
+#define THALASSA_CGI_SESSION_CLEANUP_BATCH 20
+#endif
+
+    // if a captcha pool filler made nothing, seconds before the next one
+#ifndef THALASSA_CGI_CAPTCHA_POOL_RETRY
+#define THALASSA_CGI_CAPTCHA_POOL_RETRY 30
 #endif
 
 #ifndef THALASSA_CGI_SESSID_COOKIE
@@ -141,11 +156,6 @@ static void process_set_cookie_request(Cgi &cgi, const ThalassaCgiDb &db,
 
     bool ok = sess.Create(THALASSA_CGI_SESSION_TTL);
     if(ok) {
-            // It is definitely unneeded to perform MORE cleanup scans
-            // than we set cookies.
-            // So, this is THE place we do it
-        sess.PerformCleanup(THALASSA_CGI_SESSION_TTL);
-
             // send that 'cookie set' message to the user
         send_result_page(cgi, db, page, sess, "cookie_set", true);
     } else {
@@ -463,12 +473,76 @@ static void process_send_email(Cgi &cgi, const ThalassaCgiDb &db,
                      ok ? "your_email_sent" : "error_sending_email", ok);
 }
 
+    // a spooled target older than this (in seconds) is considered lost,
+    // that is, the generator which had to process it is not going to
+#ifndef THALASSA_CGI_REGEN_SPOOL_STALE
+#define THALASSA_CGI_REGEN_SPOOL_STALE 120
+#endif
+
+    // target specs are like "set=blog=p001", each part must be a safe
+    // file name, because the whole thing is a file name in the spool
+static bool regen_target_safe(const ScriptVariable &t)
+{
+    ScriptTokenVector parts(t, "=");
+    if(parts.Length() < 1 || parts.Length() > 3)
+        return false;
+    int i;
+    for(i = 0; i < parts.Length(); i++)
+        if(!check_fname_safe(parts[i].c_str()))
+            return false;
+    return true;
+}
+
+    // returns true if the generator must be launched, that is, at least
+    // one target wasn't in the spool yet (or was there for too long);
+    // the spool format is the same ``thalassa gen -s'' uses
+static bool spool_regen_targets(const ScriptVariable &spooldir,
+                                const ScriptVector &targets)
+{
+    ScriptVariable fingerprint =
+        ScriptNumber(time(0)) + "=" + ScriptNumber(getpid()) + "\n";
+    bool need_launch = false;
+    make_directory_path(spooldir.c_str(), 0);
+    int i;
+    for(i = 0; i < targets.Length(); i++) {
+        if(!regen_target_safe(targets[i]))
+            continue;
+        ScriptVariable fname = spooldir + "/" + targets[i];
+        int fd = open(fname.c_str(), O_WRONLY|O_CREAT|O_EXCL, 0666);
+        if(fd == -1) {
+            struct stat st;
+            if(stat(fname.c_str(), &st) != -1 &&
+                st.st_mtime + THALASSA_CGI_REGEN_SPOOL_STALE < time(0))
+            {
+                need_launch = true;
+            }
+            continue;   // it is already pending, so coalesced
+        }
+        write(fd, fingerprint.c_str(), fingerprint.Length());
+        close(fd);
+        need_launch = true;
+    }
+    return need_launch;
+}
+
 static bool run_regeneration(const ThalassaCgiDb &db)
 {
     ScriptVector command;
     bool ok = db.MakeCommentPageRegenCmd(command);
     if(!ok)
         return false;
+
+    ScriptVariable spooldir;
+    ScriptVector targets;
+    if(db.GetCommentPageRegenSpool(spooldir, targets)) {
+        if(!spool_regen_targets(spooldir, targets))
+            return true;   // the generator will get to them anyway
+        char **argv = command.MakeArgv();
+        int res = invoke_command_detached(argv);
+        ScriptVector::DeleteArgv(argv);
+        return res == 0;
+    }
+
     char **argv = command.MakeArgv();
     int res = invoke_command(argv, "", 0);
     ScriptVector::DeleteArgv(argv);
@@ -891,12 +965,22 @@ static void process_get_request(Cgi &cgi, const ThalassaCgiDb &db,
 // the main function infrastructure
 
 
-static void captcha_setup(ThalassaCgiDb &db)
+    // returns the captcha pool size, 0 if there's no pool
+static int captcha_setup(ThalassaCgiDb &db)
 {
     ScriptVariable secret;
     int time_to_live;
     db.GetCaptchaParameters(secret, time_to_live);
     set_captcha_info(secret, time_to_live);
+    ScriptVariable pool_dir;
+    int pool_size;
+    db.GetCaptchaPoolParameters(pool_dir, pool_size);
+    if(pool_size <= 0) {
+        set_captcha_pool(ScriptVariableInv());
+        return 0;
+    }
+    set_captcha_pool(pool_dir);
+    return pool_size;
 }
 
 static bool check_conffile_mode()
@@ -912,40 +996,32 @@ static bool check_conffile_mode()
     return (mode & 0007) == 0;
 }
 
-int main()
+static SessionStore *open_session_store(const ThalassaCgiDb &db,
+                                        bool persistent)
 {
-    Cgi cgi;
-    ThalassaCgiDb db(&cgi);
-
-    if(!check_conffile_mode()) {
-        send_error_page(cgi, db, 500,
-                        "Check permissions of your config file "
-                            THALASSA_CGI_CONFIG_PATH);
-        return 0;
-    }
-
-    if(!db.Load(THALASSA_CGI_CONFIG_PATH)) {
-        ScriptVariable diag = db.MakeErrorMessage();
-        send_error_page(cgi, db, 500, diag.c_str());
-        return 0;
-    }
+    ScriptVariable kind;
+    int size;
+    db.GetSessionStoreParameters(kind, size);
+    return make_session_store(kind, db.GetUserdataDirectory(),
+                              size, persistent);
+}
 
-    randomize();
-    captcha_setup(db);
+    // everything past loading the configuration, the same for the CGI
+    // and the persistent mode
+static void process_request(Cgi &cgi, ThalassaCgiDb &db, SessionStore *store)
+{
+    captcha_new_request(cgi.GetRemoteAddr());
 
     if(!cgi.ParseHead()) {
         cgi.Commit();
-        return 0;
+        return;
     }
-#if 0
-    db.SetRequest(&cgi);
-#endif
 
     ScriptVariable datadir = db.GetUserdataDirectory();
     FileStat dds(datadir.c_str());
     if(!dds.Exists() || !dds.IsDir()) {
         send_error_page(cgi, db, 500, "Check userdata directory");
-        return 0;
+        return;
     }
 
     ScriptVariable sessdir = db.GetUserdataDirectory();
@@ -954,14 +1030,21 @@ int main()
         int r = mkdir(sessdir.c_str(), 0700);
         if(r == -1) {
             send_error_page(cgi, db, 500, "Can't make sessions directory");
-            return 0;
+            return;
         }
     } else
     if(!sds.IsDir()) {
         send_error_page(cgi, db, 500, "Sessions dir isn't a dir O_o");
-        return 0;
+        return;
     }
-    SessionData session(sessdir.c_str());
+    if(!store) {
+        send_error_page(cgi, db, 500, "Can't open the session store");
+        return;
+    }
+    SessionData session(sessdir.c_str(), store);
+        // a little portion of the cleanup for every request, so that
+        // no request has to wait for all of it
+    session.PerformCleanup(THALASSA_CGI_SESSION_CLEANUP_BATCH);
     db.SetSession(&session);
     try_session_cookie(cgi, session);
 
@@ -974,28 +1057,338 @@ int main()
         break;
     case ThalassaCgiDb::path_bad:
         send_error_page(cgi, db, 400, "requested path bad");
-        return 0;
+        return;
     case ThalassaCgiDb::path_noent:
         send_error_page(cgi, db, 404, "path not configured");
-        return 0;
+        return;
     case ThalassaCgiDb::path_noaccess:
         send_error_page(cgi, db, 403, "forbidden");
-        return 0;
+        return;
     case ThalassaCgiDb::path_notfound:
         send_error_page(cgi, db, 404, "path not found");
-        return 0;
+        return;
     case ThalassaCgiDb::path_invalid:
         send_error_page(cgi, db, 406, "path not acceptable");
-        return 0;
+        return;
     default:
         send_error_page(cgi, db, 500, "bug in the CGI code");
-        return 0;
+        return;
     }
 
     if(cgi.IsPost())
         process_post_request(cgi, db, session, page);
     else
         process_get_request(cgi, db, session, page);
+}
+
+
+/////////////////////////////////////////////////////////////////
+// the persistent mode (see tcgi_srv.hpp)
+//
+// The configuration is loaded once and then kept; before every request
+// the file is stat'ed, and if it has changed, it is loaded anew.  If
+// it can't be loaded, requests are answered with the error page until
+// the file is fixed.
+//
+// The session store is opened along with the configuration, but once
+// the workers are running, they keep the store they've got, so that an
+// in-memory store remains shared; changes to the store parameters take
+// effect on SIGHUP.
+//
+// If there's the captcha pool, the main process starts a filler once a
+// quarter of the pool is used up (see xcaptcha.cpp), one at a time; if
+// a filler makes nothing (e.g., the pool dir can't be written, or it's
+// being filled by someone else), the next one waits for a while.
+
+class ResidentHandler : public ScgiRequestHandler {
+    ThalassaCgiDb *db;
+    ScriptVariable error;      // invalid if the configuration is fine
+    bool exists;
+    long long mtime, ctime, size, ino;
+    SessionStore *store;
+    ScriptVariable store_key;  // the parameters the store was opened with
+    bool in_worker;
+    int captcha_pool_size;
+    int filler_pid;            // 0 if no filler is running
+    time_t filler_retry_at;
+public:
+    ResidentHandler()
+        : db(0), store(0), in_worker(false), captcha_pool_size(0),
+        filler_pid(0), filler_retry_at(0) {}
+    ~ResidentHandler();
+    virtual void Reload() { RefreshConfig(true); }
+    virtual void WorkerStarted() { in_worker = true; randomize(); }
+    virtual void Handle(Cgi &cgi);
+    virtual void Tick();
+    virtual void ChildExited(int pid, int status);
+    virtual void Stopping();
+    virtual void TakeCounters(long *counters);
+    virtual ScriptVariable StatusReport(const long *counters);
+private:
+    void RefreshConfig(bool force);
+    void UpdateStore();
+};
+
+ResidentHandler::~ResidentHandler()
+{
+    if(db)
+        delete db;
+    if(store)
+        delete store;
+}
+
+void ResidentHandler::RefreshConfig(bool force)
+{
+    struct stat st;
+    bool ex = stat(THALASSA_CGI_CONFIG_PATH, &st) == 0;
+    if(!force && db && ex == exists && (!ex ||
+        (st.st_mtime == mtime && st.st_ctime == ctime &&
+         st.st_size == size && (long long)st.st_ino == ino)))
+    {
+        return;
+    }
+    exists = ex;
+    if(ex) {
+        mtime = st.st_mtime;
+        ctime = st.st_ctime;
+        size = st.st_size;
+        ino = st.st_ino;
+    }
+
+    if(db)
+        delete db;
+    db = new ThalassaCgiDb(0);
+    if(!check_conffile_mode()) {
+        error = "Check permissions of your config file "
+                THALASSA_CGI_CONFIG_PATH;
+    } else
+    if(!db->Load(THALASSA_CGI_CONFIG_PATH)) {
+        error = db->MakeErrorMessage();
+    } else {
+        error = ScriptVariableInv();
+        captcha_pool_size = captcha_setup(*db);
+        UpdateStore();
+    }
+    if(error.IsValid())
+        fprintf(stderr, "config error: %s\n", error.c_str());
+}
+
+void ResidentHandler::UpdateStore()
+{
+    ScriptVariable kind;
+    int tsize;
+    db->GetSessionStoreParameters(kind, tsize);
+    ScriptVariable key =
+        kind + ":" + ScriptNumber(tsize) + ":" + db->GetUserdataDirectory();
+    if(store && (in_worker || key == store_key))
+        return;
+    if(store)
+        delete store;
+    store = open_session_store(*db, true);
+    store_key = key;
+}
+
+void ResidentHandler::Handle(Cgi &cgi)
+{
+    RefreshConfig(false);
+    db->SetRequest(&cgi);
+    if(error.IsValid()) {
+        send_error_page(cgi, *db, 500, error.c_str());
+        return;
+    }
+    if(!store)     // e.g. the userdata dir didn't exist, try again
+        UpdateStore();
+    process_request(cgi, *db, store);
+}
+
+void ResidentHandler::Tick()
+{
+    if(error.IsValid() || captcha_pool_size <= 0)
+        return;
+    if(filler_pid || time(0) < filler_retry_at)
+        return;
+    if(captcha_pool_count() > captcha_pool_size * 3 / 4)
+        return;
+    fflush(0);
+    int pid = fork();
+    if(pid == -1)
+        return;
+    if(pid > 0) {
+        filler_pid = pid;
+        return;
+    }
+        // the main process catches these, we don't
+    signal(SIGTERM, SIG_DFL);
+    signal(SIGINT, SIG_DFL);
+    signal(SIGHUP, SIG_DFL);
+    signal(SIGCHLD, SIG_DFL);
+    randomize();
+    nice(10);   // the requests come first
+    _exit(captcha_pool_fill(captcha_pool_size) > 0 ? 0 : 1);
+}
+
+void ResidentHandler::ChildExited(int pid, int status)
+{
+    if(pid != filler_pid)
+        return;
+    filler_pid = 0;
+    if(!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        filler_retry_at = time(0) + THALASSA_CGI_CAPTCHA_POOL_RETRY;
+}
+
+    // the images made so far are kept; the next filler removes the
+    // unfinished one
+void ResidentHandler::Stopping()
+{
+    if(filler_pid)
+        kill(filler_pid, SIGTERM);
+}
+
+enum { counter_captcha_hits, counter_captcha_misses };
+
+void ResidentHandler::TakeCounters(long *counters)
+{
+    long hits, misses;
+    captcha_pool_take_counts(hits, misses);
+    counters[counter_captcha_hits] += hits;
+    counters[counter_captcha_misses] += misses;
+}
+
+ScriptVariable ResidentHandler::StatusReport(const long *counters)
+{
+    if(error.IsValid() || captcha_pool_size <= 0)
+        return ScriptVariable("");
+    return captcha_pool_report(counters[counter_captcha_hits],
+                               counters[counter_captcha_misses]);
+}
+
+    // -F and -P
+static int run_captcha_pool_command(bool fill)
+{
+    ThalassaCgiDb db(0);
+    if(!check_conffile_mode()) {
+        fprintf(stderr, "Check permissions of your config file "
+                            THALASSA_CGI_CONFIG_PATH "\n");
+        return 1;
+    }
+    if(!db.Load(THALASSA_CGI_CONFIG_PATH)) {
+        fprintf(stderr, "%s\n", db.MakeErrorMessage().c_str());
+        return 1;
+    }
+    int size = captcha_setup(db);
+    if(size <= 0) {
+        fprintf(stderr, "captcha pool not configured\n");
+        return 1;
+    }
+    if(fill) {
+        randomize();
+        if(captcha_pool_fill(size) == -1) {
+            fprintf(stderr, "couldn't fill the captcha pool\n");
+            return 1;
+        }
+    }
+        // the hits and misses are only counted by the persistent
+        // process, see its status report
+    printf("%s", captcha_pool_report(-1, -1).c_str());
+    return 0;
+}
+
+static bool get_number_arg(const char *s, int &res)
+{
+    long n;
+    if(!ScriptVariable(s).GetLong(n, 10) || n < 0)
+        return false;
+    res = n;
+    return true;
+}
+
+static int run_resident(int argc, char **argv)
+{
+    if(argc == 2 && (0 == strcmp(argv[1], "-F") || 0 == strcmp(argv[1], "-P")))
+        return run_captcha_pool_command(argv[1][1] == 'F');
+
+    ScriptVariable sock_path = ScriptVariableInv();
+    ScgiServerOptions opts;
+    bool ok = true;
+    int i;
+    for(i = 1; i < argc && ok; i += 2) {
+        if(i + 1 >= argc || argv[i][0] != '-' || !argv[i][1] || argv[i][2]) {
+            ok = false;
+            break;
+        }
+        switch(argv[i][1]) {
+        case 's':
+            sock_path = argv[i+1];
+            break;
+        case 'w':
+            ok = get_number_arg(argv[i+1], opts.workers);
+            break;
+        case 'r':
+            ok = get_number_arg(argv[i+1], opts.max_requests);
+            break;
+        case 'S':
+            opts.status_socket = argv[i+1];
+            break;
+        default:
+            ok = false;
+        }
+    }
+    if(!ok || !sock_path.IsValid()) {
+        fprintf(stderr,
+            "Usage: %s -s <socket> [-w <workers>] [-r <max_requests>] "
+                "[-S <status_socket>]\n"
+            "       %s -F | -P\n"
+            "runs as a daemon serving the SCGI requests that come through\n"
+            "the given UNIX domain socket; the configuration file "
+                THALASSA_CGI_CONFIG_PATH "\n"
+            "is looked for in the current directory and reloaded once it\n"
+            "changes or on SIGHUP; stops on SIGTERM or SIGINT\n"
+            "  -w  the number of worker processes (default: one per CPU;\n"
+            "      0 means to serve the requests by the process itself)\n"
+            "  -r  a worker is replaced after serving that many requests\n"
+            "      (default: %d, 0 means never)\n"
+            "  -S  a UNIX domain socket to report the workers' statistics\n"
+            "  -F  fill the captcha pool up and exit (e.g., from cron)\n"
+            "  -P  print the captcha pool statistics and exit\n",
+            argv[0], argv[0], opts.max_requests);
+        return 1;
+    }
+    ResidentHandler handler;
+    return run_scgi_server(sock_path, opts, handler);
+}
+
+
+/////////////////////////////////////////////////////////////////
+
+int main(int argc, char **argv)
+{
+        // run by the web server, it is a CGI program no matter what the
+        // command line is (the server may pass the query there)
+    if(!getenv("GATEWAY_INTERFACE") && argc > 1)
+        return run_resident(argc, argv);
+
+    Cgi cgi;
+    ThalassaCgiDb db(&cgi);
+
+    if(!check_conffile_mode()) {
+        send_error_page(cgi, db, 500,
+                        "Check permissions of your config file "
+                            THALASSA_CGI_CONFIG_PATH);
+        return 0;
+    }
+
+    if(!db.Load(THALASSA_CGI_CONFIG_PATH)) {
+        ScriptVariable diag = db.MakeErrorMessage();
+        send_error_page(cgi, db, 500, diag.c_str());
+        return 0;
+    }
+
+    randomize();
+    captcha_setup(db);
 
+    SessionStore *store = open_session_store(db, false);
+    process_request(cgi, db, store);
+    if(store)
+        delete store;
     return 0;
 }
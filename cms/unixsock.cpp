@@ -0,0 +1,76 @@
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include <scriptpp/scrvar.hpp>
+
+#include "unixsock.hpp"
+
+
+static bool fill_sockaddr(const ScriptVariable &path, struct sockaddr_un &sa)
+{
+    memset(&sa, 0, sizeof(sa));
+    sa.sun_family = AF_UNIX;
+    if(path.Length() >= (int)sizeof(sa.sun_path)) {
+        fprintf(stderr, "%s: socket path too long\n", path.c_str());
+        return false;
+    }
+    strcpy(sa.sun_path, path.c_str());
+    return true;
+}
+
+int unix_socket_listen(const ScriptVariable &path)
+{
+    struct sockaddr_un sa;
+    if(!fill_sockaddr(path, sa))
+        return -1;
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fd == -1) {
+        perror("socket");
+        return -1;
+    }
+        // a socket file may be left by a server which is gone; if it
+        // accepts connections, though, someone is still serving there
+    if(connect(fd, (struct sockaddr*)&sa, sizeof(sa)) == 0) {
+        fprintf(stderr, "%s: another server is running there\n",
+                path.c_str());
+        close(fd);
+        return -1;
+    }
+    close(fd);
+    unlink(path.c_str());
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fd == -1) {
+        perror("socket");
+        return -1;
+    }
+    if(bind(fd, (struct sockaddr*)&sa, sizeof(sa)) == -1 ||
+        listen(fd, 64) == -1)
+    {
+        perror(path.c_str());
+        close(fd);
+        return -1;
+    }
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+    return fd;
+}
+
+int unix_socket_connect(const ScriptVariable &path)
+{
+    struct sockaddr_un sa;
+    if(!fill_sockaddr(path, sa))
+        return -1;
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fd == -1)
+        return -1;
+    if(connect(fd, (struct sockaddr*)&sa, sizeof(sa)) == -1) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
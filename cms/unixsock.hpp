@@ -0,0 +1,16 @@
+#ifndef UNIXSOCK_HPP_SENTRY
+#define UNIXSOCK_HPP_SENTRY
+
+class ScriptVariable;
+
+    // creates a UNIX domain stream socket bound to the path and listening
+    // on it; the socket file left by a server which is gone is removed,
+    // but if someone accepts connections there, it is an error; returns
+    // the descriptor (close-on-exec), or -1 (the diagnostics are printed
+    // to stderr); the socket file's permissions are set by the umask
+int unix_socket_listen(const ScriptVariable &path);
+
+    // returns -1 if nobody accepts connections on the path
+int unix_socket_connect(const ScriptVariable &path);
+
+#endif
@@ -0,0 +1,226 @@
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#include <scriptpp/scrvar.hpp>
+
+#include "errlist.hpp"
+
+#include "workers.hpp"
+
+
+    // every worker has its own pipe; a message is the header (the type,
+    // the task index and the length) followed by the text
+enum { msg_error = 'E', msg_result = 'R', msg_summary = 'S' };
+
+struct message_header {
+    int type, idx, len;
+};
+
+static bool write_all(int fd, const char *buf, int len)
+{
+    while(len > 0) {
+        int rc = write(fd, buf, len);
+        if(rc == -1) {
+            if(errno == EINTR)
+                continue;
+            return false;
+        }
+        buf += rc;
+        len -= rc;
+    }
+    return true;
+}
+
+static bool read_all(int fd, char *buf, int len)
+{
+    while(len > 0) {
+        int rc = read(fd, buf, len);
+        if(rc == -1 && errno == EINTR)
+            continue;
+        if(rc <= 0)
+            return false;
+        buf += rc;
+        len -= rc;
+    }
+    return true;
+}
+
+static void send_message(int fd, int type, int idx, const ScriptVariable &s)
+{
+    message_header hd;
+    hd.type = type;
+    hd.idx = idx;
+    hd.len = s.Length();
+    write_all(fd, (const char*)&hd, sizeof(hd));
+    write_all(fd, s.c_str(), hd.len);
+}
+
+    // returns false on EOF or error
+static bool receive_message(int fd, WorkerTaskSet &tasks, ErrorList **err)
+{
+    message_header hd;
+    if(!read_all(fd, (char*)&hd, sizeof(hd)) || hd.len < 0)
+        return false;
+    char *buf = new char[hd.len + 1];
+    bool ok = read_all(fd, buf, hd.len);
+    if(ok) {
+        ScriptVariable s(buf, hd.len);
+        if(hd.type == msg_error)
+            ErrorList::AddError(err, s);
+        else
+        if(hd.type == msg_summary)
+            tasks.TakeSummary(s);
+        else
+            tasks.TakeResult(hd.idx, s);
+    }
+    delete[] buf;
+    return ok;
+}
+
+static void worker_main(WorkerTaskSet &tasks, int count,
+                        volatile int *counter, int fd)
+{
+    for(;;) {
+        int idx = __sync_fetch_and_add(counter, 1);
+        if(idx >= count)
+            break;
+        ErrorList *err = 0;
+        ScriptVariable res = tasks.Perform(idx, &err);
+        if(err) {
+            ErrorList *t;
+            for(t = err; t; t = t->next)
+                send_message(fd, msg_error, idx, t->message);
+            delete err;
+        }
+        if(res.IsValid())
+            send_message(fd, msg_result, idx, res);
+    }
+    ScriptVariable summary = tasks.WorkerSummary();
+    if(summary.IsValid())
+        send_message(fd, msg_summary, -1, summary);
+}
+
+static void run_tasks_here(WorkerTaskSet &tasks, int from, int count,
+                           ErrorList **err)
+{
+    int i;
+    for(i = from; i < count; i++) {
+        ScriptVariable res = tasks.Perform(i, err);
+        if(res.IsValid())
+            tasks.TakeResult(i, res);
+    }
+}
+
+static void receive_from_workers(struct pollfd *fds, int n,
+                                 WorkerTaskSet &tasks, ErrorList **err)
+{
+    int open_cnt = n;
+    while(open_cnt > 0) {
+        int rc = poll(fds, n, -1);
+        if(rc == -1) {
+            if(errno == EINTR)
+                continue;
+            break;
+        }
+        int i;
+        for(i = 0; i < n; i++) {
+            if(fds[i].fd == -1 || !fds[i].revents)
+                continue;
+            if(!receive_message(fds[i].fd, tasks, err)) {
+                close(fds[i].fd);
+                fds[i].fd = -1;
+                open_cnt--;
+            }
+        }
+    }
+}
+
+void run_worker_tasks(WorkerTaskSet &tasks, int jobs, ErrorList **err)
+{
+    int count = tasks.Count();
+    if(jobs > count)
+        jobs = count;
+    if(jobs < 2) {
+        run_tasks_here(tasks, 0, count, err);
+        return;
+    }
+
+    void *shm = mmap(0, sizeof(int), PROT_READ|PROT_WRITE,
+                     MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+    if(shm == MAP_FAILED) {
+        run_tasks_here(tasks, 0, count, err);
+        return;
+    }
+    volatile int *counter = (volatile int*)shm;
+    *counter = 0;
+
+    fflush(0);   // don't let the children flush our buffers once again
+
+    pid_t *pids = new pid_t[jobs];
+    struct pollfd *fds = new struct pollfd[jobs];
+    int started = 0;
+    int i;
+    for(i = 0; i < jobs; i++) {
+        int fd[2];
+        if(pipe(fd) == -1) {
+            ScriptVariable s(63, "pipe: %s (%d workers started)",
+                             strerror(errno), started);
+            ErrorList::AddError(err, s);
+            break;
+        }
+        pid_t pid = fork();
+        if(pid == -1) {
+            ScriptVariable s(63, "fork: %s (%d workers started)",
+                             strerror(errno), started);
+            ErrorList::AddError(err, s);
+            close(fd[0]);
+            close(fd[1]);
+            break;
+        }
+        if(pid == 0) {   // child
+            int k;
+            for(k = 0; k < started; k++)
+                close(fds[k].fd);
+            close(fd[0]);
+            worker_main(tasks, count, counter, fd[1]);
+            close(fd[1]);
+            fflush(0);
+            _exit(0);
+        }
+        close(fd[1]);
+        pids[started] = pid;
+        fds[started].fd = fd[0];
+        fds[started].events = POLLIN;
+        started++;
+    }
+
+    receive_from_workers(fds, started, tasks, err);
+
+    for(i = 0; i < started; i++) {
+        int status;
+        while(waitpid(pids[i], &status, 0) == -1 && errno == EINTR)
+            ;
+        if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            ScriptVariable s(63, "worker process %d terminated abnormally",
+                             (int)pids[i]);
+            ErrorList::AddError(err, s);
+        }
+    }
+    delete[] fds;
+    delete[] pids;
+
+        // if no worker could be started at all, or all of them crashed,
+        // the remaining tasks are still to be done; the counter tells
+        // where the workers stopped (a task being done by a crashed
+        // worker is lost, and this is reported above)
+    int done = *counter;
+    munmap(shm, sizeof(int));
+    if(done < count)
+        run_tasks_here(tasks, done, count, err);
+}
@@ -0,0 +1,44 @@
+#ifndef WORKERS_HPP_SENTRY
+#define WORKERS_HPP_SENTRY
+
+#include <scriptpp/scrvar.hpp>
+
+struct ErrorList;
+
+/*
+    WorkerTaskSet is an indexed collection of independent tasks.
+    The tasks are performed by run_worker_tasks(), either right here
+    (if only one job is requested or there's nothing worth forking for)
+    or within a pool of forked worker processes.
+
+    Each worker is a separate process which has its own copy of the
+    whole program state (the Database object, its macro realm, the
+    installed ArrayData and everything else), so the tasks don't need
+    any locking; the only thing they must not do is to write the same
+    files.  Tasks are distributed dynamically: a worker takes the next
+    task index from a shared counter once it is done with the previous
+    one.  Error messages and task results are passed back to the parent
+    through pipes; errors end up in the caller's error list, and results
+    are given to TakeResult, which is always called within the parent.
+    Whatever a worker accumulates in its own copy of the program state
+    (e.g., counters) is lost when it exits, unless it is passed back
+    with WorkerSummary.
+ */
+
+class WorkerTaskSet {
+public:
+    virtual ~WorkerTaskSet() {}
+    virtual int Count() const = 0;
+        // invalid string returned means no result
+    virtual ScriptVariable Perform(int idx, ErrorList **err) = 0;
+    virtual void TakeResult(int idx, const ScriptVariable &res) {}
+        // called within each worker once it runs out of tasks; the
+        // string returned (if valid) is given to TakeSummary, which,
+        // again, is called within the parent
+    virtual ScriptVariable WorkerSummary() { return ScriptVariableInv(); }
+    virtual void TakeSummary(const ScriptVariable &s) {}
+};
+
+void run_worker_tasks(WorkerTaskSet &tasks, int jobs, ErrorList **err);
+
+#endif
@@ -1,6 +1,16 @@
-#include <stdlib.h>    // for getenv
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
 #include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#include <sys/time.h>
 
+#include <scriptpp/cmd.hpp>
 #include <captcha/captcha.h>
 #include <stfilter/stfbs64.hpp>
 #include <md5/md5.h>
@@ -40,16 +50,33 @@
 
 static ScriptVariable the_secret(0);
 static int the_ttl = -1;
-static char *the_image;
-static int the_image_size;
+static ScriptVariable the_image_base64(0);
 static char the_answer[CAPTCHA_STRING_LENGTH+1];
 static ScriptVariable the_captcha_time(0);
+static ScriptVariable the_ip(0);
+static ScriptVariable the_pool_dir(0);
+
+static ScriptVariable take_base64(const void *buf, int len);
+static long pool_hits = 0, pool_misses = 0;
+
+static bool pool_pop();
 
 static void generate_if_not_yet()
 {
-    if(the_image)
+    if(the_image_base64.IsValid())
         return;
-    generate_captcha(&the_image, &the_image_size, the_answer);
+    if(the_pool_dir.IsValid()) {
+        if(pool_pop()) {
+            pool_hits++;
+            return;
+        }
+        pool_misses++;
+    }
+    char *img;
+    int size;
+    generate_captcha(&img, &size, the_answer);
+    the_image_base64 = take_base64(img, size);
+    free(img);
 }
 
 
@@ -59,9 +86,21 @@ void set_captcha_info(const ScriptVariable &secret, int time_to_live)
     the_ttl = time_to_live;
 }
 
+void set_captcha_pool(const ScriptVariable &dir)
+{
+    the_pool_dir = dir;
+}
+
+void captcha_new_request(const ScriptVariable &remote_addr)
+{
+    the_image_base64.Invalidate();
+    the_captcha_time = ScriptVariableInv();
+    the_ip = remote_addr;
+}
+
 ScriptVariable captcha_ip()
 {
-    return getenv("REMOTE_ADDR");
+    return the_ip;
 }
 
 ScriptVariable captcha_time()
@@ -77,15 +116,16 @@ public:
     FDest() : StreamFilter(0) {}
     ~FDest() {}
     virtual void FeedChar(int c) { res.operator+=((char)c); } // no EOF, ok
+    virtual void FeedBlock(const char *buf, int len)
+        { res += ScriptVariable(buf, len); }
 };
 
+    // the image is several KB, so it is given to the encoder at once
 static ScriptVariable take_base64(const void *buf, int len)
 {
     FDest dest;
     StreamFilterBase64encode enc(&dest);
-    int i;
-    for(i = 0; i < len; i++)
-        enc.FeedChar(((unsigned char*)buf)[i]);   // unsigned, ok
+    enc.FeedBlock((const char *)buf, len);
     enc.FeedEnd();
     return dest.res;
 }
@@ -93,7 +133,7 @@ static ScriptVariable take_base64(const void *buf, int len)
 ScriptVariable captcha_image_base64()
 {
     generate_if_not_yet();
-    return take_base64(the_image, the_image_size);
+    return the_image_base64;
 }
 
 static ScriptVariable generate_captcha_token(const ScriptVariable &ip,
@@ -144,3 +184,223 @@ int captcha_validate(const ScriptVariable &form_ip,
     return captcha_result_ok;
 }
 
+
+
+/////////////////////////////////////////////////////////////////
+// the pool of images made in advance
+//
+// Every image is a file within the pool directory, holding the answer
+// on the first line and the image (base64) after it.  The files are
+// written under temporary names starting with ``_'' and renamed once
+// complete.  To take an image, a process opens a file and removes it;
+// if the removal fails, someone else has taken that image first.
+//
+// The requests only count the hits and misses in memory (see
+// captcha_pool_take_counts); the filler's statistics are kept in the
+// _stats file, under flock(2).
+
+#define POOL_STATS_FILENAME "_stats"
+#define POOL_LOCK_FILENAME "_fill_lock"
+#define POOL_TMP_PREFIX "_tmp."
+
+struct CaptchaPoolStats {
+    long long fills, images, fill_usec;
+    long long last_fill_time, last_fill_images, last_fill_usec;
+};
+
+static bool is_pool_service_name(const char *s)
+{
+    return !*s || *s == '.' || *s == '_';
+}
+
+static bool pool_pop()
+{
+    const char *s;
+    ReadDir rd(the_pool_dir.c_str());
+    while((s = rd.Next())) {
+        if(is_pool_service_name(s))
+            continue;
+        ScriptVariable fname = the_pool_dir + "/" + s;
+        int fd = open(fname.c_str(), O_RDONLY);
+        if(fd == -1)
+            continue;
+        if(unlink(fname.c_str()) == -1) {   // taken by someone else
+            close(fd);
+            continue;
+        }
+        struct stat st;
+        if(fstat(fd, &st) == -1 || st.st_size < CAPTCHA_STRING_LENGTH + 2) {
+            close(fd);
+            continue;
+        }
+        char *buf = new char[st.st_size + 1];
+        int rc = read(fd, buf, st.st_size);
+        close(fd);
+        if(rc != st.st_size || buf[CAPTCHA_STRING_LENGTH] != '\n') {
+            delete[] buf;
+            continue;
+        }
+        buf[st.st_size] = 0;
+        memcpy(the_answer, buf, CAPTCHA_STRING_LENGTH);
+        the_answer[CAPTCHA_STRING_LENGTH] = 0;
+        the_image_base64 = buf + CAPTCHA_STRING_LENGTH + 1;
+        delete[] buf;
+        return true;
+    }
+    return false;
+}
+
+    // returns the descriptor, locked, or -1; the stats are zeroed if
+    // there's no file yet
+static int open_pool_stats(const ScriptVariable &dir, CaptchaPoolStats &st)
+{
+    memset(&st, 0, sizeof(st));
+    ScriptVariable fname = dir + "/" POOL_STATS_FILENAME;
+    int fd = open(fname.c_str(), O_RDWR|O_CREAT, 0600);
+    if(fd == -1)
+        return -1;
+    if(flock(fd, LOCK_EX) == -1) {
+        close(fd);
+        return -1;
+    }
+    if(read(fd, &st, sizeof(st)) != sizeof(st))
+        memset(&st, 0, sizeof(st));
+    return fd;
+}
+
+static void close_pool_stats(int fd, const CaptchaPoolStats &st)
+{
+    pwrite(fd, &st, sizeof(st), 0);
+    close(fd);    // this releases the lock as well
+}
+
+void captcha_pool_take_counts(long &hits, long &misses)
+{
+    hits = pool_hits;
+    misses = pool_misses;
+    pool_hits = pool_misses = 0;
+}
+
+int captcha_pool_count()
+{
+    if(the_pool_dir.IsInvalid())
+        return 0;
+    const char *s;
+    ReadDir rd(the_pool_dir.c_str());
+    int cnt = 0;
+    while((s = rd.Next()))
+        if(!is_pool_service_name(s))
+            cnt++;
+    return cnt;
+}
+
+static void remove_stale_pool_tmp_files()
+{
+    const char *s;
+    ReadDir rd(the_pool_dir.c_str());
+    while((s = rd.Next()))
+        if(0 == strncmp(s, POOL_TMP_PREFIX, sizeof(POOL_TMP_PREFIX)-1))
+            unlink((the_pool_dir + "/" + s).c_str());
+}
+
+static bool write_pool_image(const ScriptVariable &name)
+{
+    char *img;
+    int size;
+    char answer[CAPTCHA_STRING_LENGTH+1];
+    generate_captcha(&img, &size, answer);
+    ScriptVariable text = ScriptVariable(answer) + "\n" +
+                          take_base64(img, size);
+    free(img);
+
+    ScriptVariable tmpname = the_pool_dir + "/" POOL_TMP_PREFIX + name;
+    int fd = open(tmpname.c_str(), O_WRONLY|O_CREAT|O_TRUNC, 0600);
+    if(fd == -1)
+        return false;
+    int wc = write(fd, text.c_str(), text.Length());
+    int cr = close(fd);
+    if(wc != text.Length() || cr == -1 ||
+        rename(tmpname.c_str(), (the_pool_dir + "/" + name).c_str()) == -1)
+    {
+        unlink(tmpname.c_str());
+        return false;
+    }
+    return true;
+}
+
+int captcha_pool_fill(int size)
+{
+    if(the_pool_dir.IsInvalid())
+        return -1;
+    if(mkdir(the_pool_dir.c_str(), 0700) == -1 && errno != EEXIST)
+        return -1;
+    ScriptVariable lockname = the_pool_dir + "/" POOL_LOCK_FILENAME;
+    int lockfd = open(lockname.c_str(), O_WRONLY|O_CREAT, 0600);
+    if(lockfd == -1)
+        return -1;
+    if(flock(lockfd, LOCK_EX|LOCK_NB) == -1) {   // someone's filling it
+        close(lockfd);
+        return 0;
+    }
+    remove_stale_pool_tmp_files();
+
+    struct timeval t0, t1;
+    gettimeofday(&t0, 0);
+    int count = captcha_pool_count();
+    ScriptVariable prefix(0, "%lld.%d.", (long long)t0.tv_sec, (int)getpid());
+    int made = 0;
+    while(count + made < size) {
+        if(!write_pool_image(prefix + ScriptNumber(made)))
+            break;
+        made++;
+    }
+    gettimeofday(&t1, 0);
+
+    if(made > 0) {
+        long long usec = (long long)(t1.tv_sec - t0.tv_sec) * 1000000 +
+                         (t1.tv_usec - t0.tv_usec);
+        CaptchaPoolStats st;
+        int fd = open_pool_stats(the_pool_dir, st);
+        if(fd != -1) {
+            st.fills++;
+            st.images += made;
+            st.fill_usec += usec;
+            st.last_fill_time = t1.tv_sec;
+            st.last_fill_images = made;
+            st.last_fill_usec = usec;
+            close_pool_stats(fd, st);
+        }
+    }
+    close(lockfd);
+    return made;
+}
+
+ScriptVariable captcha_pool_report(long hits, long misses)
+{
+    if(the_pool_dir.IsInvalid())
+        return "captcha pool: not configured\n";
+    CaptchaPoolStats st;
+    int fd = open_pool_stats(the_pool_dir, st);
+    if(fd != -1)
+        close(fd);
+    ScriptVariable res(0, "captcha pool: %d images", captcha_pool_count());
+    if(hits >= 0 && misses >= 0) {
+        long reqs = hits + misses;
+        res += ScriptVariable(0, "; hits: %ld, misses: %ld (%.1f%% hit rate)",
+                              hits, misses,
+                              reqs > 0 ? 100.0 * hits / reqs : 0.0);
+    }
+    res += "\n";
+    res += ScriptVariable(0, "refills: %lld, images made: %lld, %.2f ms "
+                             "per image\n",
+                          st.fills, st.images,
+                          st.images > 0 ? st.fill_usec / 1000.0 / st.images
+                                        : 0.0);
+    if(st.fills > 0)
+        res += ScriptVariable(0, "last refill: %lld images in %.3f s, "
+                                 "%lld s ago\n",
+                              st.last_fill_images,
+                              st.last_fill_usec / 1000000.0,
+                              (long long)time(0) - st.last_fill_time);
+    return res;
+}
@@ -4,6 +4,13 @@
 #include <scriptpp/scrvar.hpp>
 
 void set_captcha_info(const ScriptVariable &secret, int time_to_live);
+    // the directory of the images made in advance (see xcaptcha.cpp);
+    // invalid means no pool, all images are made on request; the
+    // images are also made on request if the pool is empty
+void set_captcha_pool(const ScriptVariable &dir);
+    // must be called for every request before the functions below are
+    // used; forgets the previous request's captcha, if any
+void captcha_new_request(const ScriptVariable &remote_addr);
 ScriptVariable captcha_image_base64();
 ScriptVariable captcha_ip();
 ScriptVariable captcha_time();
@@ -17,6 +24,18 @@ enum {
     captcha_result_wrong = -4
 };
 
+    // the pool is topped up to the given size; returns the number of
+    // images made (0 if someone else is filling the pool), or -1
+int captcha_pool_fill(int size);
+int captcha_pool_count();
+    // the number of images taken from the pool and made on request
+    // because the pool was empty, since the previous call (within this
+    // process); the counters are zeroed
+void captcha_pool_take_counts(long &hits, long &misses);
+    // the number of images, the hit rate for the given counts (negative
+    // if not known) and the time the refills take
+ScriptVariable captcha_pool_report(long hits, long misses);
+
 int captcha_validate(const ScriptVariable &form_ip,
                      const ScriptVariable &form_time,
                      const ScriptVariable &form_token,
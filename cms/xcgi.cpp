@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <errno.h>
 #include <unistd.h>
 
 #include "urlenc.hpp"
@@ -10,7 +11,7 @@
 
 Cgi::Cgi()
     : status_code(200), status_message("Ok"), response_body(""), location(0),
-    content_length(-1)
+    content_length(-1), vars_given(false), in_fd(0), out_fd(-1)
 {
 }
 
@@ -67,19 +68,45 @@ static void extract_cookies(const char *str, ScriptVector &cookies)
 
 }
 
+void Cgi::SetRequest(const ScriptVector &variables, int in, int out)
+{
+    vars = variables;
+    vars_given = true;
+    in_fd = in;
+    out_fd = out;
+}
+
+const char *Cgi::GetEnv(const char *name) const
+{
+    if(!vars_given)
+        return getenv(name);
+    int vl = vars.Length();
+    int i;
+    for(i = 0; i < vl-1; i+=2)
+        if(vars[i] == name)
+            return vars[i+1].c_str();
+    return 0;
+}
+
+const char *Cgi::GetEnvE(const char *s) const
+{
+    const char *r = GetEnv(s);
+    return r ? r : "";
+}
+
 bool Cgi::DoParseHead()
 {
     const char *tmp;
-    tmp = getenv("QUERY_STRING");
+    tmp = GetEnv("QUERY_STRING");
     if(!tmp)                      // CGI protocol's broken!
         return false;
     query_to_params(tmp, params);
 
-    tmp = getenv("HTTP_COOKIE");
+    tmp = GetEnv("HTTP_COOKIE");
     if(tmp)
         extract_cookies(tmp, cookies);
 
-    tmp = getenv("CONTENT_LENGTH");
+    tmp = GetEnv("CONTENT_LENGTH");
     if(tmp) {
         bool ok = ScriptVariable(tmp).GetLongLong(content_length, 10);
         if(!ok)
@@ -103,7 +130,7 @@ static const char multipart[] = "multipart/form-data;";
 
 bool Cgi::DoParseBody()
 {
-    const char *tmp = getenv("CONTENT_TYPE");
+    const char *tmp = GetEnv("CONTENT_TYPE");
     if(tmp) {
         ScriptVariable preftp =
             ScriptVariable(tmp).Range(0, sizeof(multipart)-1).Get().Tolower();
@@ -123,7 +150,7 @@ bool Cgi::DoParseBody()
         int to_rd = content_length - rt;
         if(to_rd > 4096)
             to_rd = 4096;
-        int r = read(0, buf+rt, to_rd);
+        int r = read(in_fd, buf+rt, to_rd);
         if(r < 1) {
             delete[] buf;
             return false;
@@ -154,7 +181,7 @@ void Cgi::GetStatus(int &code, ScriptVariable &msg) const
 
 bool Cgi::IsPost() const
 {
-    const char *c = getenv("REQUEST_METHOD");
+    const char *c = GetEnv("REQUEST_METHOD");
     if(!c)
         return false;
     return ScriptVariable(c).Toupper() == "POST";
@@ -162,36 +189,30 @@ bool Cgi::IsPost() const
 
 ScriptVariable Cgi::GetPath() const
 {
-    const char *pt = getenv("PATH_INFO");
+    const char *pt = GetEnv("PATH_INFO");
     if(!pt || !*pt)
         pt = "/";
     return pt;
 }
 
-static const char *getenv_e(const char *s)
-{
-    const char *r = getenv(s);
-    return r ? r : "";
-}
-
 ScriptVariable Cgi::GetDocRoot() const
 {
-    return getenv_e("DOCUMENT_ROOT");
+    return GetEnvE("DOCUMENT_ROOT");
 }
 
 ScriptVariable Cgi::GetScript() const
 {
-    return getenv_e("SCRIPT_NAME");
+    return GetEnvE("SCRIPT_NAME");
 }
 
 ScriptVariable Cgi::GetHost() const
 {
-    return getenv_e("HTTP_HOST");
+    return GetEnvE("HTTP_HOST");
 }
 
 int Cgi::GetPort() const
 {
-    ScriptVariable p(getenv_e("SERVER_PORT"));
+    ScriptVariable p(GetEnvE("SERVER_PORT"));
     long n;
     if(!p.GetLong(n, 10) || n <= 0 || n >= 65535)
         return -1;
@@ -200,17 +221,17 @@ int Cgi::GetPort() const
 
 ScriptVariable Cgi::GetRemoteHost() const
 {
-    return getenv_e("REMOTE_HOST");
+    return GetEnvE("REMOTE_HOST");
 }
 
 ScriptVariable Cgi::GetRemoteAddr() const
 {
-    return getenv_e("REMOTE_ADDR");
+    return GetEnvE("REMOTE_ADDR");
 }
 
 int Cgi::GetRemotePort() const
 {
-    ScriptVariable p(getenv_e("REMOTE_PORT"));
+    ScriptVariable p(GetEnvE("REMOTE_PORT"));
     long n;
     if(!p.GetLong(n, 10) || n <= 0 || n >= 65535)
         return -1;
@@ -280,23 +301,45 @@ void Cgi::DiscardCookie(const ScriptVariable &name)
     setcookie_strings.AddItem(res);
 }
 
+static void write_all(int fd, const char *buf, int len)
+{
+    while(len > 0) {
+        int rc = write(fd, buf, len);
+        if(rc == -1 && errno == EINTR)
+            continue;
+        if(rc < 1)
+            return;
+        buf += rc;
+        len -= rc;
+    }
+}
+
 void Cgi::Commit()
 {
-    printf("Status: %d %s\r\n"
-           "Content-Type: text/html\r\n",
-           status_code, status_message.c_str());
+    ScriptVariable head(0, "Status: %d %s\r\n"
+                           "Content-Type: text/html\r\n",
+                        status_code, status_message.c_str());
     int i;
     for(i = 0; i < setcookie_strings.Length(); i++) {
-        fputs("Set-Cookie: ", stdout);
-        fputs(setcookie_strings[i].c_str(), stdout);
-        fputs("\r\n", stdout);
+        head += "Set-Cookie: ";
+        head += setcookie_strings[i];
+        head += "\r\n";
+    }
+    if(location.IsValid()) {
+        head += "Location: ";
+        head += location;
+        head += "\r\n";
     }
-    if(location.IsValid())
-        printf("Location: %s\r\n", location.c_str());
     bool have_body = response_body.IsValid() && response_body.Length() > 0;
     // XXXXX may be send the body length header?
-    fputs("\r\n", stdout);   // finish the header
+    head += "\r\n";   // finish the header
+    if(out_fd == -1) {
+        fputs(head.c_str(), stdout);
+        if(have_body)
+            fputs(response_body.c_str(), stdout);
+        return;
+    }
+    write_all(out_fd, head.c_str(), head.Length());
     if(have_body)
-        fputs(response_body.c_str(), stdout);
+        write_all(out_fd, response_body.c_str(), response_body.Length());
 }
-
@@ -30,10 +30,24 @@ class Cgi {
     ScriptVector params;
     ScriptVector cookies;
     long long content_length;
+
+        /* where the request comes from and the response goes to;
+           by default, the environment, stdin and stdout (see SetRequest) */
+    ScriptVector vars;
+    bool vars_given;
+    int in_fd, out_fd;
 public:
     Cgi();
     ~Cgi();
 
+        // for a persistent process: the request's variables (those the
+        // web server would put into the environment) are given as the
+        // name, value, name, value... vector; the body is read from
+        // in_fd, the response is written to out_fd
+    void SetRequest(const ScriptVector &variables, int in_fd, int out_fd);
+        // the request's variable, or NULL if there's no such variable
+    const char *GetEnv(const char *name) const;
+
     bool ParseHead();
     long long ContentLength() const { return content_length; }
     bool BodyExpected() const { return content_length > 0; }
@@ -69,6 +83,7 @@ public:
 private:
     bool DoParseHead();
     bool DoParseBody();
+    const char *GetEnvE(const char *name) const;
 };
 
 #endif
@@ -0,0 +1,14672 @@
+/* GENERATED WITH _bin2c, FROM FILE pictures/A.png */
+const unsigned char letter_image_A[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x35, 0x31, 0x3a, 0x31,
+    0x36, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x35,
+    0x31, 0x3a, 0x31, 0x36, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x39, 0x66, 0x35, 0x63,
+    0x65, 0x62, 0x35, 0x66, 0x2d, 0x66, 0x37, 0x31,
+    0x33, 0x2d, 0x63, 0x63, 0x34, 0x34, 0x2d, 0x39,
+    0x32, 0x34, 0x65, 0x2d, 0x33, 0x64, 0x61, 0x61,
+    0x66, 0x66, 0x30, 0x34, 0x38, 0x30, 0x32, 0x65,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x30, 0x62, 0x35, 0x35, 0x37, 0x31,
+    0x61, 0x39, 0x2d, 0x31, 0x64, 0x65, 0x65, 0x2d,
+    0x33, 0x62, 0x34, 0x35, 0x2d, 0x39, 0x61, 0x37,
+    0x35, 0x2d, 0x62, 0x37, 0x37, 0x33, 0x30, 0x39,
+    0x31, 0x35, 0x37, 0x39, 0x30, 0x30, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x63, 0x34, 0x63, 0x64, 0x36,
+    0x61, 0x66, 0x2d, 0x35, 0x33, 0x66, 0x30, 0x2d,
+    0x62, 0x66, 0x34, 0x31, 0x2d, 0x38, 0x34, 0x65,
+    0x65, 0x2d, 0x62, 0x66, 0x37, 0x33, 0x36, 0x35,
+    0x34, 0x62, 0x33, 0x37, 0x35, 0x62, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x31, 0x3a, 0x31, 0x36, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x39, 0x66, 0x35, 0x63, 0x65, 0x62,
+    0x35, 0x66, 0x2d, 0x66, 0x37, 0x31, 0x33, 0x2d,
+    0x63, 0x63, 0x34, 0x34, 0x2d, 0x39, 0x32, 0x34,
+    0x65, 0x2d, 0x33, 0x64, 0x61, 0x61, 0x66, 0x66,
+    0x30, 0x34, 0x38, 0x30, 0x32, 0x65, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x31, 0x3a, 0x31, 0x36, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x31, 0x63, 0x34, 0x63,
+    0x64, 0x36, 0x61, 0x66, 0x2d, 0x35, 0x33, 0x66,
+    0x30, 0x2d, 0x62, 0x66, 0x34, 0x31, 0x2d, 0x38,
+    0x34, 0x65, 0x65, 0x2d, 0x62, 0x66, 0x37, 0x33,
+    0x36, 0x35, 0x34, 0x62, 0x33, 0x37, 0x35, 0x62,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0xa5, 0x8a, 0xd9, 0x1b, 0x00, 0x00,
+    0x01, 0x1d, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xbd, 0x54, 0x31, 0x8e, 0x85, 0x20, 0x14, 0x7c,
+    0x7f, 0x5b, 0x13, 0x2b, 0x13, 0x63, 0x4d, 0x89,
+    0xc7, 0xa0, 0xb1, 0xb4, 0x31, 0xdc, 0x81, 0xc6,
+    0x03, 0x78, 0x03, 0x6e, 0xc0, 0x09, 0xb4, 0x57,
+    0x12, 0x1b, 0x63, 0xa2, 0xc7, 0xe0, 0x00, 0xd8,
+    0x43, 0xcd, 0x2f, 0xc8, 0xba, 0x3f, 0x5f, 0x97,
+    0xff, 0xdd, 0xcd, 0xee, 0x54, 0x04, 0x26, 0xc3,
+    0xcc, 0x1b, 0xf4, 0xe6, 0x9c, 0x83, 0xdf, 0xe1,
+    0x23, 0x7c, 0xdc, 0x75, 0x5d, 0x9e, 0xe7, 0xd6,
+    0xda, 0x10, 0xc9, 0x05, 0x41, 0x08, 0x01, 0x80,
+    0xb6, 0x6d, 0x03, 0x9c, 0x90, 0xc4, 0xb2, 0x2c,
+    0xfe, 0x1a, 0x4a, 0xe9, 0x0f, 0x25, 0x18, 0x63,
+    0x9c, 0x73, 0xaf, 0xa2, 0x94, 0xba, 0x2c, 0xa1,
+    0x94, 0x22, 0x84, 0xb8, 0xcf, 0x2c, 0x9c, 0xf3,
+    0xcb, 0x12, 0x42, 0x08, 0x3f, 0x82, 0xb6, 0x6d,
+    0x01, 0x00, 0x63, 0x7c, 0x4d, 0xc2, 0x18, 0x83,
+    0x31, 0x36, 0xc6, 0x38, 0xe7, 0xb4, 0xd6, 0x3e,
+    0x8b, 0x94, 0xf2, 0x94, 0x7c, 0x5e, 0x6a, 0xdf,
+    0xf7, 0x65, 0x59, 0x46, 0x51, 0x04, 0x00, 0x69,
+    0x9a, 0x32, 0xc6, 0x00, 0x60, 0x18, 0x86, 0x0b,
+    0xa5, 0x12, 0x42, 0x1e, 0xe7, 0x27, 0xa5, 0xf4,
+    0x64, 0xad, 0xf5, 0x5b, 0x2e, 0xd6, 0x75, 0x4d,
+    0x92, 0x04, 0x21, 0xb4, 0xef, 0x14, 0x45, 0x81,
+    0x31, 0x06, 0x80, 0x79, 0x9e, 0xdf, 0x72, 0xe1,
+    0x6d, 0x9f, 0xc2, 0x77, 0xf4, 0x62, 0x9c, 0x7b,
+    0x97, 0xc7, 0x7d, 0xaf, 0xb2, 0x2c, 0xcb, 0x8b,
+    0x20, 0xd3, 0x34, 0x55, 0x55, 0x75, 0xbc, 0x1f,
+    0x21, 0x44, 0x29, 0x05, 0x80, 0x71, 0x1c, 0x43,
+    0x41, 0xb4, 0xd6, 0x7b, 0x97, 0x47, 0xf8, 0x07,
+    0x02, 0x87, 0x97, 0xfa, 0xe5, 0xc2, 0x5a, 0x5b,
+    0xd7, 0x75, 0x96, 0x65, 0xdf, 0x0d, 0x22, 0x8e,
+    0x63, 0xbf, 0x68, 0x9a, 0x66, 0xdb, 0xb6, 0x67,
+    0x17, 0xfb, 0x17, 0xb5, 0x93, 0x9e, 0x2c, 0xf8,
+    0x14, 0x8f, 0x10, 0x42, 0xf8, 0xa3, 0x9b, 0xfb,
+    0xeb, 0x5f, 0xce, 0x3f, 0x49, 0xdc, 0x01, 0x11,
+    0xa0, 0x6d, 0xf5, 0xf1, 0x1b, 0xf8, 0x47, 0x00,
+    0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae,
+    0x42, 0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/B.png */
+const unsigned char letter_image_B[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x35, 0x31, 0x3a, 0x35,
+    0x32, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x35,
+    0x31, 0x3a, 0x35, 0x32, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x35, 0x61, 0x33, 0x35,
+    0x64, 0x37, 0x32, 0x62, 0x2d, 0x39, 0x62, 0x39,
+    0x64, 0x2d, 0x30, 0x32, 0x34, 0x66, 0x2d, 0x39,
+    0x66, 0x38, 0x34, 0x2d, 0x35, 0x63, 0x33, 0x66,
+    0x30, 0x64, 0x63, 0x32, 0x63, 0x35, 0x66, 0x32,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x35, 0x62, 0x32, 0x63, 0x36, 0x31,
+    0x62, 0x62, 0x2d, 0x66, 0x30, 0x30, 0x66, 0x2d,
+    0x64, 0x63, 0x34, 0x35, 0x2d, 0x62, 0x32, 0x62,
+    0x62, 0x2d, 0x66, 0x62, 0x30, 0x33, 0x36, 0x66,
+    0x34, 0x66, 0x34, 0x61, 0x66, 0x33, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x38, 0x65, 0x39, 0x33, 0x33, 0x34,
+    0x64, 0x66, 0x2d, 0x35, 0x33, 0x64, 0x63, 0x2d,
+    0x35, 0x33, 0x34, 0x30, 0x2d, 0x61, 0x30, 0x31,
+    0x31, 0x2d, 0x63, 0x38, 0x38, 0x39, 0x30, 0x37,
+    0x62, 0x34, 0x31, 0x30, 0x35, 0x62, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x31, 0x3a, 0x35, 0x32, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x35, 0x61, 0x33, 0x35, 0x64, 0x37,
+    0x32, 0x62, 0x2d, 0x39, 0x62, 0x39, 0x64, 0x2d,
+    0x30, 0x32, 0x34, 0x66, 0x2d, 0x39, 0x66, 0x38,
+    0x34, 0x2d, 0x35, 0x63, 0x33, 0x66, 0x30, 0x64,
+    0x63, 0x32, 0x63, 0x35, 0x66, 0x32, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x31, 0x3a, 0x35, 0x32, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x38, 0x65, 0x39, 0x33,
+    0x33, 0x34, 0x64, 0x66, 0x2d, 0x35, 0x33, 0x64,
+    0x63, 0x2d, 0x35, 0x33, 0x34, 0x30, 0x2d, 0x61,
+    0x30, 0x31, 0x31, 0x2d, 0x63, 0x38, 0x38, 0x39,
+    0x30, 0x37, 0x62, 0x34, 0x31, 0x30, 0x35, 0x62,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0x9d, 0xe8, 0xa4, 0x61, 0x00, 0x00,
+    0x01, 0x08, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xc5, 0x94, 0x31, 0x8e, 0x84, 0x20, 0x14, 0x86,
+    0x9f, 0xd3, 0x7b, 0x0a, 0x4b, 0x0a, 0x1b, 0x4b,
+    0x4b, 0x2b, 0x4f, 0x80, 0x85, 0x27, 0xc0, 0x9b,
+    0x78, 0x03, 0x68, 0x2c, 0x39, 0x81, 0xb5, 0x91,
+    0x13, 0x58, 0xd8, 0x71, 0x00, 0x2d, 0x55, 0xa8,
+    0xd9, 0x82, 0x84, 0x75, 0x18, 0x9d, 0xcc, 0xb2,
+    0x9b, 0xec, 0x5f, 0xbd, 0xfc, 0xc0, 0x97, 0x97,
+    0xf7, 0x03, 0x91, 0x31, 0x06, 0x7e, 0xa7, 0x87,
+    0xab, 0xb4, 0xd6, 0xd1, 0xbd, 0xaa, 0xaa, 0x62,
+    0x8c, 0x69, 0xad, 0x2f, 0x18, 0xe6, 0x59, 0x52,
+    0x4a, 0x84, 0x10, 0x00, 0x70, 0xce, 0x9d, 0x29,
+    0x84, 0x20, 0x84, 0xd8, 0xfd, 0x42, 0x08, 0xef,
+    0x88, 0x8f, 0x30, 0xc6, 0x60, 0x8c, 0x3d, 0x84,
+    0x55, 0xdb, 0xb6, 0x00, 0x80, 0x10, 0x52, 0x4a,
+    0x9d, 0xfd, 0xc7, 0x45, 0x63, 0x37, 0xaa, 0xeb,
+    0x1a, 0x00, 0xe6, 0x79, 0x1e, 0xc7, 0xf1, 0x7a,
+    0x16, 0x9f, 0x6b, 0xdf, 0xf7, 0x40, 0xc4, 0x30,
+    0x0c, 0xb6, 0xc8, 0xb2, 0x2c, 0x04, 0xc1, 0x18,
+    0x73, 0x33, 0x4a, 0x92, 0xe4, 0x69, 0xed, 0x6e,
+    0x9c, 0x97, 0xea, 0xfb, 0xfe, 0x75, 0xff, 0x6d,
+    0x17, 0xe7, 0x44, 0xa4, 0x94, 0x36, 0x8e, 0xb2,
+    0x2c, 0x9b, 0xa6, 0xf1, 0x6f, 0xc7, 0xe7, 0xa1,
+    0x0a, 0x21, 0xec, 0x11, 0x8c, 0x71, 0x60, 0xa8,
+    0x79, 0x9e, 0xdb, 0x0b, 0xc6, 0x39, 0x9f, 0xa6,
+    0xc9, 0xf9, 0x3f, 0x0b, 0x35, 0x4d, 0x53, 0x5b,
+    0x1c, 0xc7, 0x11, 0x88, 0xd8, 0xb6, 0xcd, 0x16,
+    0x71, 0x1c, 0x87, 0x20, 0xd6, 0x75, 0xed, 0xba,
+    0x0e, 0x00, 0x30, 0xc6, 0xae, 0x1d, 0x80, 0xfb,
+    0x67, 0x46, 0x29, 0x3d, 0xfb, 0x94, 0x52, 0xeb,
+    0x17, 0x45, 0xb1, 0x2c, 0xcb, 0x79, 0xe9, 0x1b,
+    0xa1, 0x94, 0x7a, 0xdf, 0x05, 0x21, 0xc4, 0xe3,
+    0x5a, 0x45, 0xe6, 0x0f, 0xbf, 0x9c, 0xff, 0x44,
+    0x7c, 0x01, 0xcd, 0x1e, 0x59, 0xc9, 0x88, 0xfa,
+    0x49, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
+    0x4e, 0x44, 0xae, 0x42, 0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/C.png */
+const unsigned char letter_image_C[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x35, 0x32, 0x3a, 0x31,
+    0x35, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x35,
+    0x32, 0x3a, 0x31, 0x35, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x32, 0x30, 0x61, 0x30,
+    0x61, 0x31, 0x36, 0x61, 0x2d, 0x64, 0x35, 0x62,
+    0x64, 0x2d, 0x38, 0x63, 0x34, 0x61, 0x2d, 0x62,
+    0x31, 0x37, 0x37, 0x2d, 0x64, 0x37, 0x63, 0x35,
+    0x36, 0x35, 0x62, 0x38, 0x62, 0x61, 0x32, 0x31,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x35, 0x31, 0x37, 0x34, 0x32, 0x35,
+    0x37, 0x66, 0x2d, 0x30, 0x35, 0x32, 0x66, 0x2d,
+    0x35, 0x36, 0x34, 0x65, 0x2d, 0x62, 0x34, 0x39,
+    0x33, 0x2d, 0x39, 0x31, 0x35, 0x37, 0x62, 0x38,
+    0x64, 0x64, 0x65, 0x38, 0x30, 0x65, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x65, 0x61, 0x33, 0x61, 0x62, 0x38,
+    0x34, 0x31, 0x2d, 0x37, 0x35, 0x65, 0x39, 0x2d,
+    0x38, 0x37, 0x34, 0x63, 0x2d, 0x62, 0x32, 0x66,
+    0x64, 0x2d, 0x38, 0x65, 0x61, 0x62, 0x65, 0x30,
+    0x63, 0x63, 0x33, 0x61, 0x33, 0x35, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x32, 0x3a, 0x31, 0x35, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x32, 0x30, 0x61, 0x30, 0x61, 0x31,
+    0x36, 0x61, 0x2d, 0x64, 0x35, 0x62, 0x64, 0x2d,
+    0x38, 0x63, 0x34, 0x61, 0x2d, 0x62, 0x31, 0x37,
+    0x37, 0x2d, 0x64, 0x37, 0x63, 0x35, 0x36, 0x35,
+    0x62, 0x38, 0x62, 0x61, 0x32, 0x31, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x32, 0x3a, 0x31, 0x35, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x65, 0x61, 0x33, 0x61,
+    0x62, 0x38, 0x34, 0x31, 0x2d, 0x37, 0x35, 0x65,
+    0x39, 0x2d, 0x38, 0x37, 0x34, 0x63, 0x2d, 0x62,
+    0x32, 0x66, 0x64, 0x2d, 0x38, 0x65, 0x61, 0x62,
+    0x65, 0x30, 0x63, 0x63, 0x33, 0x61, 0x33, 0x35,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0x41, 0x1a, 0xff, 0xb6, 0x00, 0x00,
+    0x01, 0x03, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xbd, 0x94, 0xc1, 0xad, 0x84, 0x20, 0x10, 0x86,
+    0xc7, 0x77, 0x36, 0xb1, 0x02, 0xef, 0x26, 0xb4,
+    0xe1, 0xd1, 0x02, 0xc6, 0x1a, 0xb0, 0x04, 0xad,
+    0x80, 0x0e, 0xb0, 0x01, 0x6c, 0x80, 0x06, 0x26,
+    0xb1, 0x05, 0x13, 0xe3, 0xc9, 0x13, 0x05, 0x70,
+    0x67, 0x0f, 0x64, 0x95, 0xf0, 0x70, 0xf3, 0xd6,
+    0xcd, 0xbe, 0xff, 0x34, 0x81, 0x99, 0x0f, 0x70,
+    0xfe, 0x31, 0x73, 0xce, 0xc1, 0x67, 0xfa, 0xb9,
+    0xda, 0x18, 0xc7, 0xb1, 0x6d, 0xdb, 0xec, 0xa9,
+    0xae, 0xeb, 0xa6, 0x69, 0x02, 0x80, 0x61, 0x18,
+    0xe2, 0x54, 0xf7, 0x4b, 0x4a, 0x29, 0x00, 0x60,
+    0x8c, 0x29, 0xa5, 0x8e, 0x45, 0xad, 0x35, 0xe7,
+    0xdc, 0x97, 0x58, 0x6b, 0xc3, 0xfc, 0x18, 0x21,
+    0xa5, 0x04, 0x00, 0x44, 0x8c, 0xf2, 0xc2, 0xdd,
+    0x6d, 0xdb, 0x2e, 0x11, 0x5a, 0x6b, 0x7f, 0x4e,
+    0x94, 0x14, 0x0a, 0x11, 0x5f, 0x21, 0xea, 0xba,
+    0x06, 0x00, 0xce, 0xf9, 0x55, 0xbd, 0x3f, 0x86,
+    0x88, 0xd2, 0x08, 0x22, 0xf2, 0x57, 0x08, 0x3f,
+    0xc1, 0x5f, 0x74, 0x76, 0x64, 0x59, 0x16, 0x1f,
+    0x54, 0x55, 0x75, 0xb3, 0xa9, 0xfb, 0xbe, 0xfb,
+    0x20, 0xcf, 0xf3, 0x9b, 0x88, 0xdb, 0x3a, 0x11,
+    0x45, 0x51, 0x7c, 0x8a, 0x28, 0xcb, 0xd2, 0x07,
+    0xeb, 0xba, 0xde, 0x44, 0x34, 0x4d, 0xc3, 0x18,
+    0x03, 0x80, 0x79, 0x9e, 0xdf, 0xbb, 0x46, 0xd8,
+    0x1e, 0x6f, 0x3e, 0x78, 0x69, 0x2d, 0x63, 0x4c,
+    0xd4, 0xf5, 0xd8, 0xe0, 0x7e, 0x10, 0x10, 0xd1,
+    0x18, 0x93, 0xac, 0x17, 0x42, 0x44, 0x8b, 0x89,
+    0x31, 0x3b, 0xc6, 0x49, 0x4a, 0x79, 0x4c, 0x8a,
+    0xb5, 0x56, 0x4a, 0x99, 0x34, 0x6e, 0x02, 0xe1,
+    0x9c, 0x23, 0x22, 0x21, 0x44, 0xf8, 0xde, 0xbe,
+    0xef, 0x23, 0x5f, 0x1f, 0xca, 0xdc, 0xf7, 0x7e,
+    0x39, 0xff, 0x8a, 0x78, 0x00, 0x51, 0xc0, 0x07,
+    0x6f, 0x2e, 0x33, 0x9b, 0xa6, 0x00, 0x00, 0x00,
+    0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60,
+    0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/D.png */
+const unsigned char letter_image_D[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x35, 0x32, 0x3a, 0x33,
+    0x39, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x35,
+    0x32, 0x3a, 0x33, 0x39, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x36, 0x37, 0x66, 0x66,
+    0x62, 0x35, 0x39, 0x62, 0x2d, 0x63, 0x63, 0x62,
+    0x64, 0x2d, 0x65, 0x63, 0x34, 0x61, 0x2d, 0x39,
+    0x61, 0x38, 0x37, 0x2d, 0x30, 0x62, 0x65, 0x66,
+    0x64, 0x37, 0x32, 0x65, 0x32, 0x66, 0x63, 0x33,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x39, 0x66, 0x36, 0x63, 0x62, 0x39,
+    0x32, 0x37, 0x2d, 0x38, 0x65, 0x36, 0x31, 0x2d,
+    0x35, 0x31, 0x34, 0x63, 0x2d, 0x61, 0x39, 0x65,
+    0x38, 0x2d, 0x66, 0x36, 0x64, 0x39, 0x38, 0x64,
+    0x63, 0x33, 0x34, 0x38, 0x30, 0x61, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x64, 0x63, 0x33, 0x33, 0x37, 0x34,
+    0x38, 0x36, 0x2d, 0x66, 0x62, 0x38, 0x38, 0x2d,
+    0x31, 0x61, 0x34, 0x36, 0x2d, 0x38, 0x61, 0x37,
+    0x31, 0x2d, 0x35, 0x38, 0x32, 0x61, 0x64, 0x66,
+    0x33, 0x34, 0x31, 0x31, 0x65, 0x35, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x32, 0x3a, 0x33, 0x39, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x36, 0x37, 0x66, 0x66, 0x62, 0x35,
+    0x39, 0x62, 0x2d, 0x63, 0x63, 0x62, 0x64, 0x2d,
+    0x65, 0x63, 0x34, 0x61, 0x2d, 0x39, 0x61, 0x38,
+    0x37, 0x2d, 0x30, 0x62, 0x65, 0x66, 0x64, 0x37,
+    0x32, 0x65, 0x32, 0x66, 0x63, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x32, 0x3a, 0x33, 0x39, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x64, 0x63, 0x33, 0x33,
+    0x37, 0x34, 0x38, 0x36, 0x2d, 0x66, 0x62, 0x38,
+    0x38, 0x2d, 0x31, 0x61, 0x34, 0x36, 0x2d, 0x38,
+    0x61, 0x37, 0x31, 0x2d, 0x35, 0x38, 0x32, 0x61,
+    0x64, 0x66, 0x33, 0x34, 0x31, 0x31, 0x65, 0x35,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0x40, 0x37, 0x40, 0xc2, 0x00, 0x00,
+    0x01, 0x01, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xc5, 0x94, 0x31, 0x8e, 0x85, 0x20, 0x10, 0x86,
+    0x7f, 0xdf, 0x19, 0x4c, 0x88, 0x67, 0xc0, 0x03,
+    0x58, 0x58, 0x58, 0x90, 0x78, 0x05, 0xee, 0xc0,
+    0x19, 0xac, 0xbc, 0x05, 0x5e, 0x80, 0x1b, 0xd8,
+    0x58, 0x98, 0xe8, 0x25, 0x4c, 0xe8, 0x85, 0xc4,
+    0x12, 0x6b, 0x5e, 0x41, 0xb2, 0xef, 0xad, 0xee,
+    0x7b, 0xeb, 0xb2, 0x9b, 0xec, 0xdf, 0x30, 0xcc,
+    0x0c, 0x5f, 0x98, 0x09, 0x43, 0xe2, 0xbd, 0xc7,
+    0xef, 0x74, 0x0b, 0xcb, 0xbe, 0xef, 0xc9, 0x6b,
+    0xe5, 0x79, 0xde, 0x75, 0x5d, 0xdf, 0xf7, 0x5f,
+    0x33, 0xfc, 0x93, 0xb4, 0xd6, 0x94, 0x52, 0x00,
+    0x4a, 0xa9, 0x0f, 0xa7, 0x31, 0x46, 0x4a, 0x19,
+    0x92, 0x39, 0xe7, 0x5a, 0x6b, 0xff, 0x59, 0x38,
+    0xec, 0x19, 0x63, 0x00, 0xa6, 0x69, 0x3a, 0xf8,
+    0x8d, 0x31, 0x9c, 0x73, 0x00, 0x94, 0x52, 0x63,
+    0xcc, 0x3b, 0x44, 0xc8, 0x3b, 0x23, 0x02, 0x25,
+    0xdc, 0x91, 0x73, 0xfe, 0xec, 0xbf, 0x5d, 0x6f,
+    0x1b, 0x21, 0xa4, 0x69, 0x9a, 0x50, 0xe6, 0x3c,
+    0xcf, 0xc7, 0x76, 0x5e, 0x54, 0x55, 0x55, 0xc1,
+    0x50, 0x4a, 0x45, 0x22, 0x08, 0x21, 0xa1, 0x59,
+    0xcb, 0xb2, 0x44, 0x22, 0x00, 0xa4, 0x69, 0x0a,
+    0x60, 0x5d, 0xd7, 0x78, 0xc4, 0x59, 0x3f, 0x46,
+    0x6c, 0xdb, 0x06, 0x20, 0xcb, 0xb2, 0x48, 0x84,
+    0xb5, 0x76, 0x18, 0x06, 0x00, 0x75, 0x5d, 0x47,
+    0x22, 0xc6, 0x71, 0x0c, 0x46, 0x51, 0x14, 0x31,
+    0x08, 0x6b, 0x6d, 0xdb, 0xb6, 0x00, 0x84, 0x10,
+    0x65, 0x59, 0x3e, 0x02, 0xd7, 0x1f, 0x78, 0x08,
+    0x71, 0xce, 0x9d, 0x73, 0x2f, 0x1f, 0xf8, 0xb7,
+    0x63, 0x26, 0x84, 0x38, 0x9c, 0x7f, 0x20, 0x9c,
+    0x73, 0x6f, 0x4a, 0x60, 0x8c, 0x49, 0x29, 0xcf,
+    0x33, 0x1a, 0x94, 0xf8, 0xbf, 0xfa, 0x72, 0xfe,
+    0x19, 0x71, 0x07, 0x4b, 0x61, 0x50, 0xf3, 0xaa,
+    0x6f, 0xe2, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x49,
+    0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/E.png */
+const unsigned char letter_image_E[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x35, 0x34, 0x3a, 0x33,
+    0x36, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x35,
+    0x34, 0x3a, 0x33, 0x36, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x65, 0x65, 0x35,
+    0x39, 0x36, 0x62, 0x33, 0x2d, 0x61, 0x36, 0x65,
+    0x38, 0x2d, 0x61, 0x39, 0x34, 0x62, 0x2d, 0x39,
+    0x30, 0x31, 0x31, 0x2d, 0x35, 0x36, 0x31, 0x31,
+    0x61, 0x36, 0x38, 0x35, 0x34, 0x37, 0x39, 0x61,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x31, 0x64, 0x64, 0x32, 0x63, 0x63,
+    0x36, 0x38, 0x2d, 0x34, 0x62, 0x30, 0x39, 0x2d,
+    0x35, 0x33, 0x34, 0x39, 0x2d, 0x61, 0x32, 0x39,
+    0x66, 0x2d, 0x36, 0x34, 0x37, 0x61, 0x31, 0x62,
+    0x35, 0x64, 0x32, 0x64, 0x37, 0x66, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x34, 0x33, 0x30, 0x38, 0x33, 0x34,
+    0x61, 0x34, 0x2d, 0x39, 0x31, 0x30, 0x37, 0x2d,
+    0x61, 0x39, 0x34, 0x32, 0x2d, 0x39, 0x31, 0x61,
+    0x65, 0x2d, 0x34, 0x38, 0x36, 0x61, 0x37, 0x63,
+    0x35, 0x39, 0x38, 0x32, 0x62, 0x61, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x34, 0x3a, 0x33, 0x36, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x37, 0x65, 0x65, 0x35, 0x39, 0x36,
+    0x62, 0x33, 0x2d, 0x61, 0x36, 0x65, 0x38, 0x2d,
+    0x61, 0x39, 0x34, 0x62, 0x2d, 0x39, 0x30, 0x31,
+    0x31, 0x2d, 0x35, 0x36, 0x31, 0x31, 0x61, 0x36,
+    0x38, 0x35, 0x34, 0x37, 0x39, 0x61, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x34, 0x3a, 0x33, 0x36, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x34, 0x33, 0x30, 0x38,
+    0x33, 0x34, 0x61, 0x34, 0x2d, 0x39, 0x31, 0x30,
+    0x37, 0x2d, 0x61, 0x39, 0x34, 0x32, 0x2d, 0x39,
+    0x31, 0x61, 0x65, 0x2d, 0x34, 0x38, 0x36, 0x61,
+    0x37, 0x63, 0x35, 0x39, 0x38, 0x32, 0x62, 0x61,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0x62, 0xf5, 0x51, 0x33, 0x00, 0x00,
+    0x00, 0xd0, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xc5, 0x54, 0xb1, 0x11, 0x84, 0x20, 0x10, 0x94,
+    0x9f, 0x0f, 0xcd, 0x2d, 0xc2, 0x90, 0x16, 0x8c,
+    0xa0, 0x01, 0x8a, 0xb0, 0x04, 0xad, 0x80, 0xd4,
+    0x88, 0x0a, 0xa4, 0x02, 0x7b, 0x30, 0x32, 0x31,
+    0xa3, 0x01, 0x22, 0x13, 0x8d, 0xef, 0x03, 0xe6,
+    0x3f, 0x38, 0xe0, 0x5e, 0xc7, 0x99, 0xff, 0x8d,
+    0x60, 0x0f, 0x76, 0xf6, 0xf6, 0x06, 0x18, 0x00,
+    0x14, 0x37, 0x01, 0x6f, 0x18, 0x63, 0xbe, 0x1e,
+    0x6e, 0x9a, 0x06, 0x22, 0x14, 0x68, 0x1f, 0x84,
+    0xea, 0xba, 0x8e, 0x8f, 0x6a, 0xad, 0x93, 0x3c,
+    0x96, 0x58, 0x96, 0x25, 0x27, 0x01, 0x00, 0x4a,
+    0xa9, 0x98, 0x7c, 0x20, 0xab, 0x65, 0x59, 0x12,
+    0x8d, 0x70, 0xce, 0xa9, 0x2c, 0x02, 0x9c, 0x73,
+    0x84, 0x8b, 0x24, 0xb0, 0x8b, 0x1c, 0xbc, 0xf7,
+    0xd6, 0xda, 0x64, 0xe9, 0xac, 0xc4, 0x30, 0x0c,
+    0xb9, 0xd2, 0x33, 0xc9, 0xae, 0xeb, 0xca, 0x18,
+    0x43, 0xe4, 0x38, 0x8e, 0x17, 0x5c, 0xc4, 0x59,
+    0x74, 0x5d, 0x97, 0x73, 0x71, 0xb6, 0x91, 0xb6,
+    0x6d, 0xb3, 0xb5, 0xdf, 0x4d, 0x84, 0xc0, 0x65,
+    0x89, 0xbe, 0xef, 0xbd, 0xf7, 0x94, 0xc4, 0xbe,
+    0xef, 0xc4, 0xfd, 0x69, 0x9a, 0xb6, 0x6d, 0xab,
+    0xaa, 0x8a, 0x92, 0x98, 0xe7, 0x39, 0x2c, 0x8e,
+    0xe3, 0x40, 0x25, 0x6b, 0xad, 0x10, 0x42, 0x4a,
+    0x89, 0x85, 0x3f, 0xa9, 0x9c, 0x79, 0xec, 0xc9,
+    0x98, 0x19, 0xdc, 0xfe, 0x72, 0xfe, 0x31, 0x91,
+    0x18, 0x2f, 0xed, 0x45, 0x5c, 0xa1, 0xad, 0x13,
+    0x5e, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
+    0x4e, 0x44, 0xae, 0x42, 0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/F.png */
+const unsigned char letter_image_F[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x35, 0x35, 0x3a, 0x31,
+    0x30, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x35,
+    0x35, 0x3a, 0x31, 0x30, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x31, 0x35, 0x36, 0x36,
+    0x37, 0x65, 0x38, 0x64, 0x2d, 0x64, 0x39, 0x30,
+    0x39, 0x2d, 0x65, 0x63, 0x34, 0x64, 0x2d, 0x61,
+    0x32, 0x65, 0x35, 0x2d, 0x65, 0x61, 0x63, 0x37,
+    0x62, 0x61, 0x66, 0x64, 0x38, 0x66, 0x62, 0x33,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x61, 0x37, 0x37, 0x38, 0x66, 0x63,
+    0x37, 0x30, 0x2d, 0x30, 0x34, 0x37, 0x38, 0x2d,
+    0x62, 0x66, 0x34, 0x35, 0x2d, 0x39, 0x39, 0x35,
+    0x30, 0x2d, 0x65, 0x30, 0x31, 0x34, 0x32, 0x66,
+    0x66, 0x30, 0x31, 0x31, 0x61, 0x38, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x31, 0x32, 0x39, 0x33, 0x37,
+    0x37, 0x36, 0x2d, 0x61, 0x63, 0x31, 0x64, 0x2d,
+    0x37, 0x65, 0x34, 0x34, 0x2d, 0x39, 0x39, 0x33,
+    0x66, 0x2d, 0x31, 0x31, 0x64, 0x33, 0x63, 0x65,
+    0x66, 0x38, 0x62, 0x39, 0x32, 0x35, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x35, 0x3a, 0x31, 0x30, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x35, 0x36, 0x36, 0x37, 0x65,
+    0x38, 0x64, 0x2d, 0x64, 0x39, 0x30, 0x39, 0x2d,
+    0x65, 0x63, 0x34, 0x64, 0x2d, 0x61, 0x32, 0x65,
+    0x35, 0x2d, 0x65, 0x61, 0x63, 0x37, 0x62, 0x61,
+    0x66, 0x64, 0x38, 0x66, 0x62, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x35, 0x3a, 0x31, 0x30, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x31, 0x31, 0x32, 0x39,
+    0x33, 0x37, 0x37, 0x36, 0x2d, 0x61, 0x63, 0x31,
+    0x64, 0x2d, 0x37, 0x65, 0x34, 0x34, 0x2d, 0x39,
+    0x39, 0x33, 0x66, 0x2d, 0x31, 0x31, 0x64, 0x33,
+    0x63, 0x65, 0x66, 0x38, 0x62, 0x39, 0x32, 0x35,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0x55, 0xb5, 0xed, 0xfe, 0x00, 0x00,
+    0x00, 0xc6, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xcd, 0x94, 0xbd, 0x0d, 0xc3, 0x20, 0x10, 0x46,
+    0x0f, 0x2b, 0x1d, 0x25, 0x23, 0x50, 0x5a, 0xee,
+    0x5d, 0xe0, 0x3d, 0x58, 0xc0, 0x15, 0x63, 0x50,
+    0x79, 0x06, 0x2f, 0xe0, 0x29, 0xdc, 0x9c, 0x77,
+    0xa0, 0xb1, 0x6b, 0x1a, 0x4a, 0x7a, 0x52, 0x44,
+    0x91, 0x88, 0xf1, 0x6f, 0x50, 0xa4, 0xbc, 0xf2,
+    0xe3, 0xd3, 0x13, 0xd2, 0xe9, 0x8e, 0x84, 0x10,
+    0x20, 0x93, 0x10, 0x31, 0xcf, 0xf3, 0x69, 0x5f,
+    0x4a, 0x19, 0x3e, 0x29, 0xe2, 0x67, 0xce, 0xf9,
+    0x4b, 0x54, 0x96, 0x25, 0x00, 0x0c, 0xc3, 0x10,
+    0x57, 0xbd, 0xf7, 0x4a, 0x29, 0xe7, 0xdc, 0x4a,
+    0x5a, 0x40, 0x02, 0xe7, 0xbc, 0xaa, 0xaa, 0x34,
+    0xa7, 0x94, 0x76, 0x5d, 0x97, 0xe6, 0x1b, 0x8a,
+    0x03, 0x28, 0xa5, 0x75, 0x5d, 0x67, 0x29, 0x00,
+    0x40, 0x6b, 0xfd, 0xbd, 0xa2, 0xef, 0xfb, 0xcd,
+    0xfc, 0xaa, 0x62, 0x9a, 0xa6, 0x71, 0x1c, 0x6f,
+    0x2b, 0xa4, 0x94, 0xe4, 0x4d, 0xd3, 0x34, 0x7b,
+    0xb5, 0x23, 0x45, 0x3c, 0x54, 0x44, 0x64, 0x8c,
+    0x6d, 0xd6, 0x1e, 0x07, 0x8a, 0x18, 0x21, 0x84,
+    0x31, 0xe6, 0xf6, 0x2f, 0x56, 0xb4, 0x6d, 0x9b,
+    0xab, 0xd8, 0xe3, 0x67, 0x8a, 0x74, 0x11, 0xee,
+    0x29, 0x96, 0x65, 0xb1, 0xd6, 0x02, 0x00, 0x22,
+    0x5e, 0x72, 0x9c, 0x2e, 0x7b, 0xba, 0xdd, 0x2b,
+    0x48, 0xfe, 0xc9, 0xf9, 0x8f, 0x89, 0x3c, 0x01,
+    0x34, 0x20, 0x96, 0xa9, 0x1d, 0x6a, 0xf1, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44,
+    0xae, 0x42, 0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/G.png */
+const unsigned char letter_image_G[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x35, 0x35, 0x3a, 0x33,
+    0x34, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x35,
+    0x35, 0x3a, 0x33, 0x34, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x61, 0x39, 0x33, 0x31,
+    0x34, 0x36, 0x37, 0x65, 0x2d, 0x36, 0x30, 0x64,
+    0x66, 0x2d, 0x30, 0x62, 0x34, 0x62, 0x2d, 0x38,
+    0x32, 0x64, 0x36, 0x2d, 0x36, 0x34, 0x63, 0x36,
+    0x31, 0x66, 0x34, 0x31, 0x35, 0x38, 0x31, 0x65,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x62, 0x65, 0x63, 0x30, 0x39, 0x66,
+    0x38, 0x32, 0x2d, 0x37, 0x37, 0x30, 0x63, 0x2d,
+    0x37, 0x62, 0x34, 0x37, 0x2d, 0x61, 0x36, 0x33,
+    0x31, 0x2d, 0x33, 0x30, 0x38, 0x39, 0x38, 0x39,
+    0x36, 0x64, 0x35, 0x31, 0x33, 0x64, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x32, 0x61, 0x35, 0x35, 0x30, 0x64,
+    0x61, 0x39, 0x2d, 0x36, 0x30, 0x37, 0x62, 0x2d,
+    0x66, 0x37, 0x34, 0x62, 0x2d, 0x38, 0x34, 0x38,
+    0x39, 0x2d, 0x31, 0x38, 0x61, 0x61, 0x35, 0x63,
+    0x66, 0x31, 0x65, 0x37, 0x33, 0x62, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x35, 0x3a, 0x33, 0x34, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x61, 0x39, 0x33, 0x31, 0x34, 0x36,
+    0x37, 0x65, 0x2d, 0x36, 0x30, 0x64, 0x66, 0x2d,
+    0x30, 0x62, 0x34, 0x62, 0x2d, 0x38, 0x32, 0x64,
+    0x36, 0x2d, 0x36, 0x34, 0x63, 0x36, 0x31, 0x66,
+    0x34, 0x31, 0x35, 0x38, 0x31, 0x65, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x35, 0x3a, 0x33, 0x34, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x32, 0x61, 0x35, 0x35,
+    0x30, 0x64, 0x61, 0x39, 0x2d, 0x36, 0x30, 0x37,
+    0x62, 0x2d, 0x66, 0x37, 0x34, 0x62, 0x2d, 0x38,
+    0x34, 0x38, 0x39, 0x2d, 0x31, 0x38, 0x61, 0x61,
+    0x35, 0x63, 0x66, 0x31, 0x65, 0x37, 0x33, 0x62,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0x66, 0xa9, 0x0b, 0x6b, 0x00, 0x00,
+    0x01, 0x42, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xbd, 0x94, 0x2b, 0x8e, 0xc3, 0x30, 0x10, 0x86,
+    0x7f, 0x2f, 0x2e, 0x0f, 0x2b, 0x69, 0x98, 0x7b,
+    0x80, 0xe2, 0xca, 0x77, 0x48, 0x0e, 0x50, 0xe6,
+    0x2b, 0xc4, 0x27, 0xc8, 0x0d, 0x9c, 0x0b, 0x24,
+    0xa8, 0x41, 0xc1, 0x95, 0x4c, 0x0a, 0x1b, 0x10,
+    0x56, 0x4b, 0x81, 0xa1, 0x91, 0xc2, 0x67, 0x81,
+    0x77, 0xb7, 0x79, 0x38, 0xdd, 0x97, 0x76, 0x3f,
+    0x64, 0x5b, 0x9e, 0x4f, 0x1e, 0xcf, 0xd8, 0x8c,
+    0x88, 0xf0, 0x3b, 0x5e, 0xbc, 0xab, 0xd6, 0xda,
+    0x2c, 0xcb, 0xd8, 0x08, 0xa5, 0x54, 0x51, 0x14,
+    0x00, 0x94, 0x52, 0x9f, 0x2b, 0x94, 0x52, 0x61,
+    0x18, 0xd6, 0x75, 0x5d, 0x55, 0x15, 0xbd, 0xb3,
+    0xdf, 0xef, 0xcb, 0xb2, 0x64, 0x8c, 0x5d, 0xaf,
+    0xd7, 0x79, 0x00, 0x4d, 0x91, 0x52, 0x02, 0xd0,
+    0x5a, 0x93, 0x0f, 0x29, 0x25, 0xe7, 0x7c, 0xb6,
+    0x38, 0x51, 0xa4, 0x69, 0x0a, 0x40, 0x4a, 0xe9,
+    0x8d, 0x27, 0xa2, 0x61, 0x18, 0x9e, 0x29, 0x8c,
+    0x31, 0xee, 0x5c, 0xb7, 0xdb, 0x6d, 0x4d, 0x41,
+    0x44, 0x5a, 0xeb, 0x61, 0x18, 0xfc, 0x8a, 0x24,
+    0x49, 0x00, 0x08, 0x21, 0x9e, 0xc4, 0x7b, 0x79,
+    0x5c, 0xe7, 0xf9, 0x7c, 0x06, 0x70, 0x38, 0x1c,
+    0x7e, 0x58, 0x54, 0x6b, 0x6d, 0xd3, 0x34, 0x00,
+    0xb6, 0xdb, 0xed, 0x72, 0x53, 0x51, 0x14, 0x6c,
+    0x81, 0xb5, 0xd6, 0x5f, 0xd4, 0xbe, 0xef, 0x97,
+    0x8a, 0x28, 0x8a, 0xdc, 0x2d, 0xb8, 0x69, 0x9a,
+    0xa6, 0x44, 0xb4, 0xdb, 0xed, 0x26, 0x8a, 0xcd,
+    0x66, 0xe3, 0x06, 0x6d, 0xdb, 0xae, 0x1d, 0xf8,
+    0x78, 0x3c, 0xba, 0xc1, 0x2c, 0xd9, 0x37, 0x45,
+    0x10, 0x04, 0x42, 0x08, 0x00, 0x97, 0xcb, 0x65,
+    0x4d, 0xb1, 0xc6, 0x23, 0x91, 0xd3, 0xe9, 0x04,
+    0xa0, 0x69, 0x1a, 0xd7, 0xc8, 0xdf, 0x60, 0x5c,
+    0x9e, 0x38, 0x8e, 0x01, 0x08, 0x21, 0x66, 0x95,
+    0x77, 0xdc, 0xef, 0x77, 0x17, 0x62, 0x8c, 0xf1,
+    0xf7, 0x05, 0x11, 0x75, 0x5d, 0xe7, 0xd2, 0x91,
+    0x52, 0x2e, 0x2d, 0x5f, 0x52, 0x38, 0x8b, 0x7b,
+    0x26, 0x9c, 0xf3, 0xf1, 0x4b, 0x31, 0xc6, 0xb8,
+    0xf6, 0xc7, 0xa2, 0x7d, 0xe7, 0x8a, 0x8f, 0x00,
+    0xad, 0x35, 0xe7, 0x7c, 0x9c, 0x72, 0x92, 0x24,
+    0x79, 0x9e, 0x2f, 0x37, 0x33, 0xfa, 0xa3, 0x2f,
+    0xe7, 0xbf, 0x15, 0xaf, 0xf6, 0x26, 0xf6, 0x70,
+    0xc6, 0x60, 0xea, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+    
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/H.png */
+const unsigned char letter_image_H[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4d,
+    0x41, 0x00, 0x00, 0xb1, 0x8f, 0x0b, 0xfc, 0x61,
+    0x05, 0x00, 0x00, 0x01, 0x84, 0x69, 0x43, 0x43,
+    0x50, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6f,
+    0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x28, 0x91,
+    0x7d, 0x91, 0x3d, 0x48, 0xc3, 0x50, 0x14, 0x85,
+    0x4f, 0x53, 0x8b, 0x22, 0x15, 0x05, 0x3b, 0x88,
+    0x38, 0x64, 0xa8, 0x4e, 0x16, 0x45, 0x45, 0x1c,
+    0xb5, 0x0a, 0x45, 0xa8, 0x10, 0x6a, 0x85, 0x56,
+    0x1d, 0x4c, 0x5e, 0xfa, 0x07, 0x4d, 0x1a, 0x92,
+    0x14, 0x17, 0x47, 0xc1, 0xb5, 0xe0, 0xe0, 0xcf,
+    0x62, 0xd5, 0xc1, 0xc5, 0x59, 0x57, 0x07, 0x57,
+    0x41, 0x10, 0xfc, 0x01, 0x71, 0x72, 0x74, 0x52,
+    0x74, 0x91, 0x12, 0xef, 0x4b, 0x0a, 0x2d, 0x62,
+    0x7c, 0x70, 0x79, 0x1f, 0xe7, 0xbd, 0x73, 0xb8,
+    0xef, 0x3e, 0x40, 0xa8, 0x97, 0x99, 0x66, 0x75,
+    0x8c, 0x03, 0x9a, 0x6e, 0x9b, 0xa9, 0x44, 0x5c,
+    0xcc, 0x64, 0x57, 0xc5, 0xce, 0x57, 0x04, 0x11,
+    0x42, 0x1f, 0xd5, 0x98, 0xcc, 0x2c, 0x63, 0x4e,
+    0x92, 0x92, 0xf0, 0x5d, 0x5f, 0xf7, 0x08, 0xf0,
+    0xfd, 0x2e, 0xc6, 0xb3, 0xfc, 0xef, 0xfd, 0xb9,
+    0x7a, 0xd4, 0x9c, 0xc5, 0x80, 0x80, 0x48, 0x3c,
+    0xcb, 0x0c, 0xd3, 0x26, 0xde, 0x20, 0x9e, 0xde,
+    0xb4, 0x0d, 0xce, 0xfb, 0xc4, 0x11, 0x56, 0x94,
+    0x55, 0xe2, 0x73, 0xe2, 0x51, 0x93, 0x1a, 0x24,
+    0x7e, 0xe4, 0xba, 0xe2, 0xf1, 0x1b, 0xe7, 0x82,
+    0xcb, 0x02, 0xcf, 0x8c, 0x98, 0xe9, 0xd4, 0x3c,
+    0x71, 0x84, 0x58, 0x2c, 0xb4, 0xb1, 0xd2, 0xc6,
+    0xac, 0x68, 0x6a, 0xc4, 0x53, 0xc4, 0x51, 0x55,
+    0xd3, 0x29, 0x5f, 0xc8, 0x78, 0xac, 0x72, 0xde,
+    0xe2, 0xac, 0x95, 0xab, 0xac, 0xd9, 0x27, 0x7f,
+    0x61, 0x38, 0xa7, 0xaf, 0x2c, 0x73, 0x9d, 0x6a,
+    0x08, 0x09, 0x2c, 0x62, 0x09, 0x12, 0x44, 0x28,
+    0xa8, 0xa2, 0x84, 0x32, 0x6c, 0xc4, 0x68, 0xd7,
+    0x49, 0xb1, 0x90, 0xa2, 0xf3, 0xb8, 0x8f, 0x7f,
+    0xd0, 0xf5, 0x4b, 0xe4, 0x52, 0xc8, 0x55, 0x02,
+    0x23, 0xc7, 0x02, 0x2a, 0xd0, 0x20, 0xbb, 0x7e,
+    0xf0, 0x3f, 0xf8, 0x3d, 0x5b, 0x2b, 0x3f, 0x39,
+    0xe1, 0x25, 0x85, 0xe3, 0x40, 0xe8, 0xc5, 0x71,
+    0x3e, 0x86, 0x81, 0xce, 0x5d, 0xa0, 0x51, 0x73,
+    0x9c, 0xef, 0x63, 0xc7, 0x69, 0x9c, 0x00, 0xc1,
+    0x67, 0xe0, 0x4a, 0x6f, 0xf9, 0x2b, 0x75, 0x60,
+    0xe6, 0x93, 0xf4, 0x5a, 0x4b, 0x8b, 0x1e, 0x01,
+    0xbd, 0xdb, 0xc0, 0xc5, 0x75, 0x4b, 0x53, 0xf6,
+    0x80, 0xcb, 0x1d, 0x60, 0xe0, 0xc9, 0x90, 0x4d,
+    0xd9, 0x95, 0x82, 0x54, 0x42, 0x3e, 0x0f, 0xbc,
+    0x9f, 0xd1, 0x37, 0x65, 0x81, 0xfe, 0x5b, 0xa0,
+    0x7b, 0xcd, 0x9b, 0x5b, 0xf3, 0x1c, 0xa7, 0x0f,
+    0x40, 0x9a, 0x66, 0x95, 0xbc, 0x01, 0x0e, 0x0e,
+    0x81, 0x91, 0x02, 0x65, 0xaf, 0xfb, 0xbc, 0xbb,
+    0xab, 0x7d, 0x6e, 0xff, 0xde, 0x69, 0xce, 0xef,
+    0x07, 0x27, 0xbb, 0x72, 0x89, 0x15, 0x1d, 0x09,
+    0x10, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4b, 0x47,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9,
+    0x43, 0xbb, 0x7f, 0x00, 0x00, 0x00, 0x09, 0x70,
+    0x48, 0x59, 0x73, 0x00, 0x00, 0x2e, 0x23, 0x00,
+    0x00, 0x2e, 0x23, 0x01, 0x78, 0xa5, 0x3f, 0x76,
+    0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45,
+    0x07, 0xe4, 0x03, 0x05, 0x10, 0x09, 0x26, 0x2e,
+    0x96, 0xe4, 0x12, 0x00, 0x00, 0x05, 0x47, 0x49,
+    0x44, 0x41, 0x54, 0x38, 0x11, 0x01, 0x3c, 0x05,
+    0xc3, 0xfa, 0x01, 0xff, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xa4, 0xa4, 0xa4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0xa4, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x7c, 0x7c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5,
+    0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xee, 0xee, 0xee, 0x71, 0x71, 0x71, 0x00, 0x00,
+    0x00, 0x76, 0x76, 0x76, 0xef, 0xef, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xfe, 0xfe, 0xe5, 0xe5, 0xe5, 0x4d, 0x4d,
+    0x4d, 0x00, 0x00, 0x00, 0x94, 0x94, 0x94, 0xf4,
+    0xf4, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x3e, 0x3e,
+    0x3e, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x10,
+    0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x1a, 0x1a,
+    0x1a, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x3a,
+    0x3a, 0x3a, 0x0b, 0x0b, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x04,
+    0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x00,
+    0x00, 0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x47, 0x47, 0x47, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xb9,
+    0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x94, 0x94, 0x94, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfa, 0xfa, 0xfa, 0x00,
+    0x00, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7,
+    0xf7, 0xf7, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0xfd,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf2, 0xf2, 0xf2, 0xc4,
+    0xc4, 0xc4, 0x00, 0x00, 0x00, 0xc2, 0xc2, 0xc2,
+    0xef, 0xef, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea,
+    0xea, 0xea, 0xbc, 0xbc, 0xbc, 0x00, 0x00, 0x00,
+    0xc7, 0xc7, 0xc7, 0xf5, 0xf5, 0xf5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xa4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4,
+    0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c,
+    0x7c, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xdd,
+    0xb4, 0x29, 0xac, 0x73, 0x37, 0xe3, 0x00, 0x00,
+    0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42,
+    0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/I.png */
+const unsigned char letter_image_I[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4d,
+    0x41, 0x00, 0x00, 0xb1, 0x8f, 0x0b, 0xfc, 0x61,
+    0x05, 0x00, 0x00, 0x01, 0x84, 0x69, 0x43, 0x43,
+    0x50, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6f,
+    0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x28, 0x91,
+    0x7d, 0x91, 0x3d, 0x48, 0xc3, 0x50, 0x14, 0x85,
+    0x4f, 0x53, 0x8b, 0x22, 0x15, 0x05, 0x3b, 0x88,
+    0x38, 0x64, 0xa8, 0x4e, 0x16, 0x45, 0x45, 0x1c,
+    0xb5, 0x0a, 0x45, 0xa8, 0x10, 0x6a, 0x85, 0x56,
+    0x1d, 0x4c, 0x5e, 0xfa, 0x07, 0x4d, 0x1a, 0x92,
+    0x14, 0x17, 0x47, 0xc1, 0xb5, 0xe0, 0xe0, 0xcf,
+    0x62, 0xd5, 0xc1, 0xc5, 0x59, 0x57, 0x07, 0x57,
+    0x41, 0x10, 0xfc, 0x01, 0x71, 0x72, 0x74, 0x52,
+    0x74, 0x91, 0x12, 0xef, 0x4b, 0x0a, 0x2d, 0x62,
+    0x7c, 0x70, 0x79, 0x1f, 0xe7, 0xbd, 0x73, 0xb8,
+    0xef, 0x3e, 0x40, 0xa8, 0x97, 0x99, 0x66, 0x75,
+    0x8c, 0x03, 0x9a, 0x6e, 0x9b, 0xa9, 0x44, 0x5c,
+    0xcc, 0x64, 0x57, 0xc5, 0xce, 0x57, 0x04, 0x11,
+    0x42, 0x1f, 0xd5, 0x98, 0xcc, 0x2c, 0x63, 0x4e,
+    0x92, 0x92, 0xf0, 0x5d, 0x5f, 0xf7, 0x08, 0xf0,
+    0xfd, 0x2e, 0xc6, 0xb3, 0xfc, 0xef, 0xfd, 0xb9,
+    0x7a, 0xd4, 0x9c, 0xc5, 0x80, 0x80, 0x48, 0x3c,
+    0xcb, 0x0c, 0xd3, 0x26, 0xde, 0x20, 0x9e, 0xde,
+    0xb4, 0x0d, 0xce, 0xfb, 0xc4, 0x11, 0x56, 0x94,
+    0x55, 0xe2, 0x73, 0xe2, 0x51, 0x93, 0x1a, 0x24,
+    0x7e, 0xe4, 0xba, 0xe2, 0xf1, 0x1b, 0xe7, 0x82,
+    0xcb, 0x02, 0xcf, 0x8c, 0x98, 0xe9, 0xd4, 0x3c,
+    0x71, 0x84, 0x58, 0x2c, 0xb4, 0xb1, 0xd2, 0xc6,
+    0xac, 0x68, 0x6a, 0xc4, 0x53, 0xc4, 0x51, 0x55,
+    0xd3, 0x29, 0x5f, 0xc8, 0x78, 0xac, 0x72, 0xde,
+    0xe2, 0xac, 0x95, 0xab, 0xac, 0xd9, 0x27, 0x7f,
+    0x61, 0x38, 0xa7, 0xaf, 0x2c, 0x73, 0x9d, 0x6a,
+    0x08, 0x09, 0x2c, 0x62, 0x09, 0x12, 0x44, 0x28,
+    0xa8, 0xa2, 0x84, 0x32, 0x6c, 0xc4, 0x68, 0xd7,
+    0x49, 0xb1, 0x90, 0xa2, 0xf3, 0xb8, 0x8f, 0x7f,
+    0xd0, 0xf5, 0x4b, 0xe4, 0x52, 0xc8, 0x55, 0x02,
+    0x23, 0xc7, 0x02, 0x2a, 0xd0, 0x20, 0xbb, 0x7e,
+    0xf0, 0x3f, 0xf8, 0x3d, 0x5b, 0x2b, 0x3f, 0x39,
+    0xe1, 0x25, 0x85, 0xe3, 0x40, 0xe8, 0xc5, 0x71,
+    0x3e, 0x86, 0x81, 0xce, 0x5d, 0xa0, 0x51, 0x73,
+    0x9c, 0xef, 0x63, 0xc7, 0x69, 0x9c, 0x00, 0xc1,
+    0x67, 0xe0, 0x4a, 0x6f, 0xf9, 0x2b, 0x75, 0x60,
+    0xe6, 0x93, 0xf4, 0x5a, 0x4b, 0x8b, 0x1e, 0x01,
+    0xbd, 0xdb, 0xc0, 0xc5, 0x75, 0x4b, 0x53, 0xf6,
+    0x80, 0xcb, 0x1d, 0x60, 0xe0, 0xc9, 0x90, 0x4d,
+    0xd9, 0x95, 0x82, 0x54, 0x42, 0x3e, 0x0f, 0xbc,
+    0x9f, 0xd1, 0x37, 0x65, 0x81, 0xfe, 0x5b, 0xa0,
+    0x7b, 0xcd, 0x9b, 0x5b, 0xf3, 0x1c, 0xa7, 0x0f,
+    0x40, 0x9a, 0x66, 0x95, 0xbc, 0x01, 0x0e, 0x0e,
+    0x81, 0x91, 0x02, 0x65, 0xaf, 0xfb, 0xbc, 0xbb,
+    0xab, 0x7d, 0x6e, 0xff, 0xde, 0x69, 0xce, 0xef,
+    0x07, 0x27, 0xbb, 0x72, 0x89, 0x15, 0x1d, 0x09,
+    0x10, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4b, 0x47,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9,
+    0x43, 0xbb, 0x7f, 0x00, 0x00, 0x00, 0x09, 0x70,
+    0x48, 0x59, 0x73, 0x00, 0x00, 0x2e, 0x23, 0x00,
+    0x00, 0x2e, 0x23, 0x01, 0x78, 0xa5, 0x3f, 0x76,
+    0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45,
+    0x07, 0xe4, 0x03, 0x05, 0x10, 0x0b, 0x0f, 0x5e,
+    0x12, 0x1e, 0xfc, 0x00, 0x00, 0x05, 0x47, 0x49,
+    0x44, 0x41, 0x54, 0x38, 0x11, 0x01, 0x3c, 0x05,
+    0xc3, 0xfa, 0x01, 0xff, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xc4,
+    0xc4, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x7d, 0x7d, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0x93,
+    0x93, 0x93, 0x00, 0x00, 0x00, 0x4d, 0x4d, 0x4d,
+    0xea, 0xea, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
+    0x0c, 0x0c, 0x39, 0x39, 0x39, 0x00, 0x00, 0x00,
+    0x43, 0x43, 0x43, 0x15, 0x15, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03,
+    0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfb, 0xfb, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0xfc,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf7, 0xf7, 0xf7, 0xc8, 0xc8, 0xc8, 0x00, 0x00,
+    0x00, 0xbe, 0xbe, 0xbe, 0xe7, 0xe7, 0xe7, 0xff,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xc3, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7c, 0x7c, 0x7c, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xf6,
+    0x8a, 0x86, 0xbe, 0xc8, 0x62, 0x8f, 0x00, 0x00,
+    0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42,
+    0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/J.png */
+const unsigned char letter_image_J[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4d,
+    0x41, 0x00, 0x00, 0xb1, 0x8f, 0x0b, 0xfc, 0x61,
+    0x05, 0x00, 0x00, 0x01, 0x84, 0x69, 0x43, 0x43,
+    0x50, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6f,
+    0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x28, 0x91,
+    0x7d, 0x91, 0x3d, 0x48, 0xc3, 0x50, 0x14, 0x85,
+    0x4f, 0x53, 0x8b, 0x22, 0x15, 0x05, 0x3b, 0x88,
+    0x38, 0x64, 0xa8, 0x4e, 0x16, 0x45, 0x45, 0x1c,
+    0xb5, 0x0a, 0x45, 0xa8, 0x10, 0x6a, 0x85, 0x56,
+    0x1d, 0x4c, 0x5e, 0xfa, 0x07, 0x4d, 0x1a, 0x92,
+    0x14, 0x17, 0x47, 0xc1, 0xb5, 0xe0, 0xe0, 0xcf,
+    0x62, 0xd5, 0xc1, 0xc5, 0x59, 0x57, 0x07, 0x57,
+    0x41, 0x10, 0xfc, 0x01, 0x71, 0x72, 0x74, 0x52,
+    0x74, 0x91, 0x12, 0xef, 0x4b, 0x0a, 0x2d, 0x62,
+    0x7c, 0x70, 0x79, 0x1f, 0xe7, 0xbd, 0x73, 0xb8,
+    0xef, 0x3e, 0x40, 0xa8, 0x97, 0x99, 0x66, 0x75,
+    0x8c, 0x03, 0x9a, 0x6e, 0x9b, 0xa9, 0x44, 0x5c,
+    0xcc, 0x64, 0x57, 0xc5, 0xce, 0x57, 0x04, 0x11,
+    0x42, 0x1f, 0xd5, 0x98, 0xcc, 0x2c, 0x63, 0x4e,
+    0x92, 0x92, 0xf0, 0x5d, 0x5f, 0xf7, 0x08, 0xf0,
+    0xfd, 0x2e, 0xc6, 0xb3, 0xfc, 0xef, 0xfd, 0xb9,
+    0x7a, 0xd4, 0x9c, 0xc5, 0x80, 0x80, 0x48, 0x3c,
+    0xcb, 0x0c, 0xd3, 0x26, 0xde, 0x20, 0x9e, 0xde,
+    0xb4, 0x0d, 0xce, 0xfb, 0xc4, 0x11, 0x56, 0x94,
+    0x55, 0xe2, 0x73, 0xe2, 0x51, 0x93, 0x1a, 0x24,
+    0x7e, 0xe4, 0xba, 0xe2, 0xf1, 0x1b, 0xe7, 0x82,
+    0xcb, 0x02, 0xcf, 0x8c, 0x98, 0xe9, 0xd4, 0x3c,
+    0x71, 0x84, 0x58, 0x2c, 0xb4, 0xb1, 0xd2, 0xc6,
+    0xac, 0x68, 0x6a, 0xc4, 0x53, 0xc4, 0x51, 0x55,
+    0xd3, 0x29, 0x5f, 0xc8, 0x78, 0xac, 0x72, 0xde,
+    0xe2, 0xac, 0x95, 0xab, 0xac, 0xd9, 0x27, 0x7f,
+    0x61, 0x38, 0xa7, 0xaf, 0x2c, 0x73, 0x9d, 0x6a,
+    0x08, 0x09, 0x2c, 0x62, 0x09, 0x12, 0x44, 0x28,
+    0xa8, 0xa2, 0x84, 0x32, 0x6c, 0xc4, 0x68, 0xd7,
+    0x49, 0xb1, 0x90, 0xa2, 0xf3, 0xb8, 0x8f, 0x7f,
+    0xd0, 0xf5, 0x4b, 0xe4, 0x52, 0xc8, 0x55, 0x02,
+    0x23, 0xc7, 0x02, 0x2a, 0xd0, 0x20, 0xbb, 0x7e,
+    0xf0, 0x3f, 0xf8, 0x3d, 0x5b, 0x2b, 0x3f, 0x39,
+    0xe1, 0x25, 0x85, 0xe3, 0x40, 0xe8, 0xc5, 0x71,
+    0x3e, 0x86, 0x81, 0xce, 0x5d, 0xa0, 0x51, 0x73,
+    0x9c, 0xef, 0x63, 0xc7, 0x69, 0x9c, 0x00, 0xc1,
+    0x67, 0xe0, 0x4a, 0x6f, 0xf9, 0x2b, 0x75, 0x60,
+    0xe6, 0x93, 0xf4, 0x5a, 0x4b, 0x8b, 0x1e, 0x01,
+    0xbd, 0xdb, 0xc0, 0xc5, 0x75, 0x4b, 0x53, 0xf6,
+    0x80, 0xcb, 0x1d, 0x60, 0xe0, 0xc9, 0x90, 0x4d,
+    0xd9, 0x95, 0x82, 0x54, 0x42, 0x3e, 0x0f, 0xbc,
+    0x9f, 0xd1, 0x37, 0x65, 0x81, 0xfe, 0x5b, 0xa0,
+    0x7b, 0xcd, 0x9b, 0x5b, 0xf3, 0x1c, 0xa7, 0x0f,
+    0x40, 0x9a, 0x66, 0x95, 0xbc, 0x01, 0x0e, 0x0e,
+    0x81, 0x91, 0x02, 0x65, 0xaf, 0xfb, 0xbc, 0xbb,
+    0xab, 0x7d, 0x6e, 0xff, 0xde, 0x69, 0xce, 0xef,
+    0x07, 0x27, 0xbb, 0x72, 0x89, 0x15, 0x1d, 0x09,
+    0x10, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4b, 0x47,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9,
+    0x43, 0xbb, 0x7f, 0x00, 0x00, 0x00, 0x09, 0x70,
+    0x48, 0x59, 0x73, 0x00, 0x00, 0x2e, 0x23, 0x00,
+    0x00, 0x2e, 0x23, 0x01, 0x78, 0xa5, 0x3f, 0x76,
+    0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45,
+    0x07, 0xe4, 0x03, 0x05, 0x10, 0x0c, 0x1c, 0x95,
+    0xed, 0xc9, 0xe5, 0x00, 0x00, 0x05, 0x47, 0x49,
+    0x44, 0x41, 0x54, 0x38, 0x11, 0x01, 0x3c, 0x05,
+    0xc3, 0xfa, 0x01, 0xff, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x78, 0x78, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xc6, 0xc6,
+    0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xfe, 0xfe, 0xe4, 0xe4, 0xe4, 0x49, 0x49, 0x49,
+    0x00, 0x00, 0x00, 0x95, 0x95, 0x95, 0xf7, 0xf7,
+    0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x1b, 0x1b, 0x1b,
+    0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x3a, 0x3a,
+    0x3a, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x00, 0x00,
+    0x00, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xdb, 0xdb, 0xdb, 0x4c, 0x4c, 0x4c,
+    0xd6, 0xd6, 0xd6, 0x00, 0x00, 0x00, 0xfd, 0xfd,
+    0xfd, 0x49, 0x49, 0x49, 0x16, 0x16, 0x16, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0xc0,
+    0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0xf2, 0xf2,
+    0xf2, 0x5a, 0x5a, 0x5a, 0xca, 0xca, 0xca, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf7, 0xf7, 0xf7, 0x8f, 0x8f, 0x8f, 0x35, 0x35,
+    0x35, 0x6c, 0x6c, 0x6c, 0xce, 0xce, 0xce, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x85,
+    0xc6, 0x36, 0x74, 0x66, 0x9d, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42,
+    0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/K.png */
+const unsigned char letter_image_K[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x35, 0x35, 0x3a, 0x35,
+    0x37, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x35,
+    0x35, 0x3a, 0x35, 0x37, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x35, 0x35, 0x65, 0x30,
+    0x31, 0x63, 0x34, 0x66, 0x2d, 0x65, 0x32, 0x65,
+    0x61, 0x2d, 0x62, 0x30, 0x34, 0x38, 0x2d, 0x38,
+    0x30, 0x65, 0x36, 0x2d, 0x65, 0x30, 0x39, 0x66,
+    0x36, 0x30, 0x32, 0x33, 0x35, 0x31, 0x65, 0x34,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x62, 0x30, 0x36, 0x38, 0x39, 0x36,
+    0x63, 0x66, 0x2d, 0x37, 0x63, 0x61, 0x64, 0x2d,
+    0x61, 0x65, 0x34, 0x62, 0x2d, 0x39, 0x31, 0x61,
+    0x65, 0x2d, 0x35, 0x38, 0x30, 0x65, 0x31, 0x32,
+    0x34, 0x65, 0x63, 0x62, 0x37, 0x63, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x32, 0x65, 0x37, 0x63, 0x32, 0x66,
+    0x65, 0x36, 0x2d, 0x38, 0x32, 0x34, 0x66, 0x2d,
+    0x30, 0x31, 0x34, 0x34, 0x2d, 0x38, 0x66, 0x66,
+    0x63, 0x2d, 0x35, 0x32, 0x30, 0x65, 0x30, 0x63,
+    0x62, 0x33, 0x31, 0x64, 0x61, 0x39, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x35, 0x3a, 0x35, 0x37, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x35, 0x35, 0x65, 0x30, 0x31, 0x63,
+    0x34, 0x66, 0x2d, 0x65, 0x32, 0x65, 0x61, 0x2d,
+    0x62, 0x30, 0x34, 0x38, 0x2d, 0x38, 0x30, 0x65,
+    0x36, 0x2d, 0x65, 0x30, 0x39, 0x66, 0x36, 0x30,
+    0x32, 0x33, 0x35, 0x31, 0x65, 0x34, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x35, 0x3a, 0x35, 0x37, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x32, 0x65, 0x37, 0x63,
+    0x32, 0x66, 0x65, 0x36, 0x2d, 0x38, 0x32, 0x34,
+    0x66, 0x2d, 0x30, 0x31, 0x34, 0x34, 0x2d, 0x38,
+    0x66, 0x66, 0x63, 0x2d, 0x35, 0x32, 0x30, 0x65,
+    0x30, 0x63, 0x62, 0x33, 0x31, 0x64, 0x61, 0x39,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0xff, 0x4f, 0x6c, 0x93, 0x00, 0x00,
+    0x01, 0x13, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xbd, 0x94, 0x31, 0x6e, 0x84, 0x30, 0x10, 0x45,
+    0x67, 0xa3, 0x5c, 0x80, 0x92, 0x6e, 0x7b, 0x17,
+    0x9c, 0x00, 0x09, 0x09, 0x7a, 0x28, 0x7d, 0x00,
+    0xa8, 0xec, 0x23, 0xb8, 0xa3, 0xa4, 0xa5, 0xe2,
+    0x02, 0xf8, 0x04, 0x54, 0x74, 0xe6, 0x18, 0x76,
+    0xcf, 0x01, 0x4c, 0x3d, 0x5b, 0x58, 0x59, 0x25,
+    0x80, 0xbd, 0x24, 0x2b, 0xe5, 0x77, 0xf0, 0xc7,
+    0x0f, 0xd0, 0xfc, 0xcf, 0x0d, 0x11, 0xe1, 0x4d,
+    0x21, 0x22, 0x22, 0x5a, 0x6b, 0x8f, 0xd6, 0x30,
+    0x0c, 0xce, 0xa5, 0x94, 0xee, 0x2c, 0xad, 0x35,
+    0x7e, 0x09, 0xf0, 0x9b, 0xb4, 0xd6, 0x84, 0x10,
+    0x00, 0x10, 0x42, 0xe0, 0x4f, 0x49, 0x29, 0x01,
+    0x80, 0x10, 0x22, 0xa5, 0xdc, 0x59, 0xb0, 0xbb,
+    0x76, 0x0f, 0x54, 0x4a, 0xed, 0xee, 0x33, 0xc6,
+    0x28, 0xa5, 0xd6, 0x5a, 0x3c, 0xe8, 0xf3, 0xca,
+    0xc7, 0x72, 0xce, 0x01, 0x60, 0x1c, 0xc7, 0x53,
+    0xf7, 0x23, 0x7c, 0x78, 0xdb, 0x36, 0xce, 0x79,
+    0x14, 0x45, 0x7d, 0xdf, 0xfb, 0x66, 0x42, 0x08,
+    0x63, 0x4c, 0x55, 0x55, 0x49, 0x92, 0xb4, 0x6d,
+    0x1b, 0x18, 0xf3, 0x22, 0x96, 0x65, 0x29, 0xcb,
+    0xb2, 0xae, 0xeb, 0xa6, 0x69, 0xc2, 0x6f, 0x7a,
+    0x8e, 0x90, 0x52, 0xa6, 0x69, 0x1a, 0xc7, 0x71,
+    0x96, 0x65, 0xe1, 0xf3, 0x5e, 0xc4, 0xfd, 0x7e,
+    0x27, 0x84, 0xcc, 0xf3, 0x9c, 0xe7, 0xb9, 0x31,
+    0xe6, 0x05, 0xc3, 0xb7, 0x54, 0xad, 0x75, 0x51,
+    0x14, 0x6e, 0x66, 0x9a, 0xa6, 0xe3, 0x2e, 0x2f,
+    0xe5, 0x62, 0x5d, 0xd7, 0x67, 0x2e, 0x8f, 0x89,
+    0xfa, 0x45, 0xb4, 0x18, 0x63, 0x8e, 0xd2, 0x75,
+    0xdd, 0x1f, 0x11, 0x88, 0x28, 0x84, 0x70, 0x94,
+    0x63, 0xf0, 0xaf, 0x22, 0x10, 0xb1, 0xeb, 0x3a,
+    0x1f, 0xe5, 0x6a, 0xcd, 0x94, 0x52, 0xcf, 0x0d,
+    0x30, 0xc6, 0x4e, 0x9a, 0x1a, 0x2e, 0xbb, 0xab,
+    0xa9, 0xcf, 0xbd, 0xe1, 0xdb, 0xbf, 0x9c, 0x17,
+    0x35, 0xfb, 0x27, 0xc4, 0x03, 0xf1, 0x09, 0xf4,
+    0xc4, 0x1b, 0xbd, 0x97, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60,
+    0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/L.png */
+const unsigned char letter_image_L[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x35, 0x36, 0x3a, 0x31,
+    0x36, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x35,
+    0x36, 0x3a, 0x31, 0x36, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x65, 0x63, 0x30, 0x38,
+    0x33, 0x39, 0x34, 0x37, 0x2d, 0x36, 0x31, 0x36,
+    0x36, 0x2d, 0x33, 0x63, 0x34, 0x34, 0x2d, 0x62,
+    0x66, 0x62, 0x63, 0x2d, 0x39, 0x63, 0x63, 0x37,
+    0x65, 0x65, 0x37, 0x65, 0x36, 0x30, 0x37, 0x33,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x30, 0x33, 0x64, 0x39, 0x61, 0x36,
+    0x31, 0x34, 0x2d, 0x38, 0x36, 0x34, 0x61, 0x2d,
+    0x34, 0x61, 0x34, 0x33, 0x2d, 0x38, 0x65, 0x39,
+    0x63, 0x2d, 0x65, 0x62, 0x31, 0x63, 0x63, 0x37,
+    0x33, 0x64, 0x38, 0x36, 0x30, 0x65, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x36, 0x38, 0x31, 0x36, 0x35, 0x33,
+    0x61, 0x64, 0x2d, 0x66, 0x32, 0x37, 0x36, 0x2d,
+    0x62, 0x32, 0x34, 0x36, 0x2d, 0x61, 0x62, 0x39,
+    0x30, 0x2d, 0x30, 0x65, 0x37, 0x37, 0x37, 0x38,
+    0x63, 0x66, 0x66, 0x64, 0x62, 0x35, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x36, 0x3a, 0x31, 0x36, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x65, 0x63, 0x30, 0x38, 0x33, 0x39,
+    0x34, 0x37, 0x2d, 0x36, 0x31, 0x36, 0x36, 0x2d,
+    0x33, 0x63, 0x34, 0x34, 0x2d, 0x62, 0x66, 0x62,
+    0x63, 0x2d, 0x39, 0x63, 0x63, 0x37, 0x65, 0x65,
+    0x37, 0x65, 0x36, 0x30, 0x37, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x36, 0x3a, 0x31, 0x36, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x36, 0x38, 0x31, 0x36,
+    0x35, 0x33, 0x61, 0x64, 0x2d, 0x66, 0x32, 0x37,
+    0x36, 0x2d, 0x62, 0x32, 0x34, 0x36, 0x2d, 0x61,
+    0x62, 0x39, 0x30, 0x2d, 0x30, 0x65, 0x37, 0x37,
+    0x37, 0x38, 0x63, 0x66, 0x66, 0x64, 0x62, 0x35,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0xea, 0xb6, 0xb7, 0x2a, 0x00, 0x00,
+    0x00, 0xaa, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xed, 0x94, 0xb1, 0x0d, 0xc3, 0x20, 0x10, 0x45,
+    0xbf, 0xdd, 0x52, 0xb9, 0xa2, 0x61, 0x03, 0x77,
+    0x4c, 0x80, 0x98, 0x82, 0x01, 0xbc, 0x0d, 0x23,
+    0xe0, 0x31, 0x18, 0xc0, 0x05, 0x0b, 0xb0, 0x85,
+    0xa9, 0x68, 0xa0, 0x26, 0x5d, 0x82, 0x8c, 0x65,
+    0xc7, 0x72, 0xa4, 0x48, 0x51, 0x5e, 0x77, 0x70,
+    0xf7, 0x74, 0xbf, 0x80, 0xae, 0x94, 0x82, 0x7b,
+    0xf4, 0x75, 0x91, 0x73, 0xee, 0xf6, 0x70, 0xce,
+    0x1d, 0x39, 0x4a, 0xc3, 0xba, 0xae, 0xe3, 0x38,
+    0x02, 0x50, 0x4a, 0xa5, 0x94, 0xda, 0x86, 0x0d,
+    0x7d, 0x2b, 0xa5, 0x94, 0x0a, 0x21, 0x00, 0x48,
+    0x29, 0x09, 0x21, 0xd7, 0x82, 0x3c, 0x19, 0x86,
+    0xe1, 0x74, 0xf2, 0x44, 0x71, 0x89, 0xbf, 0xe2,
+    0x17, 0x14, 0x39, 0x67, 0x63, 0xcc, 0x2d, 0x85,
+    0xb5, 0x96, 0x31, 0x76, 0xa2, 0x88, 0x31, 0x1e,
+    0xac, 0x30, 0xcf, 0x33, 0xe7, 0xfc, 0x48, 0x11,
+    0x42, 0x58, 0x96, 0x05, 0x80, 0xf7, 0x7e, 0x73,
+    0xe5, 0x9c, 0x9b, 0xa6, 0x09, 0x00, 0xa5, 0xf4,
+    0x75, 0x5a, 0xbf, 0xb9, 0x94, 0xd2, 0x1b, 0x39,
+    0xa0, 0xb5, 0xae, 0xa7, 0xba, 0x0f, 0x7f, 0x39,
+    0x5f, 0x53, 0x3c, 0x00, 0xab, 0xbb, 0x7e, 0x2c,
+    0x17, 0xa2, 0x70, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+    
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/M.png */
+const unsigned char letter_image_M[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x35, 0x36, 0x3a, 0x34,
+    0x30, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x35,
+    0x36, 0x3a, 0x34, 0x30, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x35, 0x64, 0x36, 0x30,
+    0x39, 0x62, 0x36, 0x61, 0x2d, 0x36, 0x62, 0x31,
+    0x30, 0x2d, 0x65, 0x66, 0x34, 0x37, 0x2d, 0x61,
+    0x30, 0x63, 0x31, 0x2d, 0x64, 0x31, 0x38, 0x62,
+    0x62, 0x65, 0x39, 0x39, 0x37, 0x66, 0x34, 0x37,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x36, 0x61, 0x38, 0x37, 0x38, 0x36,
+    0x36, 0x30, 0x2d, 0x62, 0x33, 0x32, 0x38, 0x2d,
+    0x34, 0x39, 0x34, 0x39, 0x2d, 0x61, 0x34, 0x61,
+    0x30, 0x2d, 0x37, 0x35, 0x32, 0x32, 0x36, 0x31,
+    0x66, 0x31, 0x64, 0x39, 0x39, 0x64, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x39, 0x35, 0x36, 0x30, 0x65, 0x31,
+    0x31, 0x32, 0x2d, 0x34, 0x66, 0x35, 0x61, 0x2d,
+    0x66, 0x61, 0x34, 0x63, 0x2d, 0x62, 0x63, 0x32,
+    0x35, 0x2d, 0x63, 0x32, 0x31, 0x33, 0x31, 0x63,
+    0x38, 0x63, 0x61, 0x31, 0x66, 0x34, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x36, 0x3a, 0x34, 0x30, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x35, 0x64, 0x36, 0x30, 0x39, 0x62,
+    0x36, 0x61, 0x2d, 0x36, 0x62, 0x31, 0x30, 0x2d,
+    0x65, 0x66, 0x34, 0x37, 0x2d, 0x61, 0x30, 0x63,
+    0x31, 0x2d, 0x64, 0x31, 0x38, 0x62, 0x62, 0x65,
+    0x39, 0x39, 0x37, 0x66, 0x34, 0x37, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x36, 0x3a, 0x34, 0x30, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x39, 0x35, 0x36, 0x30,
+    0x65, 0x31, 0x31, 0x32, 0x2d, 0x34, 0x66, 0x35,
+    0x61, 0x2d, 0x66, 0x61, 0x34, 0x63, 0x2d, 0x62,
+    0x63, 0x32, 0x35, 0x2d, 0x63, 0x32, 0x31, 0x33,
+    0x31, 0x63, 0x38, 0x63, 0x61, 0x31, 0x66, 0x34,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0xfc, 0x53, 0x07, 0x86, 0x00, 0x00,
+    0x01, 0x3d, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xad, 0x94, 0x3d, 0x8e, 0xc2, 0x30, 0x10, 0x85,
+    0x5f, 0x68, 0xb9, 0x00, 0x7d, 0x4a, 0x73, 0x00,
+    0x17, 0x94, 0x3e, 0x43, 0xe4, 0x92, 0x9e, 0x82,
+    0x0b, 0x84, 0x43, 0x50, 0xd0, 0x44, 0x54, 0xa9,
+    0x92, 0x1e, 0xc1, 0x01, 0x9c, 0x0b, 0xd0, 0x9b,
+    0x1b, 0xa4, 0xb4, 0xeb, 0xd9, 0x62, 0xa4, 0x91,
+    0x37, 0xe4, 0x67, 0xa5, 0xec, 0x54, 0xd6, 0x9b,
+    0x37, 0x99, 0x6f, 0x26, 0x4e, 0x32, 0x22, 0xc2,
+    0xba, 0xd8, 0x7c, 0x3e, 0x9f, 0x2c, 0x89, 0xcb,
+    0xe5, 0x32, 0x5f, 0x10, 0x63, 0xdc, 0xef, 0xf7,
+    0xe2, 0xef, 0xba, 0x0e, 0x44, 0x44, 0x44, 0x4d,
+    0xd3, 0x88, 0xc9, 0x7b, 0x4f, 0xd3, 0x51, 0x55,
+    0x15, 0xdb, 0x9a, 0xa6, 0x61, 0x05, 0x92, 0x53,
+    0x4a, 0x29, 0xa5, 0x00, 0x54, 0x55, 0x35, 0x55,
+    0x1f, 0x42, 0x60, 0x0f, 0x80, 0x10, 0x02, 0x8b,
+    0x9b, 0x14, 0xf2, 0x78, 0x3c, 0x02, 0xb8, 0x5e,
+    0xaf, 0x31, 0xc6, 0xd1, 0x29, 0x1e, 0x8f, 0x07,
+    0x7b, 0x7e, 0x45, 0x4a, 0xe1, 0xbd, 0x37, 0xc6,
+    0xcc, 0x80, 0x18, 0x63, 0xbc, 0xf7, 0x73, 0x14,
+    0x00, 0x8a, 0xa2, 0x60, 0x90, 0x6f, 0x84, 0xb6,
+    0x6d, 0xb5, 0xd6, 0xbb, 0xdd, 0x6e, 0x81, 0x42,
+    0xa6, 0x95, 0x6d, 0x0d, 0x10, 0x42, 0x08, 0x0b,
+    0x14, 0xdb, 0xed, 0xf6, 0x7c, 0x3e, 0x03, 0xb8,
+    0xdf, 0xef, 0xa9, 0xfe, 0x7a, 0xbd, 0xb4, 0xd6,
+    0x79, 0x9e, 0x8f, 0x6c, 0x68, 0x40, 0x41, 0x44,
+    0x32, 0xed, 0xf3, 0xf9, 0x94, 0xac, 0xb5, 0x96,
+    0xb3, 0xcb, 0x14, 0x00, 0xf2, 0x3c, 0x2f, 0xcb,
+    0x12, 0x40, 0x5d, 0xd7, 0xac, 0x74, 0x5d, 0xc7,
+    0xfa, 0x08, 0xc2, 0x28, 0x45, 0x0a, 0xe2, 0x9c,
+    0x63, 0x04, 0x3e, 0xfc, 0x95, 0x82, 0x1b, 0x9e,
+    0x4e, 0x27, 0x00, 0xb7, 0xdb, 0xed, 0xfd, 0x7e,
+    0x03, 0x38, 0x1c, 0x0e, 0xe3, 0x08, 0x53, 0x14,
+    0x44, 0xe4, 0x9c, 0x63, 0x43, 0x8a, 0xb0, 0x4c,
+    0x21, 0x69, 0x6e, 0x6b, 0xad, 0x05, 0xd0, 0xf7,
+    0xfd, 0x1c, 0x82, 0x50, 0x70, 0xcf, 0xc1, 0xa5,
+    0x64, 0x71, 0x70, 0x41, 0xe4, 0x83, 0x94, 0xf7,
+    0x05, 0xd9, 0x9c, 0x44, 0x5a, 0x63, 0xad, 0xfd,
+    0x1e, 0x2d, 0x0d, 0xe7, 0x5c, 0x46, 0xeb, 0x7f,
+    0x39, 0x2b, 0xeb, 0xff, 0xe7, 0x11, 0x3f, 0xe8,
+    0x86, 0xd1, 0xcc, 0xee, 0x27, 0xda, 0x89, 0x00,
+    0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae,
+    0x42, 0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/N.png */
+const unsigned char letter_image_N[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x35, 0x37, 0x3a, 0x30,
+    0x36, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x35,
+    0x37, 0x3a, 0x30, 0x36, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x65, 0x61, 0x33, 0x34,
+    0x39, 0x64, 0x66, 0x61, 0x2d, 0x38, 0x36, 0x65,
+    0x32, 0x2d, 0x61, 0x34, 0x34, 0x32, 0x2d, 0x38,
+    0x64, 0x35, 0x63, 0x2d, 0x35, 0x64, 0x39, 0x65,
+    0x36, 0x35, 0x65, 0x63, 0x36, 0x31, 0x65, 0x64,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x36, 0x31, 0x37, 0x31, 0x64, 0x30,
+    0x35, 0x38, 0x2d, 0x64, 0x31, 0x31, 0x62, 0x2d,
+    0x39, 0x33, 0x34, 0x31, 0x2d, 0x38, 0x33, 0x30,
+    0x65, 0x2d, 0x32, 0x61, 0x64, 0x32, 0x62, 0x32,
+    0x31, 0x34, 0x61, 0x31, 0x30, 0x35, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x38, 0x65, 0x65, 0x36, 0x63, 0x30,
+    0x34, 0x39, 0x2d, 0x31, 0x64, 0x30, 0x31, 0x2d,
+    0x62, 0x65, 0x34, 0x38, 0x2d, 0x38, 0x34, 0x35,
+    0x33, 0x2d, 0x61, 0x66, 0x61, 0x34, 0x33, 0x38,
+    0x33, 0x66, 0x32, 0x64, 0x33, 0x62, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x37, 0x3a, 0x30, 0x36, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x65, 0x61, 0x33, 0x34, 0x39, 0x64,
+    0x66, 0x61, 0x2d, 0x38, 0x36, 0x65, 0x32, 0x2d,
+    0x61, 0x34, 0x34, 0x32, 0x2d, 0x38, 0x64, 0x35,
+    0x63, 0x2d, 0x35, 0x64, 0x39, 0x65, 0x36, 0x35,
+    0x65, 0x63, 0x36, 0x31, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x37, 0x3a, 0x30, 0x36, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x38, 0x65, 0x65, 0x36,
+    0x63, 0x30, 0x34, 0x39, 0x2d, 0x31, 0x64, 0x30,
+    0x31, 0x2d, 0x62, 0x65, 0x34, 0x38, 0x2d, 0x38,
+    0x34, 0x35, 0x33, 0x2d, 0x61, 0x66, 0x61, 0x34,
+    0x33, 0x38, 0x33, 0x66, 0x32, 0x64, 0x33, 0x62,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0x81, 0x06, 0xab, 0x7c, 0x00, 0x00,
+    0x01, 0x26, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xad, 0x94, 0x3f, 0xae, 0x45, 0x40, 0x14, 0x87,
+    0x7f, 0x6e, 0x6e, 0x27, 0x61, 0x21, 0x53, 0xb0,
+    0x08, 0x8d, 0x4a, 0xab, 0x50, 0x8a, 0x48, 0x28,
+    0x29, 0x2d, 0x40, 0x68, 0x25, 0x37, 0x6c, 0x60,
+    0x74, 0x2a, 0x95, 0x6e, 0x14, 0x36, 0xa0, 0x63,
+    0x01, 0x16, 0xa0, 0xf6, 0x0a, 0xef, 0xcf, 0x3c,
+    0xe4, 0xde, 0xc7, 0x7d, 0x5f, 0xe7, 0xcc, 0xc9,
+    0x37, 0x27, 0x3f, 0x39, 0x23, 0x2c, 0xcb, 0x82,
+    0xf7, 0xb8, 0x01, 0x28, 0xcb, 0x52, 0xe0, 0x28,
+    0x8a, 0x62, 0xdf, 0x17, 0x45, 0x91, 0xf0, 0x9b,
+    0x71, 0x1c, 0x3f, 0xcf, 0x96, 0x2f, 0x18, 0x63,
+    0x9e, 0xe7, 0xad, 0x45, 0x4a, 0xe9, 0x72, 0x84,
+    0xe7, 0x79, 0x84, 0x90, 0x61, 0x18, 0xf8, 0x22,
+    0xf8, 0x0f, 0xc6, 0xd8, 0xf7, 0xb5, 0x8c, 0xb1,
+    0xbd, 0x82, 0x52, 0x6a, 0x9a, 0xe6, 0xa6, 0x78,
+    0xdb, 0x0c, 0x4c, 0x08, 0xd1, 0x34, 0x0d, 0x80,
+    0xeb, 0xba, 0x3f, 0xa3, 0xbe, 0xcc, 0x62, 0x43,
+    0x9a, 0xa6, 0x00, 0xfa, 0xbe, 0x37, 0x0c, 0x63,
+    0x9a, 0xa6, 0x2b, 0x0a, 0x45, 0x51, 0xea, 0xba,
+    0x5e, 0x2d, 0x96, 0x65, 0xcd, 0xf3, 0x7c, 0x5a,
+    0x01, 0x40, 0xd7, 0xf5, 0x24, 0x49, 0x00, 0x34,
+    0x4d, 0x63, 0xdb, 0xf6, 0x15, 0x05, 0x80, 0x20,
+    0x08, 0xd6, 0x1f, 0x44, 0x29, 0xf5, 0x7d, 0xff,
+    0x8a, 0x02, 0x40, 0x1c, 0xc7, 0x6b, 0xb4, 0x59,
+    0x96, 0xad, 0x01, 0x1d, 0x72, 0x7f, 0xa2, 0x10,
+    0x45, 0x31, 0x4d, 0x53, 0x55, 0x55, 0x01, 0x84,
+    0x61, 0x28, 0xcb, 0xb2, 0x24, 0x49, 0xe7, 0xa6,
+    0x00, 0x17, 0x2d, 0x00, 0xc7, 0x71, 0xaa, 0xaa,
+    0x3a, 0xad, 0x00, 0x17, 0x2d, 0x00, 0x4a, 0xe9,
+    0x15, 0x05, 0xb8, 0x68, 0x0f, 0xf9, 0x93, 0x02,
+    0x5c, 0xb4, 0x2f, 0x14, 0x5d, 0xd7, 0xf5, 0x7d,
+    0xdf, 0xb6, 0xed, 0xbe, 0x4f, 0x14, 0xc5, 0xc7,
+    0xe3, 0x41, 0x08, 0x39, 0x70, 0xac, 0xab, 0x92,
+    0xe7, 0xf9, 0xa6, 0x7e, 0xb8, 0x66, 0x75, 0x5d,
+    0xef, 0xd7, 0x0c, 0xfb, 0xbe, 0xe7, 0xec, 0xd5,
+    0xc2, 0xf2, 0x2f, 0xaf, 0xd6, 0x9b, 0x7c, 0x00,
+    0x41, 0xbe, 0x29, 0xde, 0x36, 0x99, 0x19, 0xf5,
+    0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44,
+    0xae, 0x42, 0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/P.png */
+const unsigned char letter_image_P[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x35, 0x38, 0x3a, 0x30,
+    0x35, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x35,
+    0x38, 0x3a, 0x30, 0x35, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x33, 0x34, 0x35, 0x31,
+    0x36, 0x30, 0x38, 0x36, 0x2d, 0x64, 0x39, 0x32,
+    0x36, 0x2d, 0x35, 0x31, 0x34, 0x30, 0x2d, 0x61,
+    0x30, 0x65, 0x62, 0x2d, 0x65, 0x39, 0x64, 0x38,
+    0x65, 0x36, 0x31, 0x61, 0x34, 0x63, 0x32, 0x34,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x32, 0x30, 0x33, 0x63, 0x38, 0x66,
+    0x35, 0x37, 0x2d, 0x35, 0x36, 0x65, 0x35, 0x2d,
+    0x38, 0x33, 0x34, 0x36, 0x2d, 0x38, 0x39, 0x61,
+    0x37, 0x2d, 0x39, 0x37, 0x38, 0x63, 0x65, 0x33,
+    0x33, 0x37, 0x66, 0x35, 0x64, 0x39, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x62, 0x62, 0x63, 0x64, 0x39,
+    0x61, 0x63, 0x2d, 0x32, 0x31, 0x64, 0x34, 0x2d,
+    0x65, 0x30, 0x34, 0x32, 0x2d, 0x39, 0x61, 0x64,
+    0x66, 0x2d, 0x30, 0x33, 0x32, 0x64, 0x38, 0x37,
+    0x31, 0x37, 0x37, 0x33, 0x32, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x38, 0x3a, 0x30, 0x35, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x33, 0x34, 0x35, 0x31, 0x36, 0x30,
+    0x38, 0x36, 0x2d, 0x64, 0x39, 0x32, 0x36, 0x2d,
+    0x35, 0x31, 0x34, 0x30, 0x2d, 0x61, 0x30, 0x65,
+    0x62, 0x2d, 0x65, 0x39, 0x64, 0x38, 0x65, 0x36,
+    0x31, 0x61, 0x34, 0x63, 0x32, 0x34, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x38, 0x3a, 0x30, 0x35, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x31, 0x62, 0x62, 0x63,
+    0x64, 0x39, 0x61, 0x63, 0x2d, 0x32, 0x31, 0x64,
+    0x34, 0x2d, 0x65, 0x30, 0x34, 0x32, 0x2d, 0x39,
+    0x61, 0x64, 0x66, 0x2d, 0x30, 0x33, 0x32, 0x64,
+    0x38, 0x37, 0x31, 0x37, 0x37, 0x33, 0x32, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0x7c, 0xed, 0xcb, 0x73, 0x00, 0x00,
+    0x00, 0xed, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xd5, 0x94, 0xc1, 0x09, 0x84, 0x30, 0x10, 0x00,
+    0xd7, 0xe3, 0x7e, 0xa2, 0x60, 0x1d, 0x11, 0x6c,
+    0x62, 0x6b, 0xd0, 0x58, 0x83, 0x96, 0x60, 0x07,
+    0x36, 0x20, 0x6a, 0x01, 0x29, 0xc2, 0x5f, 0x2a,
+    0x10, 0xfc, 0xf8, 0xf0, 0x1f, 0x5f, 0x3e, 0xf4,
+    0xbf, 0xf7, 0x08, 0xc8, 0x11, 0x83, 0x77, 0x78,
+    0x07, 0xc7, 0xcd, 0x6b, 0xb3, 0x2c, 0x43, 0x76,
+    0x97, 0xc4, 0x21, 0x22, 0xf8, 0x8c, 0x9b, 0x71,
+    0x0e, 0xc3, 0xd0, 0xb1, 0x91, 0xa6, 0x69, 0xd3,
+    0x34, 0x76, 0x07, 0x1d, 0x50, 0x4a, 0x31, 0xc6,
+    0x00, 0x40, 0x08, 0xa1, 0x33, 0x52, 0x4a, 0xce,
+    0x39, 0x00, 0x20, 0xa2, 0x52, 0xca, 0xa8, 0xb7,
+    0x28, 0x88, 0x28, 0xcb, 0xb2, 0x67, 0x05, 0x11,
+    0x6d, 0xdb, 0x86, 0x88, 0x00, 0xc0, 0x39, 0x37,
+    0x8a, 0xcd, 0x46, 0x34, 0x41, 0x10, 0x18, 0x19,
+    0xd7, 0x75, 0xe3, 0x38, 0xd6, 0xde, 0xbe, 0xef,
+    0xcf, 0x66, 0x71, 0x82, 0xef, 0xfb, 0x3a, 0x58,
+    0xd7, 0xf5, 0xa2, 0x62, 0xc7, 0xf3, 0xbc, 0x8b,
+    0x8a, 0xb6, 0x6d, 0x01, 0x00, 0x11, 0xa3, 0x28,
+    0x7a, 0x57, 0x31, 0x0c, 0x83, 0x0e, 0xa6, 0x69,
+    0xca, 0xf3, 0xbc, 0xeb, 0x3a, 0xc6, 0x58, 0x55,
+    0x55, 0x66, 0x9d, 0x75, 0x23, 0x45, 0x51, 0x1c,
+    0x8d, 0x65, 0x59, 0x1e, 0x37, 0x4a, 0x44, 0xf7,
+    0x93, 0x5b, 0x08, 0x21, 0x92, 0x24, 0x79, 0xd9,
+    0xe0, 0x95, 0x71, 0xfe, 0x91, 0x62, 0x59, 0x96,
+    0x8f, 0x14, 0xf3, 0x3c, 0x8f, 0xe3, 0x08, 0x00,
+    0x52, 0xca, 0xb7, 0x1c, 0xc6, 0x86, 0xf4, 0x1b,
+    0x7d, 0xa6, 0xae, 0x6b, 0xeb, 0xe2, 0x77, 0x1c,
+    0xfa, 0xfa, 0x97, 0xf3, 0x1b, 0xc5, 0x03, 0x82,
+    0x63, 0xf1, 0x38, 0xf9, 0x6f, 0x09, 0x9b, 0x00,
+    0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae,
+    0x42, 0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/Q.png */
+const unsigned char letter_image_Q[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x4b, 0xd6, 0xfb,
+    0x6c, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x35, 0x38, 0x3a, 0x34,
+    0x30, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x35,
+    0x38, 0x3a, 0x34, 0x30, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x30, 0x64, 0x38, 0x39,
+    0x32, 0x38, 0x37, 0x65, 0x2d, 0x62, 0x61, 0x30,
+    0x65, 0x2d, 0x33, 0x30, 0x34, 0x30, 0x2d, 0x38,
+    0x63, 0x33, 0x64, 0x2d, 0x64, 0x32, 0x61, 0x38,
+    0x61, 0x33, 0x66, 0x66, 0x66, 0x34, 0x37, 0x39,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x37, 0x63, 0x65, 0x33, 0x62, 0x30,
+    0x62, 0x33, 0x2d, 0x35, 0x62, 0x31, 0x34, 0x2d,
+    0x63, 0x63, 0x34, 0x32, 0x2d, 0x61, 0x36, 0x31,
+    0x38, 0x2d, 0x34, 0x36, 0x33, 0x62, 0x64, 0x64,
+    0x35, 0x37, 0x63, 0x32, 0x63, 0x39, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x62, 0x36, 0x65, 0x31, 0x38, 0x62,
+    0x35, 0x63, 0x2d, 0x38, 0x65, 0x66, 0x33, 0x2d,
+    0x62, 0x39, 0x34, 0x66, 0x2d, 0x61, 0x62, 0x61,
+    0x65, 0x2d, 0x62, 0x61, 0x32, 0x65, 0x61, 0x33,
+    0x66, 0x37, 0x63, 0x61, 0x39, 0x66, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x38, 0x3a, 0x34, 0x30, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x30, 0x64, 0x38, 0x39, 0x32, 0x38,
+    0x37, 0x65, 0x2d, 0x62, 0x61, 0x30, 0x65, 0x2d,
+    0x33, 0x30, 0x34, 0x30, 0x2d, 0x38, 0x63, 0x33,
+    0x64, 0x2d, 0x64, 0x32, 0x61, 0x38, 0x61, 0x33,
+    0x66, 0x66, 0x66, 0x34, 0x37, 0x39, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x38, 0x3a, 0x34, 0x30, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x62, 0x36, 0x65, 0x31,
+    0x38, 0x62, 0x35, 0x63, 0x2d, 0x38, 0x65, 0x66,
+    0x33, 0x2d, 0x62, 0x39, 0x34, 0x66, 0x2d, 0x61,
+    0x62, 0x61, 0x65, 0x2d, 0x62, 0x61, 0x32, 0x65,
+    0x61, 0x33, 0x66, 0x37, 0x63, 0x61, 0x39, 0x66,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0xae, 0x19, 0x1c, 0x2d, 0x00, 0x00,
+    0x01, 0x4a, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xa5, 0x94, 0xb1, 0x95, 0x83, 0x30, 0x0c, 0x86,
+    0x95, 0xab, 0x81, 0x94, 0xb4, 0xf4, 0xee, 0x98,
+    0x01, 0x76, 0x60, 0x07, 0x18, 0x81, 0x0d, 0xd8,
+    0x00, 0x16, 0x30, 0x0b, 0x50, 0xd1, 0xd1, 0x50,
+    0xf1, 0x18, 0xc0, 0x15, 0x95, 0x69, 0xc1, 0xbd,
+    0x52, 0x28, 0xe7, 0x10, 0x63, 0x9c, 0x7b, 0x97,
+    0xbf, 0xd2, 0x13, 0xf2, 0x27, 0x59, 0xb2, 0xb8,
+    0x21, 0x22, 0x7c, 0xa7, 0x1f, 0xab, 0xb7, 0x6d,
+    0xdb, 0xa2, 0x28, 0x6e, 0xbf, 0x4a, 0xd3, 0xb4,
+    0x69, 0x9a, 0x4b, 0x06, 0xbe, 0x4b, 0x4a, 0x99,
+    0x65, 0x19, 0x00, 0xd4, 0x75, 0xad, 0x9d, 0x9c,
+    0xf3, 0x24, 0x49, 0x18, 0x63, 0x5d, 0xd7, 0xe1,
+    0x49, 0x6f, 0x08, 0x29, 0x25, 0x85, 0x0a, 0x21,
+    0x8c, 0x38, 0xa5, 0x54, 0x92, 0x24, 0x00, 0xc0,
+    0x39, 0x77, 0x21, 0x28, 0xff, 0x39, 0x88, 0x34,
+    0x0c, 0x03, 0x15, 0x6e, 0x24, 0x78, 0x21, 0x38,
+    0xe7, 0x00, 0xc0, 0x18, 0x53, 0x4a, 0x59, 0x11,
+    0x88, 0x48, 0x85, 0xe4, 0x79, 0x6e, 0x47, 0x58,
+    0x3f, 0x1b, 0xaa, 0xaa, 0x8a, 0x0a, 0x91, 0x52,
+    0x6a, 0xe7, 0x73, 0x22, 0xeb, 0xba, 0xf6, 0x7d,
+    0x0f, 0x00, 0x51, 0x14, 0x39, 0xe6, 0xc7, 0x18,
+    0x23, 0x63, 0x9a, 0x26, 0x73, 0xa8, 0x4a, 0x29,
+    0x32, 0xee, 0xf7, 0xbb, 0x03, 0xe1, 0xfb, 0x3e,
+    0x19, 0xdb, 0xb6, 0x99, 0x88, 0x6f, 0xf4, 0x44,
+    0x78, 0x9e, 0x47, 0xc6, 0xb2, 0x2c, 0x8e, 0xe8,
+    0x7d, 0xdf, 0xc9, 0x08, 0x82, 0xc0, 0x44, 0x84,
+    0x61, 0x48, 0xf7, 0x1c, 0xc7, 0xd1, 0x81, 0xd0,
+    0xf5, 0xc7, 0x71, 0xfc, 0xf2, 0xba, 0xbb, 0x6d,
+    0x28, 0xcf, 0x73, 0x00, 0xc8, 0xb2, 0xcc, 0x3e,
+    0x54, 0xa5, 0x14, 0x15, 0x72, 0x7c, 0xda, 0x47,
+    0x09, 0x21, 0x28, 0xc7, 0x3c, 0xcf, 0x76, 0x04,
+    0x22, 0x76, 0x5d, 0x67, 0x0d, 0xa2, 0x04, 0x57,
+    0x6f, 0xd7, 0x5c, 0x33, 0x4d, 0x39, 0xaf, 0x99,
+    0xf5, 0xbc, 0x05, 0x41, 0x09, 0x75, 0x5f, 0xb4,
+    0xca, 0xb2, 0x3c, 0xef, 0xde, 0x25, 0x82, 0x44,
+    0x5b, 0x4b, 0xe7, 0x8d, 0xfe, 0xfd, 0x15, 0x81,
+    0x87, 0x7f, 0x07, 0x00, 0x54, 0x55, 0xf5, 0x1f,
+    0x04, 0xa9, 0x2c, 0x4b, 0x37, 0xe5, 0x33, 0x02,
+    0x11, 0x85, 0x10, 0xfa, 0x45, 0x7c, 0x9e, 0x88,
+    0x43, 0x52, 0xca, 0xba, 0xae, 0xe9, 0x6a, 0xc3,
+    0x30, 0x68, 0xff, 0x03, 0xa5, 0xcc, 0x44, 0xf9,
+    0x27, 0x48, 0x22, 0x96, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+    
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/R.png */
+const unsigned char letter_image_R[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x35, 0x39, 0x3a, 0x31,
+    0x38, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x35,
+    0x39, 0x3a, 0x31, 0x38, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x65, 0x63, 0x62, 0x33,
+    0x33, 0x32, 0x30, 0x61, 0x2d, 0x31, 0x66, 0x65,
+    0x63, 0x2d, 0x65, 0x61, 0x34, 0x38, 0x2d, 0x62,
+    0x37, 0x30, 0x30, 0x2d, 0x30, 0x66, 0x31, 0x35,
+    0x31, 0x34, 0x30, 0x31, 0x63, 0x36, 0x61, 0x30,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x64, 0x31, 0x35, 0x30, 0x64, 0x34,
+    0x61, 0x61, 0x2d, 0x31, 0x66, 0x64, 0x38, 0x2d,
+    0x65, 0x31, 0x34, 0x39, 0x2d, 0x38, 0x32, 0x62,
+    0x38, 0x2d, 0x38, 0x35, 0x36, 0x31, 0x38, 0x62,
+    0x66, 0x38, 0x32, 0x63, 0x30, 0x64, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x64, 0x37, 0x65, 0x64, 0x64, 0x38,
+    0x33, 0x38, 0x2d, 0x34, 0x61, 0x32, 0x39, 0x2d,
+    0x34, 0x61, 0x34, 0x66, 0x2d, 0x38, 0x39, 0x37,
+    0x38, 0x2d, 0x63, 0x64, 0x35, 0x62, 0x61, 0x39,
+    0x37, 0x66, 0x36, 0x35, 0x65, 0x66, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x39, 0x3a, 0x31, 0x38, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x65, 0x63, 0x62, 0x33, 0x33, 0x32,
+    0x30, 0x61, 0x2d, 0x31, 0x66, 0x65, 0x63, 0x2d,
+    0x65, 0x61, 0x34, 0x38, 0x2d, 0x62, 0x37, 0x30,
+    0x30, 0x2d, 0x30, 0x66, 0x31, 0x35, 0x31, 0x34,
+    0x30, 0x31, 0x63, 0x36, 0x61, 0x30, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x39, 0x3a, 0x31, 0x38, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x64, 0x37, 0x65, 0x64,
+    0x64, 0x38, 0x33, 0x38, 0x2d, 0x34, 0x61, 0x32,
+    0x39, 0x2d, 0x34, 0x61, 0x34, 0x66, 0x2d, 0x38,
+    0x39, 0x37, 0x38, 0x2d, 0x63, 0x64, 0x35, 0x62,
+    0x61, 0x39, 0x37, 0x66, 0x36, 0x35, 0x65, 0x66,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0x6d, 0x53, 0x1b, 0xbe, 0x00, 0x00,
+    0x01, 0x11, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xc5, 0x54, 0x31, 0x8e, 0x85, 0x20, 0x10, 0x1d,
+    0x7f, 0x6b, 0xe2, 0x31, 0x6c, 0x28, 0xbc, 0x04,
+    0x8d, 0xd1, 0x03, 0x90, 0x78, 0x04, 0x0e, 0x60,
+    0xe3, 0x0d, 0xf4, 0x04, 0xda, 0x59, 0x71, 0x00,
+    0x4b, 0x3b, 0x2f, 0x40, 0x63, 0xa1, 0x91, 0x9e,
+    0x5e, 0xac, 0xf9, 0x05, 0x89, 0x71, 0x51, 0x56,
+    0xff, 0xee, 0x26, 0xfb, 0xaa, 0x09, 0xf3, 0x78,
+    0x19, 0xde, 0xcc, 0xe0, 0x69, 0xad, 0xe1, 0x77,
+    0x78, 0xed, 0x91, 0x10, 0xc2, 0x73, 0xa3, 0x69,
+    0x1a, 0x21, 0xc4, 0xb5, 0x86, 0xfe, 0x8a, 0x65,
+    0x59, 0x10, 0x42, 0x00, 0x30, 0x0c, 0x83, 0x39,
+    0x91, 0x52, 0x52, 0x4a, 0x0d, 0x79, 0x3f, 0x3c,
+    0xc2, 0x96, 0xd0, 0x5a, 0x13, 0x42, 0xce, 0x6c,
+    0xa3, 0x82, 0x10, 0x52, 0x4a, 0x59, 0xfc, 0xd7,
+    0x75, 0x6d, 0x27, 0x24, 0x49, 0x02, 0x00, 0xe3,
+    0x38, 0x76, 0x5d, 0xe7, 0xf4, 0xe2, 0x7b, 0x84,
+    0x61, 0xe8, 0x4a, 0x3d, 0x95, 0x98, 0xe7, 0xd9,
+    0x04, 0x41, 0x10, 0xfc, 0x44, 0x62, 0xdb, 0xb6,
+    0xb6, 0x6d, 0x01, 0x00, 0x63, 0x1c, 0xc7, 0xb1,
+    0x9d, 0xbe, 0xb5, 0x93, 0x31, 0x86, 0x31, 0x06,
+    0x00, 0x42, 0x88, 0x94, 0xf2, 0x83, 0x8e, 0x1c,
+    0x41, 0x29, 0x65, 0x8c, 0x9d, 0x99, 0x37, 0x1d,
+    0x31, 0x55, 0x70, 0xce, 0x01, 0x60, 0x9a, 0xa6,
+    0x34, 0x4d, 0x5d, 0xcc, 0x1b, 0x2f, 0xa2, 0x28,
+    0x62, 0x8c, 0xf5, 0x7d, 0x9f, 0xe7, 0xb9, 0x93,
+    0xf4, 0x64, 0xb4, 0xcc, 0x5c, 0xb9, 0xde, 0xf2,
+    0x48, 0x42, 0x29, 0x65, 0x1c, 0xe5, 0x9c, 0x7f,
+    0xe0, 0xc5, 0xba, 0xae, 0x7b, 0xec, 0xfb, 0x7e,
+    0x55, 0x55, 0x00, 0x90, 0x65, 0xd9, 0xc5, 0xb2,
+    0x59, 0x92, 0xfb, 0x9a, 0x15, 0x45, 0x61, 0xa5,
+    0xca, 0xb2, 0x34, 0x57, 0xea, 0xba, 0x3e, 0x6e,
+    0x0a, 0x1c, 0x2f, 0x9f, 0x6b, 0xb1, 0x84, 0x8e,
+    0xfd, 0xde, 0x53, 0x9e, 0xfe, 0xc3, 0x2f, 0xe7,
+    0x3f, 0x25, 0xde, 0xf4, 0xde, 0xbe, 0x7e, 0x4c,
+    0x27, 0x6b, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x49,
+    0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/S.png */
+const unsigned char letter_image_S[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x35, 0x39, 0x3a, 0x34,
+    0x39, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x35,
+    0x39, 0x3a, 0x34, 0x39, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x32, 0x34, 0x61, 0x33,
+    0x37, 0x32, 0x33, 0x33, 0x2d, 0x35, 0x61, 0x32,
+    0x39, 0x2d, 0x34, 0x65, 0x34, 0x63, 0x2d, 0x62,
+    0x39, 0x34, 0x63, 0x2d, 0x30, 0x66, 0x39, 0x31,
+    0x36, 0x33, 0x65, 0x35, 0x62, 0x39, 0x38, 0x64,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x31, 0x38, 0x39, 0x38, 0x36, 0x38,
+    0x38, 0x39, 0x2d, 0x32, 0x38, 0x63, 0x32, 0x2d,
+    0x37, 0x65, 0x34, 0x37, 0x2d, 0x38, 0x36, 0x31,
+    0x32, 0x2d, 0x62, 0x30, 0x61, 0x38, 0x35, 0x61,
+    0x31, 0x65, 0x36, 0x64, 0x32, 0x64, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x35, 0x63, 0x31, 0x31, 0x66, 0x33,
+    0x34, 0x30, 0x2d, 0x31, 0x35, 0x35, 0x33, 0x2d,
+    0x32, 0x66, 0x34, 0x36, 0x2d, 0x62, 0x39, 0x66,
+    0x37, 0x2d, 0x38, 0x61, 0x35, 0x66, 0x31, 0x39,
+    0x64, 0x65, 0x61, 0x65, 0x36, 0x31, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x39, 0x3a, 0x34, 0x39, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x32, 0x34, 0x61, 0x33, 0x37, 0x32,
+    0x33, 0x33, 0x2d, 0x35, 0x61, 0x32, 0x39, 0x2d,
+    0x34, 0x65, 0x34, 0x63, 0x2d, 0x62, 0x39, 0x34,
+    0x63, 0x2d, 0x30, 0x66, 0x39, 0x31, 0x36, 0x33,
+    0x65, 0x35, 0x62, 0x39, 0x38, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x39, 0x3a, 0x34, 0x39, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x35, 0x63, 0x31, 0x31,
+    0x66, 0x33, 0x34, 0x30, 0x2d, 0x31, 0x35, 0x35,
+    0x33, 0x2d, 0x32, 0x66, 0x34, 0x36, 0x2d, 0x62,
+    0x39, 0x66, 0x37, 0x2d, 0x38, 0x61, 0x35, 0x66,
+    0x31, 0x39, 0x64, 0x65, 0x61, 0x65, 0x36, 0x31,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0x07, 0x5f, 0x5f, 0x40, 0x00, 0x00,
+    0x01, 0x21, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xbd, 0x94, 0x31, 0x6e, 0x85, 0x30, 0x0c, 0x86,
+    0x4d, 0x0f, 0xc0, 0xcc, 0x1d, 0x60, 0x42, 0x0c,
+    0x2c, 0x6c, 0x39, 0x00, 0x1b, 0x19, 0xd9, 0x73,
+    0x05, 0x18, 0xd8, 0x39, 0xc1, 0xe3, 0x02, 0x88,
+    0x03, 0x44, 0xca, 0x86, 0x04, 0xc7, 0x60, 0x27,
+    0xd9, 0xcd, 0xec, 0x37, 0x44, 0xcd, 0x40, 0x22,
+    0xb5, 0xb4, 0x6a, 0xff, 0xd1, 0x4e, 0x3e, 0xf9,
+    0x8f, 0xed, 0x44, 0x44, 0x04, 0xbf, 0xd3, 0x47,
+    0x30, 0x7a, 0x5d, 0xd7, 0x38, 0x8e, 0xd1, 0xa7,
+    0xfa, 0xbe, 0xdf, 0xf7, 0xdd, 0x18, 0x33, 0x4d,
+    0xd3, 0xb7, 0x10, 0xc6, 0x98, 0xba, 0xae, 0x95,
+    0x52, 0xdb, 0xb6, 0x11, 0x11, 0x11, 0x65, 0x59,
+    0x36, 0x0c, 0x43, 0x92, 0x24, 0xe1, 0x32, 0xc8,
+    0x13, 0xe7, 0x1c, 0x00, 0xdc, 0x7d, 0x2b, 0x44,
+    0xe4, 0x9c, 0xbf, 0x5e, 0x2f, 0xff, 0xfc, 0x1d,
+    0x81, 0x88, 0x16, 0xad, 0xb5, 0xbe, 0xa5, 0xa4,
+    0x94, 0x41, 0x44, 0xf8, 0x2d, 0x00, 0x60, 0x5d,
+    0xd7, 0x5b, 0x24, 0xcf, 0xf3, 0x67, 0x46, 0x00,
+    0xa0, 0xeb, 0x3a, 0x3f, 0xfb, 0xb5, 0x11, 0x22,
+    0xd2, 0x5a, 0xa7, 0x69, 0x6a, 0x29, 0x69, 0x9a,
+    0xce, 0xf3, 0xfc, 0x18, 0x61, 0x29, 0x42, 0x08,
+    0x57, 0x29, 0x63, 0x4c, 0x4a, 0xf9, 0x0c, 0x61,
+    0x25, 0xa5, 0x64, 0x8c, 0x39, 0x90, 0x10, 0x02,
+    0x11, 0x9f, 0x21, 0xac, 0xe6, 0x79, 0x76, 0x14,
+    0xce, 0xf9, 0x4f, 0x10, 0x44, 0x84, 0x88, 0xce,
+    0x97, 0xef, 0x28, 0x80, 0x08, 0x36, 0x9f, 0x88,
+    0xac, 0x29, 0x3f, 0x1b, 0x98, 0x8b, 0x65, 0x59,
+    0x82, 0xed, 0x2f, 0xcb, 0x12, 0x00, 0xe2, 0x38,
+    0xbe, 0xc5, 0x03, 0x88, 0xf3, 0x3c, 0xc7, 0x71,
+    0xf4, 0xe3, 0xc7, 0x71, 0x00, 0x40, 0x51, 0x14,
+    0xf7, 0x84, 0x5f, 0xb0, 0x1d, 0x0a, 0x21, 0x84,
+    0x5b, 0x13, 0xd7, 0xe3, 0xe0, 0x8c, 0x04, 0xaa,
+    0x68, 0xdb, 0x96, 0x88, 0xaa, 0xaa, 0x52, 0x4a,
+    0xd9, 0x65, 0xb7, 0x3b, 0xba, 0x6d, 0x5b, 0xd3,
+    0x34, 0xfe, 0xf9, 0x88, 0xfe, 0xe8, 0xcb, 0xf9,
+    0x6f, 0xc4, 0x1b, 0x8c, 0x3c, 0x5f, 0x9c, 0xe1,
+    0xd8, 0xa1, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x49,
+    0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/T.png */
+const unsigned char letter_image_T[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x38, 0x3a, 0x30, 0x30, 0x3a, 0x31,
+    0x30, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x38, 0x3a, 0x30,
+    0x30, 0x3a, 0x31, 0x30, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x66, 0x32, 0x63, 0x34,
+    0x36, 0x62, 0x33, 0x63, 0x2d, 0x65, 0x37, 0x35,
+    0x36, 0x2d, 0x61, 0x61, 0x34, 0x36, 0x2d, 0x62,
+    0x66, 0x36, 0x65, 0x2d, 0x35, 0x32, 0x30, 0x66,
+    0x36, 0x33, 0x32, 0x65, 0x37, 0x36, 0x31, 0x33,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x30, 0x35, 0x63, 0x66, 0x33, 0x35,
+    0x35, 0x36, 0x2d, 0x61, 0x38, 0x31, 0x65, 0x2d,
+    0x64, 0x33, 0x34, 0x65, 0x2d, 0x61, 0x39, 0x61,
+    0x64, 0x2d, 0x65, 0x64, 0x64, 0x62, 0x39, 0x63,
+    0x35, 0x36, 0x35, 0x36, 0x35, 0x32, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x39, 0x38, 0x66, 0x34, 0x31, 0x35,
+    0x62, 0x32, 0x2d, 0x66, 0x66, 0x39, 0x37, 0x2d,
+    0x66, 0x30, 0x34, 0x33, 0x2d, 0x39, 0x38, 0x37,
+    0x36, 0x2d, 0x31, 0x33, 0x66, 0x65, 0x38, 0x61,
+    0x62, 0x33, 0x31, 0x34, 0x61, 0x61, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x30, 0x3a, 0x31, 0x30, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x66, 0x32, 0x63, 0x34, 0x36, 0x62,
+    0x33, 0x63, 0x2d, 0x65, 0x37, 0x35, 0x36, 0x2d,
+    0x61, 0x61, 0x34, 0x36, 0x2d, 0x62, 0x66, 0x36,
+    0x65, 0x2d, 0x35, 0x32, 0x30, 0x66, 0x36, 0x33,
+    0x32, 0x65, 0x37, 0x36, 0x31, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x30, 0x3a, 0x31, 0x30, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x39, 0x38, 0x66, 0x34,
+    0x31, 0x35, 0x62, 0x32, 0x2d, 0x66, 0x66, 0x39,
+    0x37, 0x2d, 0x66, 0x30, 0x34, 0x33, 0x2d, 0x39,
+    0x38, 0x37, 0x36, 0x2d, 0x31, 0x33, 0x66, 0x65,
+    0x38, 0x61, 0x62, 0x33, 0x31, 0x34, 0x61, 0x61,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0x8a, 0xb2, 0xed, 0x2d, 0x00, 0x00,
+    0x00, 0x9e, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0x63, 0xfc, 0xff, 0xff, 0x3f, 0x03, 0x85, 0xe0,
+    0x3f, 0x12, 0xb8, 0x73, 0xe7, 0x0e, 0x31, 0x5a,
+    0xb4, 0xb5, 0xb5, 0x91, 0x75, 0x31, 0x61, 0x4a,
+    0x1f, 0x3e, 0x7c, 0x18, 0x2e, 0x1d, 0x11, 0x11,
+    0xc1, 0xc0, 0xc0, 0xb0, 0x62, 0xc5, 0x0a, 0xb8,
+    0xc8, 0xac, 0x59, 0xb3, 0xae, 0x5e, 0xbd, 0xfa,
+    0xf5, 0xeb, 0x57, 0xb8, 0x16, 0x16, 0x64, 0xfd,
+    0xcf, 0x9f, 0x3f, 0xaf, 0xad, 0xad, 0xb5, 0xb1,
+    0xb1, 0xc1, 0xe3, 0x84, 0xd4, 0xd4, 0xd4, 0x47,
+    0x8f, 0x1e, 0x21, 0x8b, 0xa0, 0x18, 0xa1, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x4a, 0xd0, 0x23, 0x09,
+    0x09, 0x09, 0x38, 0x8d, 0x10, 0x17, 0x17, 0x27,
+    0xa8, 0x9f, 0x81, 0x81, 0x41, 0x59, 0x59, 0x19,
+    0x99, 0x8b, 0x1e, 0x16, 0x64, 0x80, 0x51, 0x23,
+    0x46, 0x8d, 0x20, 0xd5, 0x88, 0xbb, 0x77, 0xef,
+    0x5e, 0xbe, 0x7c, 0x99, 0x81, 0x81, 0xe1, 0xf0,
+    0xe1, 0xc3, 0xf8, 0xcc, 0xf8, 0x8f, 0x0d, 0x60,
+    0xcd, 0xf5, 0x11, 0x11, 0x11, 0x58, 0x15, 0x33,
+    0x52, 0x5e, 0xe4, 0x0c, 0x8e, 0xe0, 0x04, 0x00,
+    0xee, 0x21, 0x80, 0x30, 0x86, 0xdd, 0x85, 0x21,
+    0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44,
+    0xae, 0x42, 0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/U.png */
+const unsigned char letter_image_U[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x38, 0x3a, 0x30, 0x30, 0x3a, 0x32,
+    0x37, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x38, 0x3a, 0x30,
+    0x30, 0x3a, 0x32, 0x37, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x32, 0x62, 0x30, 0x66,
+    0x66, 0x65, 0x33, 0x37, 0x2d, 0x39, 0x66, 0x31,
+    0x31, 0x2d, 0x36, 0x62, 0x34, 0x36, 0x2d, 0x61,
+    0x37, 0x39, 0x36, 0x2d, 0x34, 0x61, 0x62, 0x30,
+    0x39, 0x30, 0x30, 0x35, 0x35, 0x30, 0x63, 0x31,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x32, 0x37, 0x34, 0x35, 0x66, 0x38,
+    0x36, 0x64, 0x2d, 0x37, 0x62, 0x30, 0x36, 0x2d,
+    0x66, 0x35, 0x34, 0x33, 0x2d, 0x38, 0x38, 0x35,
+    0x61, 0x2d, 0x36, 0x66, 0x36, 0x39, 0x65, 0x33,
+    0x32, 0x30, 0x62, 0x34, 0x33, 0x35, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x38, 0x61, 0x38, 0x61, 0x64, 0x30,
+    0x37, 0x36, 0x2d, 0x30, 0x62, 0x36, 0x36, 0x2d,
+    0x62, 0x65, 0x34, 0x62, 0x2d, 0x62, 0x37, 0x64,
+    0x34, 0x2d, 0x62, 0x61, 0x65, 0x33, 0x63, 0x62,
+    0x31, 0x31, 0x31, 0x66, 0x31, 0x31, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x30, 0x3a, 0x32, 0x37, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x32, 0x62, 0x30, 0x66, 0x66, 0x65,
+    0x33, 0x37, 0x2d, 0x39, 0x66, 0x31, 0x31, 0x2d,
+    0x36, 0x62, 0x34, 0x36, 0x2d, 0x61, 0x37, 0x39,
+    0x36, 0x2d, 0x34, 0x61, 0x62, 0x30, 0x39, 0x30,
+    0x30, 0x35, 0x35, 0x30, 0x63, 0x31, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x30, 0x3a, 0x32, 0x37, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x38, 0x61, 0x38, 0x61,
+    0x64, 0x30, 0x37, 0x36, 0x2d, 0x30, 0x62, 0x36,
+    0x36, 0x2d, 0x62, 0x65, 0x34, 0x62, 0x2d, 0x62,
+    0x37, 0x64, 0x34, 0x2d, 0x62, 0x61, 0x65, 0x33,
+    0x63, 0x62, 0x31, 0x31, 0x31, 0x66, 0x31, 0x31,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0xaa, 0xf3, 0xf4, 0xe2, 0x00, 0x00,
+    0x00, 0xc3, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xed, 0x54, 0xb1, 0x0d, 0x83, 0x30, 0x10, 0x7c,
+    0xd2, 0x22, 0x4f, 0xe2, 0x82, 0x15, 0x28, 0x3c,
+    0x84, 0x77, 0xf8, 0x15, 0x3c, 0x89, 0x27, 0xf8,
+    0x09, 0xbc, 0x00, 0x23, 0xd0, 0x50, 0x98, 0x2d,
+    0xe8, 0x2f, 0x05, 0x0a, 0x32, 0x8f, 0x51, 0x24,
+    0x48, 0xa4, 0x14, 0xb9, 0xce, 0xf7, 0xfa, 0xf3,
+    0x59, 0xba, 0x73, 0x03, 0x80, 0x6e, 0x02, 0x00,
+    0x80, 0x61, 0x18, 0x8e, 0x23, 0x11, 0xc1, 0x0b,
+    0xcb, 0xb2, 0xa8, 0x69, 0x08, 0x61, 0x1d, 0x11,
+    0x0a, 0x88, 0xc8, 0x71, 0xb9, 0x44, 0xce, 0xd9,
+    0x5a, 0xcb, 0xcc, 0x25, 0xb9, 0x93, 0xd8, 0xae,
+    0xca, 0x39, 0x57, 0x25, 0x00, 0x78, 0xef, 0x53,
+    0x4a, 0x25, 0xf3, 0xb8, 0xf0, 0x76, 0x63, 0x4c,
+    0x79, 0xbc, 0x22, 0xa1, 0xf0, 0x97, 0xf8, 0x9e,
+    0x44, 0xdb, 0xb6, 0xd6, 0xda, 0xcf, 0xb8, 0x38,
+    0xc6, 0x79, 0xc3, 0x38, 0x8e, 0x6f, 0x72, 0xd1,
+    0xf7, 0x3d, 0x11, 0x4d, 0xd3, 0x54, 0xdd, 0x9f,
+    0xe7, 0x99, 0x88, 0xba, 0xae, 0xdb, 0xb1, 0x2a,
+    0xbf, 0x6b, 0xdf, 0x9c, 0x73, 0xd5, 0x74, 0x33,
+    0x73, 0x8c, 0x51, 0x91, 0x5a, 0x02, 0x40, 0x8c,
+    0x91, 0x88, 0x54, 0x17, 0x44, 0xc4, 0x39, 0xa7,
+    0x0a, 0x76, 0x2a, 0xb1, 0x7a, 0x09, 0x21, 0x94,
+    0x66, 0x99, 0xf9, 0xac, 0xbe, 0x0d, 0x6e, 0x7f,
+    0x39, 0xbf, 0x11, 0xad, 0x27, 0x2e, 0xb6, 0x3d,
+    0x61, 0x23, 0x1c, 0x11, 0xcc, 0x00, 0x00, 0x00,
+    0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60,
+    0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/V.png */
+const unsigned char letter_image_V[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x8d, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x38, 0x3a, 0x30, 0x31, 0x2b, 0x30,
+    0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x78, 0x6d,
+    0x70, 0x3a, 0x4d, 0x6f, 0x64, 0x69, 0x66, 0x79,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x38, 0x3a, 0x30, 0x31, 0x2b, 0x30,
+    0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x70, 0x68,
+    0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a,
+    0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64,
+    0x65, 0x3d, 0x22, 0x33, 0x22, 0x20, 0x70, 0x68,
+    0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a,
+    0x49, 0x43, 0x43, 0x50, 0x72, 0x6f, 0x66, 0x69,
+    0x6c, 0x65, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x52, 0x47, 0x42, 0x20, 0x28, 0x31,
+    0x39, 0x39, 0x38, 0x29, 0x22, 0x20, 0x64, 0x63,
+    0x3a, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d,
+    0x22, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70,
+    0x6e, 0x67, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d,
+    0x4d, 0x3a, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e,
+    0x63, 0x65, 0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d,
+    0x70, 0x2e, 0x69, 0x69, 0x64, 0x3a, 0x39, 0x34,
+    0x65, 0x63, 0x37, 0x37, 0x30, 0x35, 0x2d, 0x66,
+    0x66, 0x37, 0x39, 0x2d, 0x33, 0x61, 0x34, 0x39,
+    0x2d, 0x61, 0x65, 0x35, 0x62, 0x2d, 0x37, 0x62,
+    0x31, 0x33, 0x34, 0x37, 0x34, 0x32, 0x63, 0x33,
+    0x66, 0x65, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d,
+    0x4d, 0x3a, 0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+    0x6e, 0x74, 0x49, 0x44, 0x3d, 0x22, 0x61, 0x64,
+    0x6f, 0x62, 0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69,
+    0x64, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x38, 0x63, 0x64, 0x36,
+    0x61, 0x33, 0x30, 0x64, 0x2d, 0x30, 0x32, 0x64,
+    0x39, 0x2d, 0x63, 0x37, 0x34, 0x37, 0x2d, 0x39,
+    0x37, 0x65, 0x38, 0x2d, 0x32, 0x65, 0x34, 0x64,
+    0x36, 0x30, 0x31, 0x34, 0x62, 0x32, 0x63, 0x37,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f,
+    0x72, 0x69, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69,
+    0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x74,
+    0x69, 0x66, 0x66, 0x3a, 0x58, 0x52, 0x65, 0x73,
+    0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x37, 0x32, 0x30, 0x30, 0x30, 0x30, 0x2f,
+    0x31, 0x30, 0x30, 0x30, 0x30, 0x22, 0x20, 0x74,
+    0x69, 0x66, 0x66, 0x3a, 0x59, 0x52, 0x65, 0x73,
+    0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x37, 0x32, 0x30, 0x30, 0x30, 0x30, 0x2f,
+    0x31, 0x30, 0x30, 0x30, 0x30, 0x22, 0x20, 0x74,
+    0x69, 0x66, 0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f,
+    0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e,
+    0x69, 0x74, 0x3d, 0x22, 0x32, 0x22, 0x20, 0x65,
+    0x78, 0x69, 0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f,
+    0x72, 0x53, 0x70, 0x61, 0x63, 0x65, 0x3d, 0x22,
+    0x36, 0x35, 0x35, 0x33, 0x35, 0x22, 0x20, 0x65,
+    0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78, 0x65,
+    0x6c, 0x58, 0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73,
+    0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30,
+    0x22, 0x20, 0x65, 0x78, 0x69, 0x66, 0x3a, 0x50,
+    0x69, 0x78, 0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d,
+    0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22,
+    0x32, 0x30, 0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68,
+    0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a,
+    0x54, 0x65, 0x78, 0x74, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x73, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x42, 0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72,
+    0x64, 0x66, 0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68,
+    0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a,
+    0x4c, 0x61, 0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d,
+    0x65, 0x3d, 0x22, 0x20, 0x41, 0x20, 0x42, 0x20,
+    0x43, 0x20, 0x44, 0x20, 0x45, 0x20, 0x46, 0x20,
+    0x47, 0x20, 0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20,
+    0x4e, 0x20, 0x4f, 0x20, 0x50, 0x20, 0x51, 0x20,
+    0x52, 0x20, 0x53, 0x20, 0x54, 0x20, 0x55, 0x20,
+    0x56, 0x20, 0x57, 0x20, 0x58, 0x20, 0x59, 0x20,
+    0x5a, 0x20, 0x30, 0x20, 0x31, 0x20, 0x32, 0x20,
+    0x33, 0x20, 0x34, 0x20, 0x35, 0x20, 0x36, 0x20,
+    0x37, 0x20, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x54, 0x65, 0x78, 0x74, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x38, 0x20, 0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20,
+    0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a, 0x42, 0x61,
+    0x67, 0x3e, 0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f,
+    0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54,
+    0x65, 0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72,
+    0x73, 0x3e, 0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d,
+    0x4d, 0x3a, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72,
+    0x79, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x6c, 0x69, 0x20, 0x73, 0x74, 0x45,
+    0x76, 0x74, 0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e,
+    0x63, 0x65, 0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d,
+    0x70, 0x2e, 0x69, 0x69, 0x64, 0x3a, 0x37, 0x37,
+    0x64, 0x36, 0x64, 0x36, 0x33, 0x38, 0x2d, 0x33,
+    0x66, 0x64, 0x35, 0x2d, 0x64, 0x61, 0x34, 0x32,
+    0x2d, 0x61, 0x32, 0x65, 0x32, 0x2d, 0x38, 0x61,
+    0x37, 0x66, 0x64, 0x35, 0x38, 0x34, 0x64, 0x66,
+    0x61, 0x36, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22,
+    0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d,
+    0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30, 0x37,
+    0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30,
+    0x30, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
+    0x65, 0x41, 0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22,
+    0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x50, 0x68,
+    0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20,
+    0x43, 0x43, 0x20, 0x32, 0x30, 0x31, 0x38, 0x20,
+    0x28, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73,
+    0x29, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x6c, 0x69, 0x20, 0x73, 0x74, 0x45,
+    0x76, 0x74, 0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x73, 0x61, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x31, 0x61, 0x35, 0x39,
+    0x65, 0x35, 0x62, 0x65, 0x2d, 0x33, 0x32, 0x31,
+    0x34, 0x2d, 0x63, 0x32, 0x34, 0x61, 0x2d, 0x39,
+    0x62, 0x30, 0x61, 0x2d, 0x39, 0x64, 0x36, 0x37,
+    0x39, 0x61, 0x31, 0x63, 0x30, 0x64, 0x66, 0x33,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31,
+    0x31, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x63,
+    0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22,
+    0x2f, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x6c, 0x69, 0x20, 0x73, 0x74, 0x45,
+    0x76, 0x74, 0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x73, 0x61, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x66, 0x66, 0x33, 0x32,
+    0x33, 0x36, 0x66, 0x61, 0x2d, 0x34, 0x63, 0x37,
+    0x61, 0x2d, 0x34, 0x63, 0x34, 0x38, 0x2d, 0x61,
+    0x38, 0x32, 0x35, 0x2d, 0x34, 0x66, 0x65, 0x34,
+    0x31, 0x37, 0x34, 0x64, 0x38, 0x37, 0x63, 0x32,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x38, 0x3a, 0x30, 0x31, 0x2b, 0x30,
+    0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73, 0x74,
+    0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66, 0x74,
+    0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65, 0x6e,
+    0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65,
+    0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32, 0x30,
+    0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e, 0x64,
+    0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73, 0x74,
+    0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61, 0x6e,
+    0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22, 0x2f,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x6c,
+    0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22,
+    0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65,
+    0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74,
+    0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72, 0x6f,
+    0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63,
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76, 0x6e,
+    0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d, 0x61,
+    0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22, 0x2f,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x6c,
+    0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22,
+    0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x70,
+    0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72,
+    0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65,
+    0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f,
+    0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63,
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76, 0x6e,
+    0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d, 0x61,
+    0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22, 0x2f,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x6c,
+    0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22,
+    0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e, 0x73,
+    0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3d,
+    0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69, 0x64,
+    0x3a, 0x39, 0x34, 0x65, 0x63, 0x37, 0x37, 0x30,
+    0x35, 0x2d, 0x66, 0x66, 0x37, 0x39, 0x2d, 0x33,
+    0x61, 0x34, 0x39, 0x2d, 0x61, 0x65, 0x35, 0x62,
+    0x2d, 0x37, 0x62, 0x31, 0x33, 0x34, 0x37, 0x34,
+    0x32, 0x63, 0x33, 0x66, 0x65, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68, 0x65,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39, 0x2d,
+    0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31, 0x38,
+    0x3a, 0x30, 0x31, 0x2b, 0x30, 0x33, 0x3a, 0x30,
+    0x30, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
+    0x65, 0x41, 0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22,
+    0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x50, 0x68,
+    0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20,
+    0x43, 0x43, 0x20, 0x32, 0x30, 0x31, 0x38, 0x20,
+    0x28, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73,
+    0x29, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64,
+    0x3d, 0x22, 0x2f, 0x22, 0x2f, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65, 0x71,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x6d, 0x70, 0x4d,
+    0x4d, 0x3a, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72,
+    0x79, 0x3e, 0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d,
+    0x4d, 0x3a, 0x44, 0x65, 0x72, 0x69, 0x76, 0x65,
+    0x64, 0x46, 0x72, 0x6f, 0x6d, 0x20, 0x73, 0x74,
+    0x52, 0x65, 0x66, 0x3a, 0x69, 0x6e, 0x73, 0x74,
+    0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3d, 0x22,
+    0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69, 0x64, 0x3a,
+    0x66, 0x66, 0x33, 0x32, 0x33, 0x36, 0x66, 0x61,
+    0x2d, 0x34, 0x63, 0x37, 0x61, 0x2d, 0x34, 0x63,
+    0x34, 0x38, 0x2d, 0x61, 0x38, 0x32, 0x35, 0x2d,
+    0x34, 0x66, 0x65, 0x34, 0x31, 0x37, 0x34, 0x64,
+    0x38, 0x37, 0x63, 0x32, 0x22, 0x20, 0x73, 0x74,
+    0x52, 0x65, 0x66, 0x3a, 0x64, 0x6f, 0x63, 0x75,
+    0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44, 0x3d, 0x22,
+    0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69, 0x64, 0x3a,
+    0x37, 0x37, 0x64, 0x36, 0x64, 0x36, 0x33, 0x38,
+    0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d, 0x64, 0x61,
+    0x34, 0x32, 0x2d, 0x61, 0x32, 0x65, 0x32, 0x2d,
+    0x38, 0x61, 0x37, 0x66, 0x64, 0x35, 0x38, 0x34,
+    0x64, 0x66, 0x61, 0x36, 0x22, 0x20, 0x73, 0x74,
+    0x52, 0x65, 0x66, 0x3a, 0x6f, 0x72, 0x69, 0x67,
+    0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f, 0x63, 0x75,
+    0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44, 0x3d, 0x22,
+    0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69, 0x64, 0x3a,
+    0x37, 0x37, 0x64, 0x36, 0x64, 0x36, 0x33, 0x38,
+    0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d, 0x64, 0x61,
+    0x34, 0x32, 0x2d, 0x61, 0x32, 0x65, 0x32, 0x2d,
+    0x38, 0x61, 0x37, 0x66, 0x64, 0x35, 0x38, 0x34,
+    0x64, 0x66, 0x61, 0x36, 0x22, 0x2f, 0x3e, 0x20,
+    0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a, 0x44, 0x65,
+    0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f,
+    0x6e, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x52, 0x44, 0x46, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x3a, 0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74,
+    0x61, 0x3e, 0x20, 0x3c, 0x3f, 0x78, 0x70, 0x61,
+    0x63, 0x6b, 0x65, 0x74, 0x20, 0x65, 0x6e, 0x64,
+    0x3d, 0x22, 0x72, 0x22, 0x3f, 0x3e, 0x49, 0x16,
+    0x6c, 0x6a, 0x00, 0x00, 0x01, 0x28, 0x49, 0x44,
+    0x41, 0x54, 0x38, 0x8d, 0xc5, 0x54, 0xb1, 0x8d,
+    0x84, 0x30, 0x10, 0x1c, 0xae, 0x15, 0x42, 0xb7,
+    0xe0, 0x70, 0x6b, 0x40, 0x0e, 0x09, 0xc8, 0x5c,
+    0x0a, 0x1d, 0x40, 0x03, 0x26, 0x22, 0x43, 0x72,
+    0x86, 0x64, 0x0a, 0xa0, 0x00, 0x17, 0x40, 0x42,
+    0x66, 0xe2, 0xfd, 0xc0, 0x7f, 0xe8, 0xde, 0x58,
+    0x10, 0xfc, 0x4b, 0xbf, 0x09, 0xd2, 0xec, 0x30,
+    0x1e, 0xcf, 0x20, 0x0a, 0x66, 0xc6, 0xef, 0xe6,
+    0x15, 0x1f, 0xc3, 0x30, 0x14, 0x97, 0x59, 0x96,
+    0xe5, 0x93, 0x9a, 0x70, 0xfa, 0xbe, 0xff, 0x5e,
+    0xf0, 0x7b, 0x42, 0x08, 0x5a, 0xeb, 0x08, 0x6a,
+    0xad, 0x39, 0x37, 0xde, 0x7b, 0x22, 0x12, 0x42,
+    0x38, 0xe7, 0x4e, 0x10, 0x09, 0x89, 0x88, 0x00,
+    0xb4, 0x6d, 0x9b, 0x95, 0x60, 0x66, 0xad, 0xf5,
+    0xe7, 0xfb, 0xcc, 0xfc, 0x4a, 0x2e, 0xd6, 0x34,
+    0x0d, 0x00, 0x6b, 0x6d, 0xf6, 0xda, 0xc7, 0x71,
+    0xec, 0xfb, 0x2e, 0xa5, 0xfc, 0x81, 0x26, 0x87,
+    0x84, 0x10, 0x84, 0x10, 0x00, 0xa6, 0x69, 0xba,
+    0x5a, 0x30, 0xc6, 0x18, 0x63, 0x12, 0x30, 0x95,
+    0x60, 0xe6, 0xb6, 0x6d, 0x01, 0x28, 0xa5, 0xae,
+    0x2b, 0x22, 0xda, 0xb6, 0xed, 0x59, 0xc2, 0x7b,
+    0x1f, 0x0d, 0x26, 0x77, 0x76, 0xce, 0x65, 0x63,
+    0x4e, 0xb3, 0x00, 0x50, 0x96, 0x65, 0xac, 0x26,
+    0x49, 0xc4, 0x5a, 0xab, 0x94, 0xca, 0x24, 0x74,
+    0x55, 0x8d, 0x07, 0xc6, 0xad, 0xf7, 0x3e, 0x22,
+    0xdb, 0xb6, 0x11, 0x51, 0x96, 0x9c, 0x71, 0x01,
+    0x40, 0x4a, 0x19, 0xdb, 0x1d, 0xc7, 0x31, 0x22,
+    0xf3, 0x3c, 0x57, 0x55, 0x95, 0x25, 0xe7, 0x5d,
+    0x30, 0xb3, 0x31, 0x06, 0x80, 0x10, 0x22, 0x84,
+    0x10, 0x83, 0x3c, 0x1d, 0x3d, 0xc7, 0x19, 0xe7,
+    0x6c, 0xd7, 0x18, 0xe3, 0x9c, 0xcb, 0x16, 0xf4,
+    0x20, 0xc1, 0xcc, 0x5d, 0xd7, 0x01, 0x20, 0x22,
+    0xad, 0x75, 0xf6, 0x33, 0x79, 0x96, 0x38, 0xdb,
+    0x15, 0x42, 0xdc, 0xd0, 0xf2, 0x71, 0x26, 0xed,
+    0xd6, 0x75, 0x7d, 0x43, 0xbb, 0x73, 0xc1, 0xef,
+    0x76, 0xd7, 0x75, 0xbd, 0xe1, 0x14, 0xfc, 0x57,
+    0xbf, 0x9c, 0x7f, 0x96, 0xf8, 0x02, 0xf2, 0x31,
+    0x96, 0x96, 0x6c, 0xb7, 0xe2, 0x97, 0x00, 0x00,
+    0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42,
+    0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/W.png */
+const unsigned char letter_image_W[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4d,
+    0x41, 0x00, 0x00, 0xb1, 0x8f, 0x0b, 0xfc, 0x61,
+    0x05, 0x00, 0x00, 0x01, 0x84, 0x69, 0x43, 0x43,
+    0x50, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6f,
+    0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x28, 0x91,
+    0x7d, 0x91, 0x3d, 0x48, 0xc3, 0x40, 0x1c, 0xc5,
+    0x5f, 0x53, 0x4b, 0x45, 0x2a, 0x0a, 0xed, 0x20,
+    0xc5, 0x21, 0x43, 0x75, 0xb2, 0x20, 0x2a, 0xe2,
+    0xa8, 0x55, 0x28, 0x42, 0x85, 0x50, 0x2b, 0xb4,
+    0xea, 0x60, 0x72, 0xfd, 0x84, 0x26, 0x0d, 0x49,
+    0x8a, 0x8b, 0xa3, 0xe0, 0x5a, 0x70, 0xf0, 0x63,
+    0xb1, 0xea, 0xe0, 0xe2, 0xac, 0xab, 0x83, 0xab,
+    0x20, 0x08, 0x7e, 0x80, 0x38, 0x39, 0x3a, 0x29,
+    0xba, 0x48, 0x89, 0xff, 0x4b, 0x0a, 0x2d, 0x62,
+    0x3c, 0x38, 0xee, 0xc7, 0xbb, 0x7b, 0x8f, 0xbb,
+    0x77, 0x80, 0xd0, 0xac, 0x32, 0xd5, 0xec, 0x19,
+    0x07, 0x54, 0xcd, 0x32, 0xd2, 0xc9, 0x84, 0x98,
+    0xcd, 0xad, 0x8a, 0xc1, 0x57, 0xf8, 0x11, 0xc0,
+    0x20, 0xc2, 0x88, 0xca, 0xcc, 0xd4, 0xe7, 0x24,
+    0x29, 0x05, 0xcf, 0xf1, 0x75, 0x0f, 0x1f, 0x5f,
+    0xef, 0xe2, 0x3c, 0xcb, 0xfb, 0xdc, 0x9f, 0xa3,
+    0x3f, 0x5f, 0x30, 0x19, 0xe0, 0x13, 0x89, 0x67,
+    0x99, 0x6e, 0x58, 0xc4, 0x1b, 0xc4, 0xd3, 0x9b,
+    0x96, 0xce, 0x79, 0x9f, 0x38, 0xc2, 0xca, 0x72,
+    0x9e, 0xf8, 0x9c, 0x78, 0xcc, 0xa0, 0x0b, 0x12,
+    0x3f, 0x72, 0x5d, 0x71, 0xf9, 0x8d, 0x73, 0xc9,
+    0x61, 0x81, 0x67, 0x46, 0x8c, 0x4c, 0x7a, 0x9e,
+    0x38, 0x42, 0x2c, 0x96, 0xba, 0x58, 0xe9, 0x62,
+    0x56, 0x36, 0x54, 0xe2, 0x29, 0xe2, 0x58, 0x5e,
+    0xd5, 0x28, 0x5f, 0xc8, 0xba, 0x9c, 0xe7, 0xbc,
+    0xc5, 0x59, 0xad, 0xd6, 0x59, 0xfb, 0x9e, 0xfc,
+    0x85, 0xa1, 0x82, 0xb6, 0xb2, 0xcc, 0x75, 0x9a,
+    0xc3, 0x48, 0x62, 0x11, 0x4b, 0x90, 0x20, 0x42,
+    0x41, 0x1d, 0x15, 0x54, 0x61, 0x21, 0x4e, 0xab,
+    0x46, 0x8a, 0x89, 0x34, 0xed, 0x27, 0x3c, 0xfc,
+    0x51, 0xc7, 0x2f, 0x91, 0x4b, 0x21, 0x57, 0x05,
+    0x8c, 0x1c, 0x0b, 0xa8, 0x41, 0x85, 0xec, 0xf8,
+    0xc1, 0xff, 0xe0, 0x77, 0xb7, 0x66, 0x71, 0x72,
+    0xc2, 0x4d, 0x0a, 0x25, 0x80, 0xc0, 0x8b, 0x6d,
+    0x7f, 0x8c, 0x00, 0xc1, 0x5d, 0xa0, 0xd5, 0xb0,
+    0xed, 0xef, 0x63, 0xdb, 0x6e, 0x9d, 0x00, 0xfe,
+    0x67, 0xe0, 0x4a, 0xeb, 0xf8, 0x6b, 0x4d, 0x60,
+    0xe6, 0x93, 0xf4, 0x46, 0x47, 0x8b, 0x1d, 0x01,
+    0x03, 0xdb, 0xc0, 0xc5, 0x75, 0x47, 0x53, 0xf6,
+    0x80, 0xcb, 0x1d, 0x60, 0xe8, 0x49, 0x97, 0x0d,
+    0xd9, 0x91, 0xfc, 0x34, 0x85, 0x62, 0x11, 0x78,
+    0x3f, 0xa3, 0x6f, 0xca, 0x01, 0xe1, 0x5b, 0xa0,
+    0x6f, 0xcd, 0xed, 0xad, 0xbd, 0x8f, 0xd3, 0x07,
+    0x20, 0x43, 0x5d, 0xa5, 0x6e, 0x80, 0x83, 0x43,
+    0x60, 0xb4, 0x44, 0xd9, 0xeb, 0x1e, 0xef, 0xee,
+    0xed, 0xee, 0xed, 0xdf, 0x33, 0xed, 0xfe, 0x7e,
+    0x00, 0x16, 0x6c, 0x72, 0x82, 0x65, 0xab, 0xbb,
+    0xfe, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4b, 0x47,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9,
+    0x43, 0xbb, 0x7f, 0x00, 0x00, 0x00, 0x09, 0x70,
+    0x48, 0x59, 0x73, 0x00, 0x00, 0x2e, 0x23, 0x00,
+    0x00, 0x2e, 0x23, 0x01, 0x78, 0xa5, 0x3f, 0x76,
+    0x00, 0x00, 0x05, 0x47, 0x49, 0x44, 0x41, 0x54,
+    0x38, 0x11, 0x01, 0x3c, 0x05, 0xc3, 0xfa, 0x01,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+    0xff, 0x94, 0x94, 0x94, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x97, 0x97, 0x97, 0xff, 0xff, 0xff, 0x7c, 0x7c,
+    0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x62, 0x62,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa,
+    0x00, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xca,
+    0xca, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc3, 0xc3, 0xc3, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+    0xff, 0xfb, 0xfb, 0xfb, 0xbe, 0xbe, 0xbe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xb8, 0xb8,
+    0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xcc,
+    0xcc, 0xcc, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd,
+    0xfb, 0xfb, 0xfb, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x82, 0x82,
+    0x00, 0x00, 0x00, 0xcb, 0xcb, 0xcb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x7c, 0x7c, 0x7c, 0x00, 0x00, 0x00,
+    0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xde, 0xde, 0xde, 0x8b, 0x8b, 0x8b,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4c, 0x4c, 0x4c, 0x00, 0x00, 0x00, 0xc4, 0xc4,
+    0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x4f, 0x4f,
+    0x00, 0x00, 0x00, 0xc7, 0xc7, 0xc7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xcf,
+    0x45, 0x45, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0x35, 0x35,
+    0x35, 0x1c, 0x1c, 0x1c, 0xf5, 0xf5, 0xf5, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf5, 0xf5, 0xf5, 0x00, 0x00, 0x00, 0x1c, 0x1c,
+    0x1c, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+    0x62, 0x62, 0x62, 0xf9, 0xf9, 0xf9, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06,
+    0x06, 0x6a, 0x6a, 0x6a, 0xe4, 0xe4, 0xe4, 0xd2,
+    0xd2, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xea, 0xea, 0xea, 0x00, 0x00,
+    0x00, 0xe4, 0xe4, 0xe4, 0xd2, 0xd2, 0xd2, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xdf, 0xdf, 0xdf, 0x3c, 0x3c, 0x3c, 0x06, 0x06,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3d, 0x3d, 0x3d, 0x00,
+    0x00, 0x00, 0xba, 0xba, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xc9,
+    0xc9, 0xa5, 0xa5, 0xa5, 0x00, 0x00, 0x00, 0xb8,
+    0xb8, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xc9, 0xc9, 0xc9, 0x3c, 0x3c,
+    0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xfe, 0xfe, 0x56, 0x56, 0x56, 0x00, 0x00, 0x00,
+    0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xfc, 0xfc,
+    0xfc, 0x6a, 0x6a, 0x6a, 0xfa, 0xfa, 0xfa, 0x4f,
+    0x4f, 0x4f, 0x00, 0x00, 0x00, 0xee, 0xee, 0xee,
+    0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0x69, 0x69,
+    0x69, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x5c, 0x5c, 0x5c,
+    0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0x00, 0x00,
+    0x00, 0xdd, 0xdd, 0xdd, 0x43, 0x43, 0x43, 0x05,
+    0x05, 0x05, 0x5f, 0x5f, 0x5f, 0x00, 0x00, 0x00,
+    0xce, 0xce, 0xce, 0x00, 0x00, 0x00, 0xdc, 0xdc,
+    0xdc, 0x44, 0x44, 0x44, 0x02, 0x02, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x37, 0x37, 0x37, 0x00, 0x00, 0x00, 0xb3, 0xb3,
+    0xb3, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x39,
+    0x39, 0x39, 0x00, 0x00, 0x00, 0x39, 0x39, 0x39,
+    0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x00, 0x00,
+    0x00, 0xc7, 0xc7, 0xc7, 0x38, 0x38, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0x76,
+    0x76, 0x00, 0x00, 0x00, 0xe4, 0xe4, 0xe4, 0x7a,
+    0x7a, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x71, 0x71, 0x71, 0x00, 0x00,
+    0x00, 0xe2, 0xe2, 0xe2, 0x76, 0x76, 0x76, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xc3, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x6c,
+    0x6c, 0x6c, 0xbe, 0xbe, 0xbe, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xc1,
+    0xc1, 0x00, 0x00, 0x00, 0x69, 0x69, 0x69, 0xbb,
+    0xbb, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0x1c,
+    0x1c, 0x1c, 0x0d, 0x0d, 0x0d, 0xf1, 0xf1, 0xf1,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf3, 0xf3, 0xf3, 0x16, 0x16, 0x16, 0x00,
+    0x00, 0x00, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x0b, 0x0b, 0x73, 0x73, 0x73, 0xf9, 0xf9, 0xf9,
+    0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x78,
+    0x78, 0x78, 0xf1, 0xf1, 0xf1, 0x11, 0x11, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x43, 0x43,
+    0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x44, 0x44, 0x44, 0xf5, 0xf5, 0xf5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7f, 0x52, 0xdc, 0xe8, 0x8a,
+    0x27, 0x59, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x49,
+    0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/X.png */
+const unsigned char letter_image_X[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x38, 0x3a, 0x30, 0x31, 0x3a, 0x34,
+    0x39, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x38, 0x3a, 0x30,
+    0x31, 0x3a, 0x34, 0x39, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x31, 0x34, 0x38, 0x31,
+    0x65, 0x62, 0x36, 0x34, 0x2d, 0x36, 0x38, 0x30,
+    0x62, 0x2d, 0x38, 0x38, 0x34, 0x37, 0x2d, 0x61,
+    0x34, 0x34, 0x66, 0x2d, 0x61, 0x35, 0x65, 0x38,
+    0x36, 0x33, 0x33, 0x37, 0x64, 0x31, 0x63, 0x61,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x36, 0x35, 0x30, 0x37, 0x30, 0x39,
+    0x36, 0x30, 0x2d, 0x63, 0x38, 0x62, 0x64, 0x2d,
+    0x63, 0x35, 0x34, 0x36, 0x2d, 0x38, 0x32, 0x62,
+    0x66, 0x2d, 0x33, 0x66, 0x30, 0x34, 0x39, 0x63,
+    0x32, 0x66, 0x31, 0x34, 0x31, 0x31, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x39, 0x38, 0x37, 0x63, 0x38, 0x36,
+    0x65, 0x35, 0x2d, 0x62, 0x66, 0x31, 0x34, 0x2d,
+    0x38, 0x62, 0x34, 0x30, 0x2d, 0x38, 0x63, 0x31,
+    0x65, 0x2d, 0x34, 0x39, 0x38, 0x33, 0x37, 0x63,
+    0x35, 0x66, 0x35, 0x31, 0x62, 0x30, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x31, 0x3a, 0x34, 0x39, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x34, 0x38, 0x31, 0x65, 0x62,
+    0x36, 0x34, 0x2d, 0x36, 0x38, 0x30, 0x62, 0x2d,
+    0x38, 0x38, 0x34, 0x37, 0x2d, 0x61, 0x34, 0x34,
+    0x66, 0x2d, 0x61, 0x35, 0x65, 0x38, 0x36, 0x33,
+    0x33, 0x37, 0x64, 0x31, 0x63, 0x61, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x31, 0x3a, 0x34, 0x39, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x39, 0x38, 0x37, 0x63,
+    0x38, 0x36, 0x65, 0x35, 0x2d, 0x62, 0x66, 0x31,
+    0x34, 0x2d, 0x38, 0x62, 0x34, 0x30, 0x2d, 0x38,
+    0x63, 0x31, 0x65, 0x2d, 0x34, 0x39, 0x38, 0x33,
+    0x37, 0x63, 0x35, 0x66, 0x35, 0x31, 0x62, 0x30,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0x74, 0x51, 0x33, 0xbc, 0x00, 0x00,
+    0x00, 0xf7, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xad, 0x94, 0x4d, 0x95, 0xc4, 0x20, 0x0c, 0x80,
+    0x99, 0xb5, 0x83, 0x8d, 0x88, 0x88, 0x87, 0x58,
+    0xc0, 0x01, 0x0e, 0xa2, 0x20, 0x0a, 0x30, 0x80,
+    0x81, 0xca, 0x88, 0x00, 0xee, 0xd9, 0x03, 0x3b,
+    0x19, 0x06, 0xda, 0x1d, 0xde, 0xeb, 0xe4, 0xc4,
+    0x4b, 0xd2, 0x2f, 0xff, 0x7d, 0x98, 0x59, 0xb8,
+    0x29, 0x66, 0x66, 0x66, 0x29, 0xa5, 0xd5, 0x84,
+    0x88, 0xf6, 0x14, 0x44, 0x1c, 0x4d, 0x29, 0x25,
+    0x37, 0x05, 0x7f, 0xa9, 0x2a, 0x11, 0xb9, 0x53,
+    0x29, 0xc5, 0xde, 0xa5, 0xd6, 0xda, 0xb9, 0xb5,
+    0xd6, 0x51, 0x1f, 0x26, 0xbf, 0x9c, 0x73, 0x47,
+    0xe4, 0x9c, 0x27, 0x93, 0x88, 0x10, 0x91, 0x2d,
+    0x32, 0x23, 0xcc, 0xcc, 0x73, 0x39, 0x8e, 0xc3,
+    0x95, 0xa5, 0x14, 0x00, 0x68, 0xad, 0x6d, 0x21,
+    0x54, 0x35, 0xc6, 0x18, 0x42, 0x00, 0x80, 0x51,
+    0xa3, 0xaa, 0xab, 0xf3, 0x39, 0xa2, 0xc7, 0xf4,
+    0x72, 0x5a, 0x6b, 0x88, 0x38, 0x66, 0xb4, 0x85,
+    0xb0, 0xa1, 0x29, 0x00, 0xb0, 0xb6, 0x76, 0x0b,
+    0x61, 0xcf, 0x41, 0x5e, 0xb5, 0x60, 0x0b, 0x21,
+    0x22, 0x57, 0xd3, 0xd9, 0x42, 0xa8, 0x2a, 0x00,
+    0x30, 0xf3, 0xd5, 0x9a, 0x7c, 0x40, 0xf4, 0x16,
+    0xf6, 0x11, 0xf4, 0x19, 0xff, 0x53, 0xce, 0x39,
+    0x82, 0x88, 0x3c, 0xac, 0xcf, 0x78, 0x5c, 0xea,
+    0x0f, 0x08, 0x66, 0x66, 0xe6, 0x51, 0xe3, 0x4d,
+    0x39, 0x2d, 0x67, 0x46, 0x88, 0xc8, 0x69, 0x34,
+    0xbf, 0xc3, 0x75, 0x41, 0x5e, 0x88, 0x5a, 0x6b,
+    0x2f, 0x5b, 0x44, 0x56, 0x84, 0x27, 0x12, 0x63,
+    0x9c, 0x1c, 0xfe, 0x10, 0xd3, 0x2d, 0x8f, 0x67,
+    0xbe, 0x5a, 0xbb, 0x78, 0x77, 0x1f, 0x76, 0xfb,
+    0x97, 0xf3, 0x73, 0xf3, 0xfb, 0xef, 0x20, 0x7e,
+    0x01, 0xeb, 0x80, 0x3c, 0xee, 0x8a, 0xd7, 0x49,
+    0x78, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e,
+    0x44, 0xae, 0x42, 0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/Y.png */
+const unsigned char letter_image_Y[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x38, 0x3a, 0x30, 0x32, 0x3a, 0x31,
+    0x31, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x38, 0x3a, 0x30,
+    0x32, 0x3a, 0x31, 0x31, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x65, 0x39, 0x64, 0x32,
+    0x37, 0x61, 0x38, 0x30, 0x2d, 0x62, 0x66, 0x30,
+    0x62, 0x2d, 0x34, 0x61, 0x34, 0x31, 0x2d, 0x62,
+    0x31, 0x61, 0x33, 0x2d, 0x34, 0x62, 0x32, 0x32,
+    0x37, 0x30, 0x39, 0x31, 0x35, 0x39, 0x62, 0x35,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x62, 0x37, 0x32, 0x32, 0x63, 0x65,
+    0x31, 0x34, 0x2d, 0x32, 0x64, 0x35, 0x39, 0x2d,
+    0x62, 0x61, 0x34, 0x66, 0x2d, 0x39, 0x32, 0x33,
+    0x62, 0x2d, 0x34, 0x32, 0x37, 0x32, 0x61, 0x36,
+    0x36, 0x64, 0x38, 0x32, 0x64, 0x33, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x66, 0x36, 0x30, 0x39, 0x31, 0x64,
+    0x30, 0x64, 0x2d, 0x30, 0x39, 0x62, 0x62, 0x2d,
+    0x30, 0x61, 0x34, 0x36, 0x2d, 0x38, 0x36, 0x62,
+    0x37, 0x2d, 0x63, 0x36, 0x65, 0x33, 0x35, 0x63,
+    0x61, 0x35, 0x30, 0x62, 0x62, 0x32, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x32, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x65, 0x39, 0x64, 0x32, 0x37, 0x61,
+    0x38, 0x30, 0x2d, 0x62, 0x66, 0x30, 0x62, 0x2d,
+    0x34, 0x61, 0x34, 0x31, 0x2d, 0x62, 0x31, 0x61,
+    0x33, 0x2d, 0x34, 0x62, 0x32, 0x32, 0x37, 0x30,
+    0x39, 0x31, 0x35, 0x39, 0x62, 0x35, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x32, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x66, 0x36, 0x30, 0x39,
+    0x31, 0x64, 0x30, 0x64, 0x2d, 0x30, 0x39, 0x62,
+    0x62, 0x2d, 0x30, 0x61, 0x34, 0x36, 0x2d, 0x38,
+    0x36, 0x62, 0x37, 0x2d, 0x63, 0x36, 0x65, 0x33,
+    0x35, 0x63, 0x61, 0x35, 0x30, 0x62, 0x62, 0x32,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0xad, 0x56, 0x18, 0x6d, 0x00, 0x00,
+    0x00, 0xe7, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xcd, 0x94, 0xbd, 0x8d, 0x04, 0x21, 0x0c, 0x85,
+    0xbd, 0xd7, 0xca, 0x84, 0xb4, 0xe1, 0x22, 0xe8,
+    0x81, 0x16, 0xdc, 0x01, 0x1d, 0x4c, 0x05, 0xae,
+    0x80, 0x09, 0x26, 0xa4, 0x86, 0xc9, 0x28, 0x60,
+    0x0a, 0x70, 0xfe, 0x36, 0x40, 0x87, 0xd0, 0xfc,
+    0xb0, 0xab, 0x5b, 0xe9, 0xb4, 0x2f, 0x7c, 0xb6,
+    0x3e, 0xf4, 0x8c, 0xe1, 0x01, 0x80, 0x3e, 0x14,
+    0x00, 0x00, 0xaa, 0x7a, 0x2e, 0xcd, 0xf3, 0x8c,
+    0x5f, 0x95, 0x52, 0xee, 0xaa, 0xd4, 0x9a, 0xcc,
+    0x4c, 0x44, 0x6a, 0xd9, 0x7b, 0x8f, 0x2b, 0x85,
+    0x10, 0x88, 0x48, 0x44, 0xcc, 0xac, 0x99, 0x74,
+    0x68, 0x8a, 0x31, 0x12, 0x91, 0x73, 0xae, 0x6f,
+    0xea, 0x11, 0xaa, 0x7a, 0x30, 0x8f, 0x08, 0x00,
+    0xcc, 0x4c, 0x44, 0x21, 0x84, 0x83, 0xaf, 0xaa,
+    0x67, 0xf3, 0x1a, 0x91, 0x73, 0xae, 0x71, 0x52,
+    0x4a, 0xcd, 0x34, 0x33, 0xe7, 0xdc, 0xbe, 0xef,
+    0x6f, 0x21, 0x00, 0xd4, 0xa1, 0x30, 0x73, 0x8b,
+    0x23, 0x22, 0xe7, 0x08, 0x23, 0x44, 0x3d, 0x93,
+    0x88, 0x62, 0x8c, 0x00, 0x52, 0x4a, 0x77, 0x03,
+    0xbe, 0x45, 0xa0, 0xbb, 0xe6, 0x9c, 0x33, 0x33,
+    0x5f, 0x46, 0x78, 0x81, 0x00, 0xe0, 0xbd, 0xaf,
+    0x94, 0xbb, 0x08, 0xaf, 0x11, 0x6d, 0x9d, 0x4a,
+    0x29, 0x83, 0xb6, 0x9f, 0xc1, 0xe2, 0x4e, 0xd3,
+    0x54, 0x27, 0x32, 0xd6, 0x08, 0xf1, 0xa6, 0xfe,
+    0x0b, 0x61, 0x66, 0x7f, 0x44, 0x2c, 0xcb, 0xb2,
+    0x6d, 0x1b, 0x11, 0xad, 0xeb, 0x3a, 0x3a, 0xe1,
+    0x72, 0xc8, 0x6d, 0xc7, 0x7b, 0xf5, 0x6f, 0xbf,
+    0xd7, 0x03, 0x1f, 0x7f, 0x39, 0xdf, 0x71, 0x23,
+    0x4f, 0xef, 0x8e, 0x50, 0x94, 0xbf, 0x0e, 0x6f,
+    0x96, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e,
+    0x44, 0xae, 0x42, 0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/Z.png */
+const unsigned char letter_image_Z[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x38, 0x3a, 0x30, 0x32, 0x3a, 0x34,
+    0x34, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x38, 0x3a, 0x30,
+    0x32, 0x3a, 0x34, 0x34, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x65, 0x35, 0x64, 0x63,
+    0x66, 0x61, 0x35, 0x34, 0x2d, 0x63, 0x61, 0x33,
+    0x33, 0x2d, 0x62, 0x33, 0x34, 0x38, 0x2d, 0x62,
+    0x66, 0x63, 0x64, 0x2d, 0x36, 0x30, 0x30, 0x35,
+    0x37, 0x33, 0x32, 0x61, 0x30, 0x31, 0x37, 0x37,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x34, 0x64, 0x33, 0x64, 0x33, 0x32,
+    0x39, 0x66, 0x2d, 0x65, 0x64, 0x39, 0x39, 0x2d,
+    0x66, 0x34, 0x34, 0x65, 0x2d, 0x61, 0x33, 0x38,
+    0x33, 0x2d, 0x66, 0x30, 0x34, 0x62, 0x30, 0x64,
+    0x62, 0x31, 0x33, 0x38, 0x61, 0x61, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x38, 0x61, 0x30, 0x39, 0x32, 0x61,
+    0x33, 0x30, 0x2d, 0x33, 0x34, 0x66, 0x34, 0x2d,
+    0x35, 0x62, 0x34, 0x33, 0x2d, 0x62, 0x31, 0x61,
+    0x36, 0x2d, 0x31, 0x62, 0x37, 0x35, 0x63, 0x63,
+    0x34, 0x63, 0x31, 0x34, 0x32, 0x66, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x32, 0x3a, 0x34, 0x34, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x65, 0x35, 0x64, 0x63, 0x66, 0x61,
+    0x35, 0x34, 0x2d, 0x63, 0x61, 0x33, 0x33, 0x2d,
+    0x62, 0x33, 0x34, 0x38, 0x2d, 0x62, 0x66, 0x63,
+    0x64, 0x2d, 0x36, 0x30, 0x30, 0x35, 0x37, 0x33,
+    0x32, 0x61, 0x30, 0x31, 0x37, 0x37, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x32, 0x3a, 0x34, 0x34, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x38, 0x61, 0x30, 0x39,
+    0x32, 0x61, 0x33, 0x30, 0x2d, 0x33, 0x34, 0x66,
+    0x34, 0x2d, 0x35, 0x62, 0x34, 0x33, 0x2d, 0x62,
+    0x31, 0x61, 0x36, 0x2d, 0x31, 0x62, 0x37, 0x35,
+    0x63, 0x63, 0x34, 0x63, 0x31, 0x34, 0x32, 0x66,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0xc1, 0x53, 0xea, 0x21, 0x00, 0x00,
+    0x00, 0xd6, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xad, 0x94, 0x41, 0x11, 0xc4, 0x20, 0x0c, 0x45,
+    0xd3, 0xb5, 0x83, 0x8d, 0x88, 0xc0, 0x03, 0x16,
+    0xea, 0x00, 0x07, 0x28, 0x40, 0x01, 0x06, 0x62,
+    0x20, 0x02, 0x2a, 0x00, 0x01, 0xb9, 0x67, 0x0f,
+    0xcc, 0x74, 0xa7, 0x4d, 0x4b, 0x66, 0xda, 0xfd,
+    0x57, 0xf8, 0x8f, 0x24, 0x3f, 0xc3, 0xa2, 0xaa,
+    0xf0, 0x52, 0x7a, 0x54, 0x08, 0x61, 0x7e, 0x3f,
+    0xe7, 0x7c, 0xb2, 0x1c, 0x10, 0x22, 0x02, 0x00,
+    0xad, 0x35, 0x35, 0x8a, 0x31, 0x02, 0x40, 0x8c,
+    0xd1, 0x1e, 0x1d, 0x10, 0xdb, 0xb6, 0xd9, 0x47,
+    0x54, 0x35, 0xe7, 0x3c, 0x4a, 0x60, 0x66, 0x07,
+    0xc1, 0xcc, 0xb6, 0x04, 0x22, 0x1a, 0xfe, 0x5a,
+    0xab, 0xf5, 0x9f, 0x11, 0x56, 0x22, 0x82, 0x88,
+    0x00, 0x90, 0x52, 0xba, 0xbb, 0xe3, 0x20, 0x52,
+    0x4a, 0x00, 0x10, 0x42, 0xe8, 0xbd, 0x3f, 0x41,
+    0xd4, 0x5a, 0x47, 0x0b, 0x97, 0x03, 0xf6, 0x11,
+    0xbd, 0xf7, 0x11, 0xf0, 0xba, 0xae, 0xf3, 0x4a,
+    0x6f, 0x11, 0x23, 0x45, 0x44, 0x14, 0x91, 0x27,
+    0x88, 0x52, 0xca, 0x24, 0x45, 0x1f, 0xc1, 0xcc,
+    0xc3, 0x5f, 0x4a, 0x71, 0xfd, 0x17, 0x88, 0x3d,
+    0xc5, 0xcb, 0x45, 0x54, 0x55, 0x22, 0x72, 0x10,
+    0x6e, 0x8a, 0x76, 0xba, 0x07, 0x44, 0x6b, 0x6d,
+    0xbe, 0x88, 0xcc, 0x3c, 0x43, 0xec, 0x29, 0xde,
+    0x2d, 0x22, 0x11, 0x21, 0xa2, 0xa5, 0xff, 0x10,
+    0xa3, 0x05, 0x57, 0x76, 0xcd, 0x16, 0x7d, 0xfd,
+    0xe5, 0x7c, 0x5e, 0xfa, 0xff, 0x83, 0xf8, 0x02,
+    0x32, 0x1a, 0x61, 0x99, 0x02, 0x7d, 0x03, 0xe9,
+    0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44,
+    0xae, 0x42, 0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/1.png */
+const unsigned char letter_image_1[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x38, 0x3a, 0x30, 0x33, 0x3a, 0x31,
+    0x37, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x38, 0x3a, 0x30,
+    0x33, 0x3a, 0x31, 0x37, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x30, 0x63, 0x38, 0x65,
+    0x38, 0x65, 0x38, 0x64, 0x2d, 0x34, 0x32, 0x38,
+    0x30, 0x2d, 0x32, 0x65, 0x34, 0x64, 0x2d, 0x62,
+    0x37, 0x31, 0x63, 0x2d, 0x35, 0x38, 0x31, 0x62,
+    0x62, 0x39, 0x36, 0x39, 0x38, 0x32, 0x37, 0x66,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x36, 0x38, 0x34, 0x31, 0x66, 0x35,
+    0x65, 0x34, 0x2d, 0x62, 0x61, 0x66, 0x35, 0x2d,
+    0x39, 0x38, 0x34, 0x39, 0x2d, 0x39, 0x61, 0x63,
+    0x33, 0x2d, 0x34, 0x37, 0x62, 0x33, 0x64, 0x36,
+    0x65, 0x30, 0x35, 0x61, 0x63, 0x62, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x66, 0x30, 0x34, 0x36, 0x65, 0x34,
+    0x66, 0x61, 0x2d, 0x39, 0x34, 0x34, 0x36, 0x2d,
+    0x63, 0x65, 0x34, 0x34, 0x2d, 0x62, 0x36, 0x64,
+    0x30, 0x2d, 0x39, 0x63, 0x38, 0x39, 0x30, 0x62,
+    0x61, 0x31, 0x34, 0x38, 0x66, 0x35, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x33, 0x3a, 0x31, 0x37, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x30, 0x63, 0x38, 0x65, 0x38, 0x65,
+    0x38, 0x64, 0x2d, 0x34, 0x32, 0x38, 0x30, 0x2d,
+    0x32, 0x65, 0x34, 0x64, 0x2d, 0x62, 0x37, 0x31,
+    0x63, 0x2d, 0x35, 0x38, 0x31, 0x62, 0x62, 0x39,
+    0x36, 0x39, 0x38, 0x32, 0x37, 0x66, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x33, 0x3a, 0x31, 0x37, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x66, 0x30, 0x34, 0x36,
+    0x65, 0x34, 0x66, 0x61, 0x2d, 0x39, 0x34, 0x34,
+    0x36, 0x2d, 0x63, 0x65, 0x34, 0x34, 0x2d, 0x62,
+    0x36, 0x64, 0x30, 0x2d, 0x39, 0x63, 0x38, 0x39,
+    0x30, 0x62, 0x61, 0x31, 0x34, 0x38, 0x66, 0x35,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0xf0, 0x57, 0xb4, 0xee, 0x00, 0x00,
+    0x00, 0x7b, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xed, 0x94, 0xbb, 0x0d, 0xc0, 0x20, 0x0c, 0x44,
+    0x2f, 0x51, 0x6a, 0x58, 0xc7, 0x13, 0x31, 0x01,
+    0x1b, 0xd0, 0x32, 0x01, 0x15, 0x25, 0xb0, 0x06,
+    0x33, 0xd0, 0x31, 0x05, 0x0b, 0x90, 0x3e, 0x4a,
+    0x9c, 0x5f, 0x91, 0x14, 0x5c, 0x7b, 0xcf, 0x4f,
+    0x96, 0x0b, 0x4f, 0xbd, 0x77, 0xbc, 0xcb, 0xc2,
+    0x74, 0x31, 0xc6, 0xd6, 0x5a, 0x4a, 0x89, 0x88,
+    0x8c, 0x31, 0xb7, 0x15, 0xd6, 0x5a, 0x00, 0xde,
+    0xfb, 0x52, 0x0a, 0x11, 0x3d, 0xd9, 0x42, 0x6b,
+    0x0d, 0x40, 0x4a, 0xa9, 0x94, 0x62, 0xe6, 0x01,
+    0xcc, 0x7c, 0x2d, 0x84, 0xe0, 0x81, 0x73, 0xc5,
+    0x95, 0x0c, 0xc5, 0x50, 0x7c, 0xa3, 0xc8, 0x39,
+    0x03, 0xa8, 0xb5, 0x72, 0x50, 0x3f, 0x48, 0x08,
+    0x61, 0x43, 0x3a, 0xe7, 0x76, 0xc9, 0xe9, 0xfd,
+    0xcb, 0xf9, 0xc7, 0x39, 0x57, 0x72, 0x7a, 0x4e,
+    0x2b, 0x24, 0x44, 0x9c, 0x98, 0x00, 0x00, 0x00,
+    0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60,
+    0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/2.png */
+const unsigned char letter_image_2[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x38, 0x3a, 0x30, 0x33, 0x3a, 0x33,
+    0x31, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x38, 0x3a, 0x30,
+    0x33, 0x3a, 0x33, 0x31, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x38, 0x61, 0x32, 0x66,
+    0x36, 0x63, 0x35, 0x37, 0x2d, 0x37, 0x30, 0x32,
+    0x61, 0x2d, 0x31, 0x64, 0x34, 0x38, 0x2d, 0x61,
+    0x39, 0x36, 0x35, 0x2d, 0x66, 0x36, 0x66, 0x37,
+    0x62, 0x37, 0x65, 0x61, 0x35, 0x30, 0x66, 0x34,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x39, 0x35, 0x33, 0x37, 0x63, 0x64,
+    0x34, 0x65, 0x2d, 0x66, 0x32, 0x38, 0x37, 0x2d,
+    0x61, 0x37, 0x34, 0x37, 0x2d, 0x39, 0x61, 0x66,
+    0x35, 0x2d, 0x65, 0x61, 0x35, 0x61, 0x61, 0x30,
+    0x64, 0x64, 0x61, 0x61, 0x35, 0x35, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x36, 0x66, 0x37, 0x34, 0x61,
+    0x34, 0x65, 0x2d, 0x35, 0x37, 0x63, 0x39, 0x2d,
+    0x36, 0x36, 0x34, 0x63, 0x2d, 0x61, 0x64, 0x64,
+    0x32, 0x2d, 0x37, 0x61, 0x35, 0x36, 0x64, 0x37,
+    0x66, 0x65, 0x64, 0x66, 0x34, 0x39, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x33, 0x3a, 0x33, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x38, 0x61, 0x32, 0x66, 0x36, 0x63,
+    0x35, 0x37, 0x2d, 0x37, 0x30, 0x32, 0x61, 0x2d,
+    0x31, 0x64, 0x34, 0x38, 0x2d, 0x61, 0x39, 0x36,
+    0x35, 0x2d, 0x66, 0x36, 0x66, 0x37, 0x62, 0x37,
+    0x65, 0x61, 0x35, 0x30, 0x66, 0x34, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x33, 0x3a, 0x33, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x31, 0x36, 0x66, 0x37,
+    0x34, 0x61, 0x34, 0x65, 0x2d, 0x35, 0x37, 0x63,
+    0x39, 0x2d, 0x36, 0x36, 0x34, 0x63, 0x2d, 0x61,
+    0x64, 0x64, 0x32, 0x2d, 0x37, 0x61, 0x35, 0x36,
+    0x64, 0x37, 0x66, 0x65, 0x64, 0x66, 0x34, 0x39,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0xfd, 0xda, 0xfa, 0x24, 0x00, 0x00,
+    0x00, 0xec, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xbd, 0x94, 0xcd, 0x0d, 0x83, 0x30, 0x0c, 0x85,
+    0x93, 0xaa, 0x37, 0x56, 0x60, 0x03, 0xd6, 0xb0,
+    0xc4, 0x08, 0x98, 0x11, 0x50, 0x18, 0x21, 0x1b,
+    0xb0, 0x01, 0x13, 0x30, 0x41, 0x18, 0x20, 0x0c,
+    0xc0, 0x00, 0x1e, 0x20, 0x67, 0xe4, 0x7b, 0x7a,
+    0x88, 0x54, 0x55, 0xe4, 0x87, 0xaa, 0x55, 0xfb,
+    0x6e, 0x31, 0xcf, 0x5f, 0x90, 0xf3, 0x12, 0xe9,
+    0xbd, 0x17, 0xdf, 0xe9, 0x96, 0xac, 0x6e, 0xdb,
+    0x36, 0x8e, 0xa3, 0x94, 0x52, 0x4a, 0xd9, 0xf7,
+    0xfd, 0xba, 0xae, 0x25, 0x86, 0x8f, 0x64, 0xad,
+    0x8d, 0x6d, 0xf3, 0x3c, 0xc7, 0xce, 0xa0, 0x04,
+    0x02, 0x00, 0xb4, 0xd6, 0xcc, 0xec, 0xbd, 0x27,
+    0x22, 0x44, 0x0c, 0x14, 0x6b, 0xed, 0x5b, 0x08,
+    0x63, 0xcc, 0x34, 0x4d, 0xaf, 0x15, 0x66, 0x06,
+    0x80, 0xc2, 0x8f, 0x9c, 0x67, 0x71, 0x1c, 0xc7,
+    0x30, 0x0c, 0xaf, 0x95, 0xaa, 0xaa, 0xda, 0xb6,
+    0x2d, 0x8c, 0xe2, 0x7e, 0x5a, 0x77, 0x5d, 0x97,
+    0xb3, 0xd6, 0x75, 0xfd, 0xee, 0x38, 0x63, 0x21,
+    0x22, 0x00, 0xe4, 0xbe, 0x5e, 0x23, 0x88, 0x48,
+    0x08, 0xb1, 0x2c, 0xcb, 0xe7, 0x08, 0xad, 0xb5,
+    0x52, 0xaa, 0x60, 0xb8, 0x40, 0x18, 0x63, 0x00,
+    0x20, 0x1c, 0xf0, 0x27, 0x08, 0xe7, 0x5c, 0xd3,
+    0x34, 0xce, 0xb9, 0xf2, 0x36, 0x59, 0x44, 0x88,
+    0x03, 0x11, 0x95, 0xfb, 0xb3, 0x08, 0x66, 0x46,
+    0xc4, 0x38, 0x8e, 0xc9, 0x80, 0x26, 0x10, 0xb9,
+    0x7e, 0xa5, 0xd4, 0xbe, 0xef, 0xd7, 0x88, 0xd0,
+    0x9f, 0x4c, 0x50, 0x2e, 0x1a, 0x67, 0x44, 0xae,
+    0x5f, 0x08, 0x71, 0xba, 0x3b, 0x4f, 0x49, 0xff,
+    0xa3, 0x27, 0xe7, 0xdf, 0x88, 0x07, 0xba, 0x96,
+    0xee, 0xc6, 0xce, 0x81, 0xed, 0xdf, 0x00, 0x00,
+    0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42,
+    0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/3.png */
+const unsigned char letter_image_3[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x38, 0x3a, 0x30, 0x33, 0x3a, 0x34,
+    0x37, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x38, 0x3a, 0x30,
+    0x33, 0x3a, 0x34, 0x37, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x33, 0x39, 0x63, 0x64,
+    0x35, 0x63, 0x31, 0x35, 0x2d, 0x33, 0x61, 0x37,
+    0x32, 0x2d, 0x36, 0x37, 0x34, 0x64, 0x2d, 0x61,
+    0x35, 0x61, 0x31, 0x2d, 0x65, 0x36, 0x33, 0x32,
+    0x62, 0x34, 0x64, 0x30, 0x30, 0x31, 0x64, 0x62,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x62, 0x66, 0x38, 0x38, 0x63, 0x35,
+    0x34, 0x31, 0x2d, 0x64, 0x61, 0x37, 0x36, 0x2d,
+    0x37, 0x32, 0x34, 0x32, 0x2d, 0x38, 0x30, 0x62,
+    0x38, 0x2d, 0x62, 0x32, 0x62, 0x64, 0x39, 0x34,
+    0x33, 0x65, 0x65, 0x35, 0x34, 0x64, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x32, 0x34, 0x37, 0x30, 0x32, 0x32,
+    0x61, 0x31, 0x2d, 0x32, 0x32, 0x65, 0x30, 0x2d,
+    0x37, 0x39, 0x34, 0x36, 0x2d, 0x38, 0x33, 0x30,
+    0x61, 0x2d, 0x64, 0x30, 0x62, 0x66, 0x39, 0x31,
+    0x31, 0x30, 0x32, 0x30, 0x36, 0x38, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x33, 0x3a, 0x34, 0x37, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x33, 0x39, 0x63, 0x64, 0x35, 0x63,
+    0x31, 0x35, 0x2d, 0x33, 0x61, 0x37, 0x32, 0x2d,
+    0x36, 0x37, 0x34, 0x64, 0x2d, 0x61, 0x35, 0x61,
+    0x31, 0x2d, 0x65, 0x36, 0x33, 0x32, 0x62, 0x34,
+    0x64, 0x30, 0x30, 0x31, 0x64, 0x62, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x33, 0x3a, 0x34, 0x37, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x32, 0x34, 0x37, 0x30,
+    0x32, 0x32, 0x61, 0x31, 0x2d, 0x32, 0x32, 0x65,
+    0x30, 0x2d, 0x37, 0x39, 0x34, 0x36, 0x2d, 0x38,
+    0x33, 0x30, 0x61, 0x2d, 0x64, 0x30, 0x62, 0x66,
+    0x39, 0x31, 0x31, 0x30, 0x32, 0x30, 0x36, 0x38,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0xd2, 0x26, 0x18, 0x8f, 0x00, 0x00,
+    0x01, 0x04, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xb5, 0x93, 0x21, 0x8e, 0x85, 0x30, 0x10, 0x86,
+    0xa7, 0x9b, 0x95, 0x84, 0x93, 0x90, 0x60, 0x38,
+    0x42, 0x0f, 0x51, 0x3c, 0x6e, 0x38, 0x02, 0x0e,
+    0x09, 0x27, 0x40, 0xa2, 0xb8, 0x40, 0x5b, 0x81,
+    0x84, 0x03, 0x60, 0x49, 0x2a, 0x11, 0x58, 0x12,
+    0xd0, 0xf3, 0x44, 0x13, 0xc4, 0x52, 0xd8, 0xbe,
+    0xb7, 0xd9, 0x5f, 0x76, 0xfe, 0xf9, 0x32, 0xf9,
+    0x67, 0xca, 0x88, 0x08, 0xfe, 0xa6, 0xaf, 0xbb,
+    0xc2, 0x38, 0x8e, 0x79, 0x9e, 0x33, 0xc6, 0x18,
+    0x63, 0x69, 0x9a, 0x6a, 0xad, 0x6f, 0x19, 0xe4,
+    0x92, 0x52, 0xea, 0xea, 0x54, 0x4a, 0x39, 0xcd,
+    0x8e, 0x29, 0x8e, 0xe3, 0x68, 0xdb, 0xf6, 0x6c,
+    0x30, 0xc6, 0x08, 0x21, 0x00, 0x40, 0x4a, 0xf9,
+    0xc6, 0x14, 0x3f, 0x64, 0x8c, 0x01, 0x00, 0xce,
+    0xb9, 0xef, 0x14, 0x57, 0x05, 0x41, 0x00, 0x00,
+    0x59, 0x96, 0x39, 0xab, 0xcc, 0x67, 0x23, 0x75,
+    0x5d, 0x6f, 0xdb, 0x56, 0x96, 0xa5, 0xb3, 0xfa,
+    0xfd, 0xdc, 0xac, 0xb5, 0x96, 0x52, 0xce, 0xf3,
+    0xdc, 0xf7, 0xfd, 0xad, 0xe9, 0x21, 0x02, 0x9b,
+    0xa2, 0x15, 0xe7, 0x7c, 0x5d, 0x57, 0xa7, 0xed,
+    0xf7, 0x38, 0x9b, 0xa6, 0x39, 0x29, 0x1f, 0x22,
+    0x88, 0x68, 0x9a, 0x26, 0x4b, 0x71, 0x9e, 0x86,
+    0xd7, 0x46, 0xe2, 0x38, 0x2e, 0x8a, 0x02, 0x00,
+    0x96, 0x65, 0xb9, 0x56, 0xbd, 0x10, 0x00, 0x10,
+    0x45, 0x11, 0x00, 0x84, 0x61, 0xf8, 0x39, 0xc2,
+    0x2a, 0x49, 0x12, 0xc7, 0xab, 0x4f, 0x16, 0x44,
+    0x24, 0x84, 0xa8, 0xaa, 0xca, 0x37, 0xce, 0xae,
+    0xeb, 0x00, 0x00, 0x11, 0x87, 0x61, 0x20, 0xa2,
+    0x7d, 0xdf, 0x11, 0x11, 0x11, 0xef, 0xe8, 0x0e,
+    0x84, 0x31, 0x86, 0x73, 0x7e, 0x8e, 0x89, 0x88,
+    0x77, 0x7f, 0xd4, 0xca, 0xeb, 0xc0, 0x9f, 0xf5,
+    0x5e, 0x9c, 0xff, 0x85, 0x78, 0x01, 0xaf, 0x3f,
+    0xf3, 0xda, 0xc7, 0xe6, 0x43, 0x3c, 0x00, 0x00,
+    0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42,
+    0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/4.png */
+const unsigned char letter_image_4[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x38, 0x3a, 0x30, 0x34, 0x3a, 0x30,
+    0x39, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x38, 0x3a, 0x30,
+    0x34, 0x3a, 0x30, 0x39, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x31, 0x32, 0x65, 0x36,
+    0x33, 0x38, 0x30, 0x62, 0x2d, 0x35, 0x66, 0x34,
+    0x34, 0x2d, 0x39, 0x33, 0x34, 0x32, 0x2d, 0x38,
+    0x64, 0x65, 0x38, 0x2d, 0x30, 0x62, 0x30, 0x37,
+    0x31, 0x30, 0x62, 0x66, 0x35, 0x64, 0x64, 0x38,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x65, 0x37, 0x64, 0x38, 0x31, 0x63,
+    0x66, 0x39, 0x2d, 0x39, 0x30, 0x64, 0x66, 0x2d,
+    0x32, 0x32, 0x34, 0x32, 0x2d, 0x38, 0x63, 0x39,
+    0x65, 0x2d, 0x61, 0x39, 0x62, 0x66, 0x34, 0x37,
+    0x33, 0x32, 0x64, 0x37, 0x33, 0x38, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x38, 0x31, 0x64, 0x38, 0x64, 0x62,
+    0x36, 0x34, 0x2d, 0x66, 0x31, 0x61, 0x34, 0x2d,
+    0x39, 0x39, 0x34, 0x36, 0x2d, 0x38, 0x35, 0x32,
+    0x34, 0x2d, 0x64, 0x30, 0x64, 0x34, 0x36, 0x35,
+    0x64, 0x31, 0x39, 0x36, 0x36, 0x30, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x34, 0x3a, 0x30, 0x39, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x32, 0x65, 0x36, 0x33, 0x38,
+    0x30, 0x62, 0x2d, 0x35, 0x66, 0x34, 0x34, 0x2d,
+    0x39, 0x33, 0x34, 0x32, 0x2d, 0x38, 0x64, 0x65,
+    0x38, 0x2d, 0x30, 0x62, 0x30, 0x37, 0x31, 0x30,
+    0x62, 0x66, 0x35, 0x64, 0x64, 0x38, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x34, 0x3a, 0x30, 0x39, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x38, 0x31, 0x64, 0x38,
+    0x64, 0x62, 0x36, 0x34, 0x2d, 0x66, 0x31, 0x61,
+    0x34, 0x2d, 0x39, 0x39, 0x34, 0x36, 0x2d, 0x38,
+    0x35, 0x32, 0x34, 0x2d, 0x64, 0x30, 0x64, 0x34,
+    0x36, 0x35, 0x64, 0x31, 0x39, 0x36, 0x36, 0x30,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0xae, 0xe7, 0xe8, 0x55, 0x00, 0x00,
+    0x00, 0xc0, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xcd, 0x94, 0xb1, 0x0d, 0x84, 0x30, 0x10, 0x04,
+    0xd7, 0xaf, 0xcf, 0x88, 0x88, 0x68, 0x80, 0x32,
+    0x68, 0x80, 0x0e, 0xe8, 0xc1, 0x19, 0x09, 0xc9,
+    0x59, 0x04, 0x4e, 0x28, 0xc2, 0x05, 0x70, 0x19,
+    0x0d, 0x50, 0x84, 0x0b, 0xa0, 0x00, 0x72, 0x13,
+    0xfb, 0xd3, 0xd7, 0x1b, 0x30, 0x32, 0x12, 0xfa,
+    0x0d, 0x4f, 0xbb, 0xa3, 0xbd, 0xe0, 0x4e, 0x78,
+    0xef, 0x71, 0x4f, 0xaf, 0xa8, 0xc3, 0x5a, 0x2b,
+    0x84, 0x50, 0x4a, 0xa5, 0x23, 0x86, 0x61, 0xb8,
+    0xd5, 0x82, 0x99, 0xc7, 0x71, 0x4c, 0x47, 0x2c,
+    0xcb, 0x62, 0x8c, 0x91, 0x52, 0xa6, 0x23, 0x88,
+    0xa8, 0xef, 0xfb, 0x3c, 0xcf, 0x13, 0x11, 0xcc,
+    0x5c, 0x96, 0x65, 0x55, 0x55, 0xe7, 0x79, 0x00,
+    0xef, 0xdd, 0xe9, 0xba, 0xae, 0xc6, 0x98, 0x69,
+    0x9a, 0xa2, 0xf9, 0xc3, 0x16, 0x5a, 0xeb, 0xb6,
+    0x6d, 0xb3, 0x2c, 0x4b, 0x44, 0x30, 0x33, 0x80,
+    0xba, 0xae, 0xaf, 0xe4, 0x11, 0x2e, 0xb2, 0x6d,
+    0x9b, 0xd6, 0x7a, 0x9e, 0xe7, 0x8b, 0xf9, 0x9d,
+    0x16, 0x5d, 0xd7, 0x29, 0xa5, 0x8a, 0xa2, 0xb8,
+    0x8e, 0x80, 0xff, 0x92, 0x73, 0xee, 0xdc, 0xdc,
+    0x34, 0x8d, 0x0f, 0x84, 0x70, 0xf4, 0x23, 0x22,
+    0x02, 0x40, 0x44, 0x47, 0x86, 0xf8, 0x8d, 0x44,
+    0xf5, 0x1f, 0x08, 0xf1, 0xc4, 0xcb, 0x79, 0x02,
+    0xf1, 0x01, 0x5b, 0xfd, 0x8f, 0x2e, 0x72, 0xfc,
+    0x70, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
+    0x4e, 0x44, 0xae, 0x42, 0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/5.png */
+const unsigned char letter_image_5[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x38, 0x3a, 0x30, 0x34, 0x3a, 0x32,
+    0x35, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x38, 0x3a, 0x30,
+    0x34, 0x3a, 0x32, 0x35, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x61, 0x65, 0x33, 0x62,
+    0x65, 0x37, 0x32, 0x30, 0x2d, 0x66, 0x34, 0x35,
+    0x61, 0x2d, 0x31, 0x62, 0x34, 0x34, 0x2d, 0x39,
+    0x64, 0x32, 0x66, 0x2d, 0x63, 0x65, 0x30, 0x31,
+    0x31, 0x62, 0x39, 0x61, 0x64, 0x38, 0x38, 0x31,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x38, 0x66, 0x65, 0x62, 0x35, 0x30,
+    0x65, 0x38, 0x2d, 0x31, 0x62, 0x37, 0x34, 0x2d,
+    0x61, 0x33, 0x34, 0x36, 0x2d, 0x39, 0x39, 0x63,
+    0x64, 0x2d, 0x31, 0x62, 0x36, 0x65, 0x63, 0x39,
+    0x32, 0x33, 0x38, 0x35, 0x32, 0x66, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x30, 0x62, 0x39, 0x63, 0x38, 0x31,
+    0x61, 0x37, 0x2d, 0x31, 0x37, 0x61, 0x39, 0x2d,
+    0x32, 0x65, 0x34, 0x36, 0x2d, 0x38, 0x35, 0x35,
+    0x30, 0x2d, 0x63, 0x33, 0x62, 0x30, 0x39, 0x35,
+    0x66, 0x33, 0x61, 0x30, 0x38, 0x61, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x34, 0x3a, 0x32, 0x35, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x61, 0x65, 0x33, 0x62, 0x65, 0x37,
+    0x32, 0x30, 0x2d, 0x66, 0x34, 0x35, 0x61, 0x2d,
+    0x31, 0x62, 0x34, 0x34, 0x2d, 0x39, 0x64, 0x32,
+    0x66, 0x2d, 0x63, 0x65, 0x30, 0x31, 0x31, 0x62,
+    0x39, 0x61, 0x64, 0x38, 0x38, 0x31, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x34, 0x3a, 0x32, 0x35, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x30, 0x62, 0x39, 0x63,
+    0x38, 0x31, 0x61, 0x37, 0x2d, 0x31, 0x37, 0x61,
+    0x39, 0x2d, 0x32, 0x65, 0x34, 0x36, 0x2d, 0x38,
+    0x35, 0x35, 0x30, 0x2d, 0x63, 0x33, 0x62, 0x30,
+    0x39, 0x35, 0x66, 0x33, 0x61, 0x30, 0x38, 0x61,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0x31, 0x1a, 0x2c, 0x15, 0x00, 0x00,
+    0x00, 0xda, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xbd, 0x94, 0xb1, 0x11, 0x83, 0x30, 0x0c, 0x45,
+    0x45, 0x5a, 0x46, 0x11, 0x23, 0xd0, 0xb3, 0x82,
+    0x77, 0xf0, 0x0a, 0x66, 0x02, 0x6d, 0x40, 0x45,
+    0xc9, 0x04, 0x5e, 0x80, 0x05, 0x28, 0x28, 0x45,
+    0xcf, 0x00, 0xea, 0x95, 0xc2, 0x77, 0x5c, 0x12,
+    0x6c, 0x03, 0xe1, 0x92, 0x5f, 0x5a, 0xf2, 0xbb,
+    0xef, 0x7f, 0xff, 0x5c, 0xa8, 0x2a, 0xdc, 0xd3,
+    0x23, 0x33, 0x5b, 0x96, 0xa5, 0x78, 0x57, 0xdb,
+    0xb6, 0xd7, 0x10, 0x7d, 0xdf, 0x7f, 0x9c, 0x34,
+    0x4d, 0x13, 0xd9, 0xd3, 0x84, 0x98, 0x19, 0x11,
+    0x45, 0x24, 0xb5, 0xb0, 0x29, 0x89, 0x70, 0xce,
+    0x0d, 0xc3, 0x70, 0x78, 0x3f, 0x89, 0x60, 0xe6,
+    0xe0, 0xd1, 0x5a, 0xdb, 0x75, 0xdd, 0x37, 0x08,
+    0xe7, 0xdc, 0xeb, 0x63, 0x11, 0xd1, 0x7b, 0x7f,
+    0x0d, 0x11, 0xe4, 0xbd, 0x27, 0xa2, 0x0d, 0x94,
+    0xa2, 0xe4, 0x10, 0x41, 0xeb, 0xba, 0x5a, 0x6b,
+    0x83, 0x97, 0x68, 0xba, 0xc7, 0x08, 0x55, 0x15,
+    0x11, 0x63, 0x0c, 0x00, 0x44, 0x03, 0xce, 0xf5,
+    0x62, 0x53, 0x59, 0x96, 0xc1, 0xc8, 0x3c, 0xcf,
+    0xfb, 0xe9, 0x29, 0x04, 0x00, 0xd4, 0x75, 0x8d,
+    0x88, 0xd1, 0xd1, 0x59, 0x44, 0x50, 0x55, 0x55,
+    0x91, 0xd3, 0x33, 0x59, 0x84, 0x50, 0x6f, 0xc5,
+    0xa9, 0xaa, 0x44, 0x94, 0x2a, 0x6b, 0x04, 0x31,
+    0x4d, 0x13, 0x00, 0x18, 0x63, 0xc6, 0x71, 0x54,
+    0x55, 0x11, 0xc9, 0x97, 0xfd, 0xb8, 0x9d, 0x44,
+    0xc4, 0xcc, 0x19, 0x83, 0x85, 0xfe, 0xf4, 0xcb,
+    0xf9, 0x1f, 0xe2, 0x09, 0xc9, 0x39, 0x91, 0xe0,
+    0x32, 0xa3, 0xcd, 0xc7, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+    
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/6.png */
+const unsigned char letter_image_6[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x38, 0x3a, 0x30, 0x36, 0x3a, 0x30,
+    0x36, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x38, 0x3a, 0x30,
+    0x36, 0x3a, 0x30, 0x36, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x62, 0x37, 0x39, 0x35,
+    0x61, 0x37, 0x38, 0x64, 0x2d, 0x34, 0x31, 0x35,
+    0x65, 0x2d, 0x61, 0x31, 0x34, 0x35, 0x2d, 0x61,
+    0x34, 0x66, 0x63, 0x2d, 0x39, 0x38, 0x61, 0x37,
+    0x64, 0x66, 0x35, 0x62, 0x31, 0x38, 0x38, 0x61,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x37, 0x30, 0x31, 0x39, 0x31, 0x30,
+    0x31, 0x34, 0x2d, 0x34, 0x38, 0x61, 0x62, 0x2d,
+    0x32, 0x36, 0x34, 0x63, 0x2d, 0x39, 0x36, 0x36,
+    0x36, 0x2d, 0x65, 0x38, 0x64, 0x62, 0x36, 0x66,
+    0x35, 0x62, 0x35, 0x62, 0x30, 0x35, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x38, 0x30, 0x30, 0x63, 0x64,
+    0x37, 0x31, 0x2d, 0x38, 0x64, 0x30, 0x30, 0x2d,
+    0x31, 0x38, 0x34, 0x35, 0x2d, 0x39, 0x61, 0x64,
+    0x63, 0x2d, 0x65, 0x32, 0x39, 0x30, 0x66, 0x61,
+    0x63, 0x66, 0x30, 0x64, 0x32, 0x37, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x36, 0x3a, 0x30, 0x36, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x62, 0x37, 0x39, 0x35, 0x61, 0x37,
+    0x38, 0x64, 0x2d, 0x34, 0x31, 0x35, 0x65, 0x2d,
+    0x61, 0x31, 0x34, 0x35, 0x2d, 0x61, 0x34, 0x66,
+    0x63, 0x2d, 0x39, 0x38, 0x61, 0x37, 0x64, 0x66,
+    0x35, 0x62, 0x31, 0x38, 0x38, 0x61, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x36, 0x3a, 0x30, 0x36, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x31, 0x38, 0x30, 0x30,
+    0x63, 0x64, 0x37, 0x31, 0x2d, 0x38, 0x64, 0x30,
+    0x30, 0x2d, 0x31, 0x38, 0x34, 0x35, 0x2d, 0x39,
+    0x61, 0x64, 0x63, 0x2d, 0x65, 0x32, 0x39, 0x30,
+    0x66, 0x61, 0x63, 0x66, 0x30, 0x64, 0x32, 0x37,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0x8b, 0x78, 0x8e, 0x68, 0x00, 0x00,
+    0x01, 0x22, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xbd, 0x94, 0xb1, 0xcd, 0x83, 0x30, 0x14, 0x84,
+    0xcf, 0xff, 0x02, 0x29, 0x42, 0x4d, 0x0d, 0x7a,
+    0x45, 0x16, 0x48, 0xf9, 0x24, 0x56, 0xf0, 0x0e,
+    0x59, 0xc1, 0x4c, 0xe0, 0x45, 0xcc, 0x02, 0xae,
+    0xe8, 0x9c, 0x8a, 0x8a, 0x16, 0xc9, 0x15, 0x15,
+    0x94, 0x41, 0xf4, 0xa4, 0x70, 0x13, 0x11, 0x0c,
+    0x48, 0xbf, 0x14, 0x97, 0xa7, 0xf7, 0x3e, 0x9f,
+    0x4e, 0x67, 0x8b, 0x65, 0x59, 0xf0, 0xbf, 0xf3,
+    0x77, 0x38, 0x51, 0x55, 0x55, 0x59, 0x96, 0x42,
+    0x08, 0x21, 0xc4, 0xf3, 0xf9, 0xdc, 0x98, 0x58,
+    0xe2, 0xc7, 0x7b, 0x2f, 0xa5, 0x04, 0xa0, 0x94,
+    0xb2, 0xd6, 0xc6, 0xc6, 0xa2, 0x08, 0xe7, 0x1c,
+    0x11, 0x31, 0xb3, 0x73, 0x6e, 0xe7, 0x9a, 0x28,
+    0xc2, 0x7b, 0x4f, 0x44, 0x44, 0x34, 0x0c, 0xc3,
+    0xfe, 0x7e, 0x14, 0xc1, 0xcc, 0x00, 0x76, 0xcc,
+    0x1f, 0x20, 0x8c, 0x31, 0x00, 0xa4, 0x94, 0x67,
+    0xf6, 0xb7, 0x11, 0xc1, 0x82, 0x31, 0x46, 0x6b,
+    0x1d, 0x22, 0x27, 0x22, 0x63, 0xcc, 0x59, 0x44,
+    0xdb, 0xb6, 0x61, 0x4d, 0x29, 0x15, 0x82, 0xf0,
+    0xde, 0x07, 0xa8, 0xd6, 0xfa, 0x14, 0xc2, 0x5a,
+    0x0b, 0x80, 0x99, 0x3f, 0x45, 0xe7, 0x5c, 0xe0,
+    0xb6, 0x6d, 0xfb, 0x8d, 0x58, 0x57, 0x6b, 0x9a,
+    0x26, 0x00, 0x49, 0x92, 0x7c, 0x8a, 0xf7, 0xfb,
+    0x3d, 0x18, 0x69, 0x9a, 0xe6, 0x6c, 0x3b, 0xaf,
+    0xd7, 0xeb, 0x4a, 0x29, 0x8a, 0x02, 0x40, 0xdf,
+    0xf7, 0xc7, 0x88, 0x2c, 0xcb, 0x00, 0x74, 0x5d,
+    0xb7, 0xd2, 0x2f, 0x97, 0x0b, 0x80, 0x34, 0x4d,
+    0x8f, 0x11, 0xb7, 0xdb, 0x8d, 0x99, 0xeb, 0xba,
+    0x1e, 0xc7, 0xf1, 0x53, 0x7f, 0xbd, 0x5e, 0x00,
+    0xf2, 0x3c, 0xdf, 0xf0, 0xfc, 0x1d, 0x4f, 0xe8,
+    0xc5, 0x2a, 0x7f, 0x66, 0x8e, 0x35, 0x65, 0xbb,
+    0x9d, 0x4a, 0x29, 0x00, 0xa1, 0x0b, 0xf3, 0x3c,
+    0x3f, 0x1e, 0x0f, 0x66, 0x8e, 0x95, 0x3d, 0xfa,
+    0xcc, 0x8c, 0x31, 0x44, 0x14, 0x9c, 0x6a, 0xad,
+    0xe7, 0x79, 0x8e, 0x4d, 0x8a, 0xe5, 0x07, 0x5f,
+    0xce, 0x2f, 0x10, 0x6f, 0x1d, 0xe6, 0x8b, 0x71,
+    0x95, 0xfc, 0x13, 0xa9, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+    
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/7.png */
+const unsigned char letter_image_7[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x38, 0x3a, 0x30, 0x34, 0x3a, 0x35,
+    0x34, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x38, 0x3a, 0x30,
+    0x34, 0x3a, 0x35, 0x34, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x36, 0x35, 0x36, 0x32,
+    0x63, 0x65, 0x33, 0x63, 0x2d, 0x63, 0x61, 0x62,
+    0x66, 0x2d, 0x36, 0x63, 0x34, 0x34, 0x2d, 0x62,
+    0x36, 0x62, 0x33, 0x2d, 0x34, 0x34, 0x62, 0x37,
+    0x33, 0x66, 0x37, 0x35, 0x33, 0x61, 0x66, 0x66,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x65, 0x66, 0x34, 0x66, 0x36, 0x66,
+    0x31, 0x35, 0x2d, 0x37, 0x32, 0x39, 0x32, 0x2d,
+    0x31, 0x37, 0x34, 0x38, 0x2d, 0x38, 0x33, 0x64,
+    0x64, 0x2d, 0x30, 0x64, 0x61, 0x38, 0x34, 0x33,
+    0x30, 0x33, 0x31, 0x61, 0x66, 0x63, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x64, 0x32, 0x62, 0x62, 0x37, 0x66,
+    0x35, 0x30, 0x2d, 0x37, 0x31, 0x65, 0x31, 0x2d,
+    0x37, 0x35, 0x34, 0x32, 0x2d, 0x61, 0x38, 0x39,
+    0x38, 0x2d, 0x34, 0x38, 0x66, 0x36, 0x31, 0x34,
+    0x39, 0x31, 0x39, 0x30, 0x65, 0x30, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x34, 0x3a, 0x35, 0x34, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x36, 0x35, 0x36, 0x32, 0x63, 0x65,
+    0x33, 0x63, 0x2d, 0x63, 0x61, 0x62, 0x66, 0x2d,
+    0x36, 0x63, 0x34, 0x34, 0x2d, 0x62, 0x36, 0x62,
+    0x33, 0x2d, 0x34, 0x34, 0x62, 0x37, 0x33, 0x66,
+    0x37, 0x35, 0x33, 0x61, 0x66, 0x66, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x34, 0x3a, 0x35, 0x34, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x64, 0x32, 0x62, 0x62,
+    0x37, 0x66, 0x35, 0x30, 0x2d, 0x37, 0x31, 0x65,
+    0x31, 0x2d, 0x37, 0x35, 0x34, 0x32, 0x2d, 0x61,
+    0x38, 0x39, 0x38, 0x2d, 0x34, 0x38, 0x66, 0x36,
+    0x31, 0x34, 0x39, 0x31, 0x39, 0x30, 0x65, 0x30,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0x0f, 0x45, 0x0d, 0x95, 0x00, 0x00,
+    0x00, 0xda, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xc5, 0x94, 0xb1, 0x0d, 0x83, 0x30, 0x10, 0x45,
+    0x8f, 0xb4, 0x0c, 0xc0, 0x00, 0x94, 0x6e, 0x69,
+    0x91, 0x28, 0x28, 0x69, 0xe8, 0xd8, 0x81, 0x15,
+    0x18, 0xe8, 0x18, 0xe0, 0x4c, 0x8b, 0xb0, 0xc4,
+    0x0e, 0x6c, 0x60, 0x7a, 0xa8, 0x2f, 0x6d, 0x82,
+    0xcd, 0xd9, 0x4a, 0x14, 0xe5, 0x97, 0xf6, 0xf9,
+    0xd9, 0xef, 0x6c, 0x39, 0x61, 0x66, 0xf8, 0x2e,
+    0x0f, 0x77, 0x68, 0x9a, 0xa6, 0xe4, 0x26, 0xe3,
+    0x38, 0x46, 0x21, 0x88, 0xe8, 0x6e, 0xc3, 0xa2,
+    0x28, 0xc2, 0x88, 0x7d, 0xdf, 0xb7, 0x6d, 0x33,
+    0xc6, 0xf0, 0x7b, 0x86, 0x61, 0xa8, 0xeb, 0x3a,
+    0xcf, 0x73, 0x0f, 0xf8, 0x52, 0x8a, 0x88, 0xd6,
+    0x5a, 0x76, 0xa2, 0x94, 0x42, 0x44, 0x77, 0x9c,
+    0x99, 0xaf, 0x08, 0x6f, 0xb4, 0xd6, 0x00, 0xe0,
+    0x45, 0x33, 0xb3, 0xa7, 0x17, 0x6e, 0xd6, 0x75,
+    0xed, 0xba, 0x2e, 0xcb, 0x32, 0xff, 0x74, 0xf0,
+    0x08, 0xc7, 0x71, 0x08, 0x16, 0x51, 0x22, 0xb2,
+    0x45, 0x94, 0x08, 0x11, 0xf5, 0x7d, 0x7f, 0x6b,
+    0xe1, 0x7d, 0x17, 0xaf, 0x39, 0xcf, 0x73, 0x9e,
+    0xe7, 0xb2, 0x2c, 0x85, 0x9a, 0x00, 0x62, 0x59,
+    0x16, 0x00, 0x68, 0x9a, 0xe6, 0x73, 0x04, 0x11,
+    0x55, 0x55, 0x95, 0xa6, 0xa9, 0x54, 0x24, 0x34,
+    0xd2, 0x5a, 0x0b, 0x00, 0x5a, 0x6b, 0xb9, 0xdf,
+    0x12, 0x02, 0x11, 0x95, 0x52, 0xf2, 0xfa, 0xc0,
+    0x8d, 0x18, 0x63, 0xda, 0xb6, 0x95, 0x4d, 0x25,
+    0x91, 0x48, 0x0b, 0x66, 0x4e, 0xf8, 0x17, 0x5f,
+    0xce, 0x1f, 0x10, 0x4f, 0x6c, 0x19, 0xec, 0x8e,
+    0x6d, 0xc2, 0xfd, 0xca, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+    
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/8.png */
+const unsigned char letter_image_8[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x38, 0x3a, 0x30, 0x35, 0x3a, 0x31,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x38, 0x3a, 0x30,
+    0x35, 0x3a, 0x31, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x63, 0x63, 0x61, 0x62,
+    0x66, 0x30, 0x61, 0x37, 0x2d, 0x61, 0x38, 0x33,
+    0x30, 0x2d, 0x63, 0x63, 0x34, 0x30, 0x2d, 0x62,
+    0x32, 0x31, 0x61, 0x2d, 0x35, 0x36, 0x31, 0x62,
+    0x64, 0x34, 0x30, 0x30, 0x64, 0x37, 0x36, 0x64,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x38, 0x62, 0x30, 0x32, 0x30, 0x66,
+    0x33, 0x36, 0x2d, 0x66, 0x32, 0x32, 0x38, 0x2d,
+    0x39, 0x37, 0x34, 0x66, 0x2d, 0x39, 0x30, 0x63,
+    0x36, 0x2d, 0x33, 0x32, 0x34, 0x37, 0x65, 0x61,
+    0x66, 0x32, 0x37, 0x34, 0x66, 0x37, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x65, 0x34, 0x36, 0x35, 0x37, 0x30,
+    0x31, 0x33, 0x2d, 0x36, 0x39, 0x31, 0x66, 0x2d,
+    0x65, 0x38, 0x34, 0x31, 0x2d, 0x39, 0x30, 0x62,
+    0x32, 0x2d, 0x64, 0x65, 0x38, 0x30, 0x61, 0x62,
+    0x37, 0x31, 0x64, 0x39, 0x66, 0x63, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x35, 0x3a, 0x31, 0x33, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x63, 0x63, 0x61, 0x62, 0x66, 0x30,
+    0x61, 0x37, 0x2d, 0x61, 0x38, 0x33, 0x30, 0x2d,
+    0x63, 0x63, 0x34, 0x30, 0x2d, 0x62, 0x32, 0x31,
+    0x61, 0x2d, 0x35, 0x36, 0x31, 0x62, 0x64, 0x34,
+    0x30, 0x30, 0x64, 0x37, 0x36, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x35, 0x3a, 0x31, 0x33, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x65, 0x34, 0x36, 0x35,
+    0x37, 0x30, 0x31, 0x33, 0x2d, 0x36, 0x39, 0x31,
+    0x66, 0x2d, 0x65, 0x38, 0x34, 0x31, 0x2d, 0x39,
+    0x30, 0x62, 0x32, 0x2d, 0x64, 0x65, 0x38, 0x30,
+    0x61, 0x62, 0x37, 0x31, 0x64, 0x39, 0x66, 0x63,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0x77, 0xea, 0x0d, 0x39, 0x00, 0x00,
+    0x01, 0x28, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xbd, 0x94, 0xbd, 0x91, 0x87, 0x20, 0x10, 0xc5,
+    0xd7, 0x4b, 0xb5, 0x81, 0x7f, 0x6c, 0x48, 0x03,
+    0xe6, 0x50, 0x80, 0x21, 0x3d, 0xd0, 0x02, 0x54,
+    0x60, 0x07, 0x56, 0x80, 0x0d, 0x18, 0x3b, 0x63,
+    0x01, 0x92, 0x98, 0x51, 0x00, 0x44, 0x24, 0xe4,
+    0x7b, 0xc1, 0xce, 0x39, 0x8e, 0x1f, 0x33, 0x3a,
+    0x37, 0x77, 0x2f, 0x7c, 0xc0, 0x8f, 0x7d, 0xec,
+    0x0e, 0x05, 0x22, 0xc2, 0xef, 0xf4, 0x75, 0xe9,
+    0xc6, 0x18, 0x8d, 0x31, 0xc5, 0x8f, 0x8c, 0x31,
+    0x31, 0xc6, 0x17, 0x88, 0x18, 0x23, 0xe7, 0x3c,
+    0xa5, 0x94, 0x73, 0x46, 0xc4, 0x10, 0x42, 0x4a,
+    0x89, 0x73, 0x7e, 0x4b, 0xc1, 0x93, 0x94, 0x52,
+    0x8c, 0xb1, 0xbd, 0x13, 0x42, 0x00, 0x00, 0xad,
+    0xf5, 0x79, 0x33, 0x22, 0x5e, 0x54, 0x31, 0x4d,
+    0xd3, 0xc1, 0xa9, 0xaa, 0x0a, 0x00, 0xbc, 0xf7,
+    0x4f, 0x83, 0x7c, 0x3e, 0x9f, 0x75, 0x5d, 0x87,
+    0x61, 0xd8, 0x1c, 0x3a, 0xdc, 0xb6, 0xed, 0xd3,
+    0x20, 0xe3, 0x38, 0xd2, 0x92, 0xb5, 0x16, 0x11,
+    0x73, 0xce, 0x52, 0xca, 0xbb, 0x14, 0x88, 0x78,
+    0x81, 0x40, 0xc4, 0xbe, 0xef, 0x89, 0xa2, 0x94,
+    0x92, 0x52, 0x12, 0xeb, 0x1d, 0x02, 0x11, 0xad,
+    0xb5, 0x44, 0x11, 0x42, 0x78, 0xef, 0x5f, 0x23,
+    0x72, 0xce, 0x4a, 0x29, 0xad, 0x35, 0x63, 0x8c,
+    0x40, 0xf3, 0x3c, 0xbf, 0x40, 0xec, 0xc3, 0x87,
+    0x10, 0xa4, 0x94, 0x44, 0x71, 0xce, 0x3d, 0x45,
+    0x68, 0xad, 0x0f, 0x07, 0x94, 0x52, 0x94, 0xe8,
+    0x11, 0x82, 0xa6, 0x08, 0x00, 0x68, 0x34, 0xb7,
+    0xba, 0x84, 0x10, 0x00, 0x10, 0x42, 0x38, 0x23,
+    0x8e, 0x73, 0x91, 0x73, 0x3e, 0x37, 0xbe, 0x2c,
+    0xcb, 0xa6, 0x69, 0xee, 0x56, 0x8f, 0x88, 0xba,
+    0xae, 0xe9, 0xc2, 0x65, 0x59, 0xf6, 0xbe, 0xf7,
+    0x5e, 0x08, 0x51, 0xd7, 0xf5, 0xa3, 0xd1, 0x72,
+    0xce, 0x01, 0x00, 0x63, 0x6c, 0xeb, 0x42, 0xd7,
+    0x75, 0x8c, 0xb1, 0xbb, 0xd6, 0x5e, 0x37, 0xd5,
+    0x7b, 0x4f, 0x8f, 0x4a, 0xd2, 0x5a, 0x5f, 0xbe,
+    0x02, 0xa9, 0xc0, 0x3f, 0xfa, 0x72, 0xfe, 0x1b,
+    0xf1, 0x0d, 0x4f, 0x07, 0x5d, 0xdd, 0x01, 0xc1,
+    0x13, 0x60, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
+    0x4e, 0x44, 0xae, 0x42, 0x60, 0x82, 
+};
+/* GENERATED WITH _bin2c, FROM FILE pictures/9.png */
+const unsigned char letter_image_9[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a,
+    0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x08, 0x02, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x5a,
+    0x67, 0x00, 0x00, 0x01, 0x37, 0x69, 0x43, 0x43,
+    0x50, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52,
+    0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39, 0x38,
+    0x29, 0x00, 0x00, 0x28, 0x91, 0x95, 0x8f, 0xbf,
+    0x4a, 0xc3, 0x50, 0x14, 0x87, 0xbf, 0x1b, 0x45,
+    0xc5, 0xa1, 0x56, 0x08, 0xe2, 0xe0, 0x70, 0x27,
+    0x51, 0x50, 0x6c, 0xd5, 0xc1, 0x8c, 0x49, 0x5b,
+    0x8a, 0x20, 0x58, 0xab, 0x43, 0x92, 0xad, 0x49,
+    0x43, 0x95, 0x62, 0x12, 0x6e, 0xae, 0x7f, 0xfa,
+    0x10, 0x8e, 0x6e, 0x1d, 0x5c, 0xdc, 0x7d, 0x02,
+    0x27, 0x47, 0xc1, 0x41, 0xf1, 0x09, 0x7c, 0x03,
+    0xc5, 0xa9, 0x83, 0x43, 0x84, 0x0c, 0x05, 0x8b,
+    0xdf, 0xf4, 0x9d, 0xdf, 0x39, 0x1c, 0xce, 0x01,
+    0xa3, 0x62, 0xd7, 0x9d, 0x86, 0x51, 0x86, 0xf3,
+    0x58, 0xab, 0x76, 0xd3, 0x91, 0xae, 0xe7, 0xcb,
+    0xd9, 0x17, 0x66, 0x98, 0x02, 0x80, 0x4e, 0x98,
+    0xa5, 0x76, 0xab, 0x75, 0x00, 0x10, 0x27, 0x71,
+    0xc4, 0x18, 0xdf, 0xef, 0x08, 0x80, 0xd7, 0x4d,
+    0xbb, 0xee, 0x34, 0xc6, 0xfb, 0x7f, 0x32, 0x1f,
+    0xa6, 0x4a, 0x03, 0x23, 0x60, 0xbb, 0x1b, 0x65,
+    0x21, 0x88, 0x0a, 0xd0, 0xbf, 0xd2, 0xa9, 0x06,
+    0x31, 0x04, 0xcc, 0xa0, 0x9f, 0x6a, 0x10, 0x0f,
+    0x80, 0xa9, 0x4e, 0xda, 0x35, 0x10, 0x4f, 0x40,
+    0xa9, 0x97, 0xfb, 0x1b, 0x50, 0x0a, 0x72, 0xff,
+    0x00, 0x4a, 0xca, 0xf5, 0x7c, 0x10, 0x5f, 0x80,
+    0xd9, 0x73, 0x3d, 0x1f, 0x8c, 0x39, 0xc0, 0x0c,
+    0x72, 0x5f, 0x01, 0x4c, 0x1d, 0x5d, 0x6b, 0x80,
+    0x5a, 0x92, 0x0e, 0xd4, 0x59, 0xef, 0x54, 0xcb,
+    0xaa, 0x65, 0x59, 0xd2, 0xee, 0x26, 0x41, 0x24,
+    0x8f, 0x07, 0x99, 0x8e, 0xce, 0x33, 0xb9, 0x1f,
+    0x87, 0x89, 0x4a, 0x13, 0xd5, 0xd1, 0x51, 0x17,
+    0xc8, 0xef, 0x03, 0x60, 0x31, 0x1f, 0x6c, 0x37,
+    0x1d, 0xb9, 0x56, 0xb5, 0xac, 0xbd, 0xf5, 0x7f,
+    0xfe, 0x3d, 0x11, 0xd7, 0xf3, 0x65, 0x6e, 0x9f,
+    0x47, 0x08, 0x40, 0x2c, 0x3d, 0x17, 0x59, 0x41,
+    0x78, 0xa1, 0x2e, 0x7f, 0x55, 0x18, 0x3b, 0x93,
+    0xeb, 0x62, 0xc7, 0x70, 0x19, 0x0e, 0xef, 0x61,
+    0x7a, 0x54, 0x64, 0xbb, 0x37, 0x70, 0xb7, 0x01,
+    0x0b, 0xb7, 0x45, 0xb6, 0x5a, 0x85, 0xf2, 0x16,
+    0x3c, 0x0e, 0x7f, 0x00, 0xc0, 0xc6, 0x4f, 0xfd,
+    0xf3, 0x53, 0x3f, 0xc8, 0x00, 0x00, 0x00, 0x09,
+    0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13,
+    0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c,
+    0x18, 0x00, 0x00, 0x0b, 0x99, 0x69, 0x54, 0x58,
+    0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f, 0x6d,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78,
+    0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22,
+    0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43,
+    0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+    0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39,
+    0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+    0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20,
+    0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+    0x22, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e,
+    0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22,
+    0x20, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
+    0x20, 0x35, 0x2e, 0x36, 0x2d, 0x63, 0x31, 0x34,
+    0x32, 0x20, 0x37, 0x39, 0x2e, 0x31, 0x36, 0x30,
+    0x39, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x30, 0x31,
+    0x37, 0x2f, 0x30, 0x37, 0x2f, 0x31, 0x33, 0x2d,
+    0x30, 0x31, 0x3a, 0x30, 0x36, 0x3a, 0x33, 0x39,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
+    0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+    0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32,
+    0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+    0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e,
+    0x73, 0x23, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+    0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d,
+    0x22, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e,
+    0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
+    0x73, 0x3a, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61,
+    0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d,
+    0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22,
+    0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64,
+    0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f,
+    0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31,
+    0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
+    0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d,
+    0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+    0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+    0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d,
+    0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73,
+    0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22,
+    0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+    0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e,
+    0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+    0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70,
+    0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72,
+    0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x73, 0x74, 0x52, 0x65, 0x66, 0x3d, 0x22, 0x68,
+    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73,
+    0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63,
+    0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65,
+    0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+    0x65, 0x52, 0x65, 0x66, 0x23, 0x22, 0x20, 0x78,
+    0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x74, 0x69, 0x66,
+    0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f,
+    0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x74,
+    0x69, 0x66, 0x66, 0x2f, 0x31, 0x2e, 0x30, 0x2f,
+    0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a,
+    0x65, 0x78, 0x69, 0x66, 0x3d, 0x22, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e,
+    0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f,
+    0x6d, 0x2f, 0x65, 0x78, 0x69, 0x66, 0x2f, 0x31,
+    0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70,
+    0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x37, 0x3a, 0x30,
+    0x37, 0x3a, 0x34, 0x33, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
+    0x4d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x38, 0x3a, 0x30, 0x35, 0x3a, 0x33,
+    0x31, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64,
+    0x69, 0x66, 0x79, 0x44, 0x61, 0x74, 0x65, 0x3d,
+    0x22, 0x32, 0x30, 0x31, 0x39, 0x2d, 0x31, 0x32,
+    0x2d, 0x30, 0x34, 0x54, 0x31, 0x38, 0x3a, 0x30,
+    0x35, 0x3a, 0x33, 0x31, 0x2b, 0x30, 0x33, 0x3a,
+    0x30, 0x30, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x43, 0x6f,
+    0x6c, 0x6f, 0x72, 0x4d, 0x6f, 0x64, 0x65, 0x3d,
+    0x22, 0x33, 0x22, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x49, 0x43,
+    0x43, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65,
+    0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20,
+    0x52, 0x47, 0x42, 0x20, 0x28, 0x31, 0x39, 0x39,
+    0x38, 0x29, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x66,
+    0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69,
+    0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x32, 0x31, 0x30, 0x39,
+    0x65, 0x36, 0x39, 0x64, 0x2d, 0x35, 0x64, 0x64,
+    0x62, 0x2d, 0x37, 0x34, 0x34, 0x63, 0x2d, 0x39,
+    0x30, 0x33, 0x32, 0x2d, 0x35, 0x30, 0x34, 0x62,
+    0x31, 0x63, 0x31, 0x36, 0x34, 0x36, 0x36, 0x61,
+    0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x61, 0x64, 0x6f, 0x62,
+    0x65, 0x3a, 0x64, 0x6f, 0x63, 0x69, 0x64, 0x3a,
+    0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f,
+    0x70, 0x3a, 0x38, 0x65, 0x34, 0x31, 0x62, 0x35,
+    0x36, 0x65, 0x2d, 0x37, 0x38, 0x65, 0x61, 0x2d,
+    0x37, 0x61, 0x34, 0x64, 0x2d, 0x62, 0x66, 0x62,
+    0x30, 0x2d, 0x34, 0x33, 0x38, 0x65, 0x62, 0x64,
+    0x32, 0x64, 0x30, 0x39, 0x64, 0x31, 0x22, 0x20,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72,
+    0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69,
+    0x64, 0x3a, 0x37, 0x37, 0x64, 0x36, 0x64, 0x36,
+    0x33, 0x38, 0x2d, 0x33, 0x66, 0x64, 0x35, 0x2d,
+    0x64, 0x61, 0x34, 0x32, 0x2d, 0x61, 0x32, 0x65,
+    0x32, 0x2d, 0x38, 0x61, 0x37, 0x66, 0x64, 0x35,
+    0x38, 0x34, 0x64, 0x66, 0x61, 0x36, 0x22, 0x20,
+    0x74, 0x69, 0x66, 0x66, 0x3a, 0x4f, 0x72, 0x69,
+    0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x31, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x58, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x59, 0x52, 0x65, 0x73, 0x6f, 0x6c,
+    0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x37,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x2f, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x22, 0x20, 0x74, 0x69, 0x66,
+    0x66, 0x3a, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x55, 0x6e, 0x69, 0x74,
+    0x3d, 0x22, 0x32, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x53,
+    0x70, 0x61, 0x63, 0x65, 0x3d, 0x22, 0x36, 0x35,
+    0x35, 0x33, 0x35, 0x22, 0x20, 0x65, 0x78, 0x69,
+    0x66, 0x3a, 0x50, 0x69, 0x78, 0x65, 0x6c, 0x58,
+    0x44, 0x69, 0x6d, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+    0x6e, 0x3d, 0x22, 0x32, 0x30, 0x30, 0x22, 0x20,
+    0x65, 0x78, 0x69, 0x66, 0x3a, 0x50, 0x69, 0x78,
+    0x65, 0x6c, 0x59, 0x44, 0x69, 0x6d, 0x65, 0x6e,
+    0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x22, 0x3e, 0x20, 0x3c, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65,
+    0x78, 0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x42,
+    0x61, 0x67, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66,
+    0x3a, 0x6c, 0x69, 0x20, 0x70, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61,
+    0x79, 0x65, 0x72, 0x4e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x20, 0x41, 0x20, 0x42, 0x20, 0x43, 0x20,
+    0x44, 0x20, 0x45, 0x20, 0x46, 0x20, 0x47, 0x20,
+    0x4b, 0x20, 0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20,
+    0x4f, 0x20, 0x50, 0x20, 0x51, 0x20, 0x52, 0x20,
+    0x53, 0x20, 0x54, 0x20, 0x55, 0x20, 0x56, 0x20,
+    0x57, 0x20, 0x58, 0x20, 0x59, 0x20, 0x5a, 0x20,
+    0x30, 0x20, 0x31, 0x20, 0x32, 0x20, 0x33, 0x20,
+    0x34, 0x20, 0x35, 0x20, 0x36, 0x20, 0x37, 0x20,
+    0x22, 0x20, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x3a, 0x4c, 0x61, 0x79, 0x65,
+    0x72, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x22, 0x20,
+    0x41, 0x20, 0x42, 0x20, 0x43, 0x20, 0x44, 0x20,
+    0x45, 0x20, 0x46, 0x20, 0x47, 0x20, 0x4b, 0x20,
+    0x4c, 0x20, 0x4d, 0x20, 0x4e, 0x20, 0x4f, 0x20,
+    0x50, 0x20, 0x51, 0x20, 0x52, 0x20, 0x53, 0x20,
+    0x54, 0x20, 0x55, 0x20, 0x56, 0x20, 0x57, 0x20,
+    0x58, 0x20, 0x59, 0x20, 0x5a, 0x20, 0x30, 0x20,
+    0x31, 0x20, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20,
+    0x35, 0x20, 0x36, 0x20, 0x37, 0x20, 0x38, 0x20,
+    0x39, 0x20, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f,
+    0x72, 0x64, 0x66, 0x3a, 0x42, 0x61, 0x67, 0x3e,
+    0x20, 0x3c, 0x2f, 0x70, 0x68, 0x6f, 0x74, 0x6f,
+    0x73, 0x68, 0x6f, 0x70, 0x3a, 0x54, 0x65, 0x78,
+    0x74, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x3e,
+    0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a,
+    0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
+    0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65,
+    0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
+    0x31, 0x39, 0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34,
+    0x54, 0x31, 0x37, 0x3a, 0x30, 0x37, 0x3a, 0x34,
+    0x33, 0x2b, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x22,
+    0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x73,
+    0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41,
+    0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64,
+    0x6f, 0x62, 0x65, 0x20, 0x50, 0x68, 0x6f, 0x74,
+    0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x43, 0x43,
+    0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x28, 0x57,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x61, 0x35, 0x39, 0x65, 0x35,
+    0x62, 0x65, 0x2d, 0x33, 0x32, 0x31, 0x34, 0x2d,
+    0x63, 0x32, 0x34, 0x61, 0x2d, 0x39, 0x62, 0x30,
+    0x61, 0x2d, 0x39, 0x64, 0x36, 0x37, 0x39, 0x61,
+    0x31, 0x63, 0x30, 0x64, 0x66, 0x33, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x37, 0x3a, 0x35, 0x30, 0x3a, 0x31, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x31, 0x37, 0x36, 0x37, 0x35, 0x34,
+    0x39, 0x35, 0x2d, 0x39, 0x34, 0x35, 0x38, 0x2d,
+    0x66, 0x61, 0x34, 0x61, 0x2d, 0x62, 0x66, 0x32,
+    0x37, 0x2d, 0x36, 0x37, 0x32, 0x62, 0x33, 0x64,
+    0x33, 0x61, 0x64, 0x30, 0x39, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x35, 0x3a, 0x33, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+    0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76,
+    0x74, 0x3a, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65,
+    0x74, 0x65, 0x72, 0x73, 0x3d, 0x22, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65,
+    0x72, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6f, 0x6d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x76,
+    0x6e, 0x64, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+    0x2e, 0x70, 0x68, 0x6f, 0x74, 0x6f, 0x73, 0x68,
+    0x6f, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d,
+    0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+    0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74,
+    0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+    0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x69, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
+    0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69,
+    0x64, 0x3a, 0x32, 0x31, 0x30, 0x39, 0x65, 0x36,
+    0x39, 0x64, 0x2d, 0x35, 0x64, 0x64, 0x62, 0x2d,
+    0x37, 0x34, 0x34, 0x63, 0x2d, 0x39, 0x30, 0x33,
+    0x32, 0x2d, 0x35, 0x30, 0x34, 0x62, 0x31, 0x63,
+    0x31, 0x36, 0x34, 0x36, 0x36, 0x61, 0x22, 0x20,
+    0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68,
+    0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30, 0x31, 0x39,
+    0x2d, 0x31, 0x32, 0x2d, 0x30, 0x34, 0x54, 0x31,
+    0x38, 0x3a, 0x30, 0x35, 0x3a, 0x33, 0x31, 0x2b,
+    0x30, 0x33, 0x3a, 0x30, 0x30, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x73, 0x6f, 0x66,
+    0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65,
+    0x6e, 0x74, 0x3d, 0x22, 0x41, 0x64, 0x6f, 0x62,
+    0x65, 0x20, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x73,
+    0x68, 0x6f, 0x70, 0x20, 0x43, 0x43, 0x20, 0x32,
+    0x30, 0x31, 0x38, 0x20, 0x28, 0x57, 0x69, 0x6e,
+    0x64, 0x6f, 0x77, 0x73, 0x29, 0x22, 0x20, 0x73,
+    0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68, 0x61,
+    0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22,
+    0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
+    0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
+    0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c,
+    0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x65,
+    0x72, 0x69, 0x76, 0x65, 0x64, 0x46, 0x72, 0x6f,
+    0x6d, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x69, 0x69, 0x64, 0x3a, 0x31, 0x37, 0x36, 0x37,
+    0x35, 0x34, 0x39, 0x35, 0x2d, 0x39, 0x34, 0x35,
+    0x38, 0x2d, 0x66, 0x61, 0x34, 0x61, 0x2d, 0x62,
+    0x66, 0x32, 0x37, 0x2d, 0x36, 0x37, 0x32, 0x62,
+    0x33, 0x64, 0x33, 0x61, 0x64, 0x30, 0x39, 0x64,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x20, 0x73, 0x74, 0x52, 0x65, 0x66, 0x3a,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+    0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
+    0x64, 0x69, 0x64, 0x3a, 0x37, 0x37, 0x64, 0x36,
+    0x64, 0x36, 0x33, 0x38, 0x2d, 0x33, 0x66, 0x64,
+    0x35, 0x2d, 0x64, 0x61, 0x34, 0x32, 0x2d, 0x61,
+    0x32, 0x65, 0x32, 0x2d, 0x38, 0x61, 0x37, 0x66,
+    0x64, 0x35, 0x38, 0x34, 0x64, 0x66, 0x61, 0x36,
+    0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64,
+    0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46,
+    0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d,
+    0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e, 0x20, 0x3c,
+    0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x65, 0x6e, 0x64, 0x3d, 0x22, 0x72, 0x22,
+    0x3f, 0x3e, 0xd8, 0x95, 0x1a, 0xae, 0x00, 0x00,
+    0x01, 0x1e, 0x49, 0x44, 0x41, 0x54, 0x38, 0x8d,
+    0xbd, 0x94, 0xb1, 0x8d, 0x80, 0x20, 0x18, 0x85,
+    0x1f, 0x37, 0x80, 0x96, 0x76, 0xb6, 0x16, 0x58,
+    0x3b, 0x01, 0x43, 0xb8, 0x03, 0x2b, 0xe8, 0x04,
+    0x6c, 0xe0, 0x04, 0xb8, 0x83, 0x9d, 0xb5, 0x89,
+    0x56, 0xc6, 0x04, 0x1b, 0x0b, 0x83, 0xa5, 0xc6,
+    0x9e, 0x2b, 0x48, 0x2e, 0xc6, 0x83, 0xe8, 0xe5,
+    0x72, 0xf7, 0xca, 0x07, 0xff, 0x07, 0xbc, 0xff,
+    0x0f, 0xc4, 0x18, 0x83, 0xdf, 0xe9, 0xc3, 0xb7,
+    0xb0, 0x6d, 0x5b, 0x59, 0x96, 0x84, 0x10, 0x42,
+    0x48, 0x9a, 0xa6, 0x75, 0x5d, 0x7b, 0x19, 0xc6,
+    0x25, 0xad, 0x35, 0xa5, 0x94, 0x73, 0x7e, 0x9e,
+    0xa7, 0x31, 0x46, 0x4a, 0x09, 0xa0, 0x28, 0x0a,
+    0xe7, 0x66, 0x37, 0x22, 0xcf, 0x73, 0xc6, 0xd8,
+    0xd5, 0xa9, 0xaa, 0x0a, 0x80, 0x94, 0xf2, 0x15,
+    0xa2, 0x6d, 0x5b, 0x00, 0x42, 0x88, 0xdb, 0xbd,
+    0x00, 0xdc, 0xb8, 0x56, 0x8e, 0x2c, 0xc6, 0x71,
+    0x04, 0x10, 0x86, 0xe1, 0xd5, 0x8c, 0xa2, 0x88,
+    0x31, 0xd6, 0x34, 0xcd, 0x30, 0x0c, 0xcf, 0x71,
+    0x2e, 0xcb, 0x02, 0x60, 0xdf, 0xf7, 0x9b, 0x9f,
+    0x24, 0x09, 0x80, 0x75, 0x5d, 0x9f, 0x11, 0x71,
+    0x1c, 0x03, 0xe8, 0xba, 0xce, 0x19, 0xff, 0x71,
+    0x1c, 0xcf, 0x88, 0x2c, 0xcb, 0x00, 0x48, 0x29,
+    0xe7, 0x79, 0xbe, 0xfa, 0xd3, 0x34, 0x01, 0x08,
+    0x82, 0xe0, 0x5e, 0xe0, 0xec, 0x88, 0x10, 0x02,
+    0x00, 0x63, 0x4c, 0x29, 0x65, 0xb3, 0xb4, 0x0e,
+    0x80, 0xbe, 0xef, 0x5f, 0x35, 0xd5, 0x18, 0x23,
+    0xa5, 0xa4, 0x94, 0xda, 0xb2, 0xaa, 0xaa, 0xec,
+    0x68, 0x38, 0x3b, 0xe2, 0x45, 0xdc, 0x54, 0x14,
+    0x05, 0xde, 0xcf, 0xc5, 0x77, 0xd9, 0x49, 0x71,
+    0x5e, 0xe1, 0x15, 0x42, 0x6b, 0xcd, 0x18, 0xa3,
+    0x94, 0xda, 0x5c, 0x7e, 0x8c, 0xf8, 0xaa, 0x6f,
+    0xdb, 0xd6, 0xb7, 0xc7, 0x8b, 0x50, 0x4a, 0xd9,
+    0x2e, 0xe4, 0x79, 0xee, 0x3b, 0xdf, 0x8b, 0xb0,
+    0x2f, 0x07, 0xc0, 0x39, 0x77, 0xe6, 0x77, 0x13,
+    0x31, 0x7f, 0xf7, 0xe5, 0xfc, 0x2b, 0xe2, 0x13,
+    0x5b, 0xb4, 0x99, 0x9c, 0xcd, 0x25, 0xaf, 0x21,
+    0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44,
+    0xae, 0x42, 0x60, 0x82, 
+};
@@ -1,5 +1,5 @@
 // +-------------------------------------------------------------------------+
-// |                     I n i F i l e    vers. 0.3.24                       |
+// |                     I n i F i l e    vers. 0.3.25                       |
 // | Copyright (c) Andrey Vikt. Stolyarov [http://www.croco.net/]  2003-2023 |
 // | ----------------------------------------------------------------------- |
 // | This is free software.  Permission is granted to everyone to use, copy  |
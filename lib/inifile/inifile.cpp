@@ -1,5 +1,5 @@
 // +-------------------------------------------------------------------------+
-// |                     I n i F i l e    vers. 0.3.24                       |
+// |                     I n i F i l e    vers. 0.3.25                       |
 // | Copyright (c) Andrey Vikt. Stolyarov [http://www.croco.net/]  2003-2023 |
 // | ----------------------------------------------------------------------- |
 // | This is free software.  Permission is granted to everyone to use, copy  |
@@ -23,9 +23,17 @@
 
 #include "inifile.hpp"
 
+enum { inifile_hash_initial_size = 64 };   /* must be a power of 2 */
+
 IniFileParser::IniFileParser()
 {
     firstgroup = 0;
+    lastgroup = 0;
+    hash_size = inifile_hash_initial_size;
+    hash_table = new Entry*[hash_size];
+    memset(hash_table, 0, sizeof(*hash_table) * hash_size);
+    hash_count = 0;
+    lookup_count = 0;
     last_error_line = -1;
     last_error_description = 0;
 }
@@ -33,6 +41,7 @@ IniFileParser::IniFileParser()
 IniFileParser::~IniFileParser()
 {
     if(firstgroup) delete firstgroup;
+    delete[] hash_table;
 }
 
 static bool is_empty_line(const char *s)
@@ -108,7 +117,7 @@ bool IniFileParser::Load(const char *path)
                 last_error_description = "invalid dictionary line syntax";
                 return false;
             }
-            current_parameter = current_section->ProvideParameter(name);
+            current_parameter = ProvideParameter(current_section, name);
             current_parameter->AddDictionaryData(value);
         }
     }
@@ -150,27 +159,17 @@ int IniFileParser::GetGroupCount() const
 
 int IniFileParser::GetSectionCount(const char *groupname) const
 {
-    Group* pgrp = *FindGroupP(groupname);
-    if(!pgrp) return 0;
-    int c;
-    Section *tmp;
-    for(tmp=pgrp->firstsection, c=0; tmp; tmp=tmp->next, c++) {}
-    return c;
+    Group* pgrp = FindGroup(groupname);
+    return pgrp ? pgrp->section_count : 0;
 }
 
 const char* IniFileParser::GetSectionName(const char *groupname, int
            sectionindex) const
 {
-    Group *grp = *FindGroupP(groupname);
-    if(!grp) return "";
-    int i;
-    Section *tmp;
-    for(tmp=grp->firstsection, i=0; tmp && i<sectionindex; tmp=tmp->next, i++)
-        {}
-    if(tmp)
-        return tmp->name;
-    else
+    Group *grp = FindGroup(groupname);
+    if(!grp || sectionindex < 0 || sectionindex >= grp->section_count)
         return "";
+    return grp->sections[sectionindex]->name;
 }
 
 void IniFileParser::SetParam(const char *groupname, const char *sectionname,
@@ -178,49 +177,57 @@ void IniFileParser::SetParam(const char *groupname, const char *sectionname,
                              bool exclusive)
 {
     Section* sect = ProvideSection(groupname, sectionname);
-    sect->ProvideParameter(paramname)->AddDictionaryData(paramval, exclusive);
+    ProvideParameter(sect, paramname)->AddDictionaryData(paramval, exclusive);
 }
 
 const char* IniFileParser::GetParam(const char *groupname,
                                     const char *sectionname,
                                     const char *paramname) const
 {
-    Group* grp = *FindGroupP(groupname);
+    lookup_count++;
+    Group* grp = FindGroup(groupname);
     if(!grp) return "";
-    Section* sect = *FindSectionP(grp, sectionname);
+    Section* sect = FindSection(grp, sectionname);
     if(!sect) return "";
-    Parameter *tmp;
-    for(tmp=sect->firstparam;
-        tmp && strcmp(tmp->name, paramname)!=0;
-        tmp=tmp->next) {}
-    if(tmp)
-        return tmp->value;
-    else
-        return "";
+    Entry *parm = FindEntry(sect, paramname);
+    return parm ? static_cast<Parameter*>(parm)->value : "";
 }
 
 void IniFileParser::DeleteSection(const char *groupname,
           const char *sectionname)
 {
-    Group** grp = (Group**)FindGroupP(groupname);
-    if(!*grp) return;
-    Section** sect = (Section**)FindSectionP(*grp, sectionname);
-    if(!*sect) return;
-    Section *tmp = *sect;
-    *sect = (*sect)->next;
-    tmp->next = 0;
-    delete tmp;
+    Group *grp = FindGroup(groupname);
+    if(!grp) return;
+    Section *sect = FindSection(grp, sectionname);
+    if(!sect) return;
+
+    Parameter *parm;
+    for(parm = sect->firstparam; parm; parm = parm->next)
+        RemoveEntry(parm);
+    RemoveEntry(sect);
+    grp->RemoveSection(sect);
+    Section **pps;
+    for(pps = &grp->firstsection; *pps != sect; pps = &((*pps)->next))
+        {}
+    *pps = sect->next;
+    sect->next = 0;
+    delete sect;
+
     // Now remove the group if it's empty
-    if(!((*grp)->firstsection)) {
-        Group *tmp = *grp;
-        *grp = (*grp)->next;
-        tmp->next = 0;
-        delete tmp;
+    if(!grp->firstsection) {
+        RemoveEntry(grp);
+        Group **ppg, *prev = 0;
+        for(ppg = &firstgroup; *ppg != grp; ppg = &((*ppg)->next))
+            prev = *ppg;
+        *ppg = grp->next;
+        if(lastgroup == grp)
+            lastgroup = prev;
+        grp->next = 0;
+        delete grp;
     }
 }
 
 
-
 bool IniFileParser::ExtractHeaderData(char *buf,
             char **name,
             char **param)
@@ -287,34 +294,128 @@ bool IniFileParser::ExtractDictionaryData(char *buf,
 IniFileParser::Section*
 IniFileParser::ProvideSection(const char* groupname, const char* sectionname)
 {
-    Group** ppgrp = (Group**)FindGroupP(groupname);
-    if(!(*ppgrp)) {
-        *ppgrp = new Group(groupname);
+    Group *grp = FindGroup(groupname);
+    if(!grp) {
+        grp = new Group(groupname);
+        if(lastgroup)
+            lastgroup->next = grp;
+        else
+            firstgroup = grp;
+        lastgroup = grp;
+        AddEntry(grp);
     }
-    Section** ppsect = (Section**)FindSectionP(*ppgrp, sectionname);
-    if(!(*ppsect)) {
-        *ppsect = new Section(sectionname ? sectionname : "");
+    Section *sect = FindSection(grp, sectionname);
+    if(!sect) {
+        sect = new Section(sectionname ? sectionname : "", grp);
+        grp->AppendSection(sect);
+        AddEntry(sect);
     }
-    return *ppsect;
+    return sect;
+}
+
+IniFileParser::Parameter*
+IniFileParser::ProvideParameter(Section *sect, const char *name)
+{
+    Entry *e = FindEntry(sect, name);
+    if(e)
+        return static_cast<Parameter*>(e);
+    Parameter *parm = new Parameter(name, "", sect);
+    if(sect->lastparam)
+        sect->lastparam->next = parm;
+    else
+        sect->firstparam = parm;
+    sect->lastparam = parm;
+    AddEntry(parm);
+    return parm;
 }
 
-IniFileParser::Group*const*
-IniFileParser::FindGroupP(const char* groupname) const
+IniFileParser::Group*
+IniFileParser::FindGroup(const char* groupname) const
 {
-    Group* const * ppgrp = &firstgroup;
-    while(*ppgrp && strcmp((*ppgrp)->name, groupname)!=0)
-        ppgrp = &((*ppgrp)->next);
-    return ppgrp;
+    return static_cast<Group*>(FindEntry(0, groupname));
 }
 
-IniFileParser::Section*const*
-IniFileParser::FindSectionP(Group* pgrp, const char* sectionname) const
+IniFileParser::Section*
+IniFileParser::FindSection(Group* pgrp, const char* sectionname) const
 {
-    Section* const* ppsect = &(pgrp->firstsection);
-    if(sectionname)
-        while(*ppsect && strcmp((*ppsect)->name, sectionname)!=0)
-            ppsect = &((*ppsect)->next);
-    return ppsect;
+    if(!sectionname)
+        return pgrp->firstsection;
+    return static_cast<Section*>(FindEntry(pgrp, sectionname));
+}
+
+    /* FNV-1a over the name, then the owner's address is mixed in, so
+       that parameters with the same name in different sections (which
+       is the common case) don't end up in the same chain
+     */
+static unsigned int entry_hash(const void *owner, const char *name)
+{
+    unsigned int h = 2166136261u;
+    for(const unsigned char *p = (const unsigned char*)name; *p; p++) {
+        h ^= *p;
+        h *= 16777619u;
+    }
+    unsigned long ow = (unsigned long)owner;
+    h ^= (unsigned int)(ow >> 4) ^ (unsigned int)(ow >> 20);
+    h ^= h >> 15;
+    h *= 2246822519u;
+    h ^= h >> 13;
+    return h;
+}
+
+IniFileParser::Entry*
+IniFileParser::FindEntry(const Entry *owner, const char *name) const
+{
+    unsigned int h = entry_hash(owner, name);
+    Entry *e;
+    for(e = hash_table[h & (hash_size-1)]; e; e = e->hash_next)
+        if(e->hash == h && e->owner == owner && 0 == strcmp(e->name, name))
+            return e;
+    return 0;
+}
+
+void IniFileParser::AddEntry(Entry *e)
+{
+    if(hash_count >= hash_size)
+        ResizeHash();
+    e->hash = entry_hash(e->owner, e->name);
+    int idx = e->hash & (hash_size-1);
+    e->hash_next = hash_table[idx];
+    hash_table[idx] = e;
+    hash_count++;
+}
+
+void IniFileParser::RemoveEntry(Entry *e)
+{
+    Entry **pp;
+    for(pp = hash_table + (e->hash & (hash_size-1)); *pp; pp = &(*pp)->hash_next) {
+        if(*pp == e) {
+            *pp = e->hash_next;
+            e->hash_next = 0;
+            hash_count--;
+            return;
+        }
+    }
+}
+
+void IniFileParser::ResizeHash()
+{
+    int newsize = hash_size * 2;
+    Entry **newtable = new Entry*[newsize];
+    memset(newtable, 0, sizeof(*newtable) * newsize);
+    int i;
+    for(i = 0; i < hash_size; i++) {
+        Entry *e = hash_table[i];
+        while(e) {
+            Entry *nx = e->hash_next;
+            int idx = e->hash & (newsize-1);
+            e->hash_next = newtable[idx];
+            newtable[idx] = e;
+            e = nx;
+        }
+    }
+    delete[] hash_table;
+    hash_table = newtable;
+    hash_size = newsize;
 }
 
 void IniFileParser::
@@ -392,61 +493,100 @@ GetModifiedIntegerParameter(const char *grname, const char *sectname,
 
 ////////////////////////////////////////////////////////////
 
-IniFileParser::Group::Group(const char *aname)
+IniFileParser::Entry::Entry(const char *aname, const Entry *own)
 {
     name = new char[strlen(aname)+1];
     strcpy(name, aname);
+    owner = own;
+    hash = 0;
+    hash_next = 0;
+}
+
+IniFileParser::Entry::~Entry()
+{
+    delete[] name;
+}
+
+////////////////////////////////////////////////////////////
+
+IniFileParser::Group::Group(const char *aname)
+    : Entry(aname, 0)
+{
     next = 0;
     firstsection = 0;
+    sections = 0;
+    section_count = 0;
+    sections_alloc = 0;
 }
 
 IniFileParser::Group::~Group()
 {
-    delete[] name;
     if(next)
         delete next;
     if(firstsection)
         delete firstsection;
+    if(sections)
+        delete[] sections;
+}
+
+void IniFileParser::Group::AppendSection(Section *s)
+{
+    if(section_count >= sections_alloc) {
+        int newalloc = sections_alloc ? sections_alloc * 2 : 8;
+        Section **tmp = new Section*[newalloc];
+        int i;
+        for(i = 0; i < section_count; i++)
+            tmp[i] = sections[i];
+        if(sections)
+            delete[] sections;
+        sections = tmp;
+        sections_alloc = newalloc;
+    }
+    sections[section_count] = s;
+    section_count++;
+    if(section_count == 1)
+        firstsection = s;
+    else
+        sections[section_count-2]->next = s;
+}
+
+void IniFileParser::Group::RemoveSection(Section *s)
+{
+    int i;
+    for(i = 0; i < section_count; i++) {
+        if(sections[i] == s) {
+            section_count--;
+            for(; i < section_count; i++)
+                sections[i] = sections[i+1];
+            return;
+        }
+    }
 }
 
 ////////////////////////////////////////////////////////////
 
-IniFileParser::Section::Section(const char *aname)
+IniFileParser::Section::Section(const char *aname, const Entry *own)
+    : Entry(aname, own)
 {
-    name = new char[strlen(aname)+1];
-    strcpy(name, aname);
     next = 0;
     firstparam = 0;
+    lastparam = 0;
 }
 
 IniFileParser::Section::~Section()
 {
-    delete[] name;
     if(next)
         delete next;
     if(firstparam)
         delete firstparam;
 }
 
-IniFileParser::Parameter*
-IniFileParser::Section::ProvideParameter(const char * name)
-{
-    Parameter **tmp;
-    for(tmp = &firstparam;
-        *tmp && strcmp((*tmp)->name, name) != 0;
-        tmp = &((*tmp)->next));
-    if(!*tmp) {
-        (*tmp) = new Parameter(name, "");
-    }
-    return *tmp;
-}
-
 //////////////////////////////////////////////////////
 
-IniFileParser::Parameter::Parameter(const char *aname, const char *aval)
+IniFileParser::Parameter::Parameter(const char *aname, const char *aval,
+                                    const Entry *own)
+    : Entry(aname, own)
 {
-    name = new char[strlen(aname)+1];
-    strcpy(name, aname);
     value = new char[strlen(aval)+1];
     strcpy(value, aval);
     next = 0;
@@ -454,7 +594,6 @@ IniFileParser::Parameter::Parameter(const char *aname, const char *aval)
 
 IniFileParser::Parameter::~Parameter()
 {
-    delete[] name;
     delete[] value;
     if(next) delete next;
 }
@@ -577,3 +716,153 @@ void IniFileParser::DisposeBrokenParameter(char** bparm)
     delete[] bparm[0];
     delete[] bparm;
 }
+
+
+#ifdef INIFILE_BENCH_MAIN
+
+/* Benchmark: writes a config shaped like a big site's one (a section
+   per page, most of them with a dozen parameters, plus a few groups
+   of macros), loads it and looks parameters up the way a generator
+   does: mostly hits, some misses (optional parameters left to their
+   defaults), some lookups of the group's first section; first by
+   walking the lists (the way it used to be done), then through the
+   hash.  Checks the results are the same.
+
+     make inibench && ./inibench [sections] [lookups]
+ */
+
+#include <unistd.h>
+#include <time.h>
+
+const char* IniFileParser::GetParamByScan(const char *groupname,
+                                          const char *sectionname,
+                                          const char *paramname) const
+{
+    lookup_count++;
+    Group *grp;
+    for(grp = firstgroup; grp && strcmp(grp->name, groupname); grp = grp->next)
+        {}
+    if(!grp) return "";
+    Section *sect = grp->firstsection;
+    if(sectionname)
+        while(sect && strcmp(sect->name, sectionname))
+            sect = sect->next;
+    if(!sect) return "";
+    Parameter *parm;
+    for(parm = sect->firstparam; parm && strcmp(parm->name, paramname);
+        parm = parm->next)
+        {}
+    return parm ? parm->value : "";
+}
+
+static const char * const bench_params[] = {
+    "title", "descr", "date", "author", "tags", "template", "encoding",
+    "format", "comments", "flags", "body", "teaser", "image", "alias", 0
+};
+
+static unsigned long bench_rand_state = 1;
+static int bench_rand(int n)
+{
+    bench_rand_state = bench_rand_state * 1103515245 + 12345;
+    return (int)((bench_rand_state >> 16) % n);
+}
+
+int main(int argc, char **argv)
+{
+    int sections = argc > 1 ? atoi(argv[1]) : 2000;
+    long lookups = argc > 2 ? atol(argv[2]) : 500000;
+    char path[] = "/tmp/inibench_XXXXXX";
+    int fd = mkstemp(path);
+    if(fd == -1) {
+        perror("mkstemp");
+        return 1;
+    }
+    FILE *f = fdopen(fd, "w");
+    int i, j;
+    fprintf(f, "[general]\nbase_url = http://www.example.com\n"
+               "spool_dir = _spool\nencoding = utf8\n\n");
+    for(i = 0; i < 200; i++)
+        fprintf(f, "[html macro%d]\nbody = <div class=\"m%d\">%%0%%</div>\n\n",
+                i, i);
+    for(i = 0; i < sections; i++) {
+        fprintf(f, "[page p%d]\n", i);
+        for(j = 0; j < 10 + i % 5; j++)
+            fprintf(f, "%s = value of %s for page %d\n",
+                       bench_params[j], bench_params[j], i);
+        fprintf(f, "\n");
+    }
+    fclose(f);
+
+    IniFileParser ini;
+    clock_t start = clock();
+    bool ok = ini.Load(path);
+    double secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+    unlink(path);
+    if(!ok) {
+        fprintf(stderr, "%s: %s\n", path, ini.GetLastErrorDescription());
+        return 1;
+    }
+    printf("%d page sections, loaded in %.3f s\n", sections, secs);
+
+    char sect[32];
+    int mismatches = 0;
+    int pass;
+    for(pass = 0; pass < 3; pass++) {
+        bench_rand_state = 1;
+        long found = 0;
+        start = clock();
+        long n;
+        for(n = 0; n < lookups; n++) {
+            int k = bench_rand(100);
+            const char *group = "page";
+            const char *sn = sect;
+            const char *pn;
+            if(k < 80) {
+                sprintf(sect, "p%d", bench_rand(sections));
+                pn = bench_params[bench_rand(10)];
+            } else if(k < 95) {
+                sprintf(sect, "p%d", bench_rand(sections));
+                pn = "nosuchparam";
+            } else {
+                group = "general";
+                sn = 0;
+                pn = "base_url";
+            }
+            const char *r1, *r2;
+            switch(pass) {
+            case 0:
+                r1 = ini.GetParamByScan(group, sn, pn);
+                break;
+            case 1:
+                r1 = ini.GetParam(group, sn, pn);
+                break;
+            default:
+                r1 = ini.GetParamByScan(group, sn, pn);
+                r2 = ini.GetParam(group, sn, pn);
+                if(r1 != r2)
+                    mismatches++;
+            }
+            if(*r1)
+                found++;
+        }
+        if(pass == 2)
+            break;
+        secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+        printf("%s: %.3f s, %.3f us per lookup (%ld found)\n",
+               pass ? "hash     " : "list walk", secs, secs * 1e6 / lookups,
+               found);
+    }
+
+    start = clock();
+    long total = 0;
+    int cnt = ini.GetSectionCount("page");
+    for(i = 0; i < cnt; i++)
+        total += strlen(ini.GetSectionName("page", i));
+    secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("enumerating %d sections: %.3f s (%ld chars)\n", cnt, secs, total);
+
+    printf("%d mismatches\n", mismatches);
+    return mismatches ? 1 : 0;
+}
+
+#endif
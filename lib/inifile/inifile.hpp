@@ -1,5 +1,5 @@
 // +-------------------------------------------------------------------------+
-// |                     I n i F i l e    vers. 0.3.24                       |
+// |                     I n i F i l e    vers. 0.3.25                       |
 // | Copyright (c) Andrey Vikt. Stolyarov [http://www.croco.net/]  2003-2023 |
 // | ----------------------------------------------------------------------- |
 // | This is free software.  Permission is granted to everyone to use, copy  |
@@ -20,31 +20,49 @@
 #define INIFILE_HPP_SENTRY
 
 class IniFileParser {
-    struct Parameter {
-        Parameter *next;
+        /* Groups, sections and parameters are kept in lists, in the
+           order they were added (so enumeration and Save follow the
+           file); besides that, all of them are indexed by a single hash
+           table, keyed by the owner (the group of a section, the
+           section of a parameter, none for a group) and the name.
+         */
+    struct Entry {
         char *name;
+        const Entry *owner;
+        unsigned int hash;
+        Entry *hash_next;
+        Entry(const char *nm, const Entry *own);
+        ~Entry();
+    };
+    struct Parameter : public Entry {
+        Parameter *next;
         char *value;
-        Parameter(const char *nm, const char *vl);
+        Parameter(const char *nm, const char *vl, const Entry *own);
         ~Parameter();
         void AddDictionaryData(const char *value, bool exclusive = false);
         void AddDictionaryLine(const char *value);
     };
-    struct Section {
+    struct Section : public Entry {
         Section *next;
-        char *name;
-        Parameter *firstparam;
-        Section(const char *nm);
+        Parameter *firstparam, *lastparam;
+        Section(const char *nm, const Entry *own);
         ~Section();
-        Parameter *ProvideParameter(const char *name);
     };
-    struct Group {
+    struct Group : public Entry {
         Group *next;
-        char *name;
         Section *firstsection;
+        Section **sections;     // for GetSectionName, in the list order
+        int section_count, sections_alloc;
         Group(const char *nm);
         ~Group();
+        void AppendSection(Section *s);
+        void RemoveSection(Section *s);
     };
-    Group *firstgroup;
+    Group *firstgroup, *lastgroup;
+
+    Entry **hash_table;
+    int hash_size, hash_count;
+    mutable long lookup_count;
 
     int last_error_line;
     const char *last_error_description;
@@ -94,12 +112,28 @@ public:
                                      const char *modifier,
                                      long defaultvalue) const;
 
+        // how many times parameters were looked up (GetParam and all
+        // the Get*Parameter methods) since the object was created
+    long GetLookupCount() const { return lookup_count; }
+
     static char **BreakParameterAsCSV(const char *param_text);
     static void DisposeBrokenParameter(char **bparm);
+
+#ifdef INIFILE_BENCH_MAIN
+        // GetParam done by walking the lists, as it used to be
+    const char* GetParamByScan(const char *groupname, const char *sectionname,
+                               const char *paramname) const;
+#endif
 private:
     Section *ProvideSection(const char *groupname, const char *sectionname);
-    Group *const*FindGroupP(const char *groupname) const;
-    Section *const*FindSectionP(Group *grp, const char *sectionname) const;
+    Parameter *ProvideParameter(Section *sect, const char *name);
+    Group *FindGroup(const char *groupname) const;
+    Section *FindSection(Group *grp, const char *sectionname) const;
+
+    Entry *FindEntry(const Entry *owner, const char *name) const;
+    void AddEntry(Entry *e);
+    void RemoveEntry(Entry *e);
+    void ResizeHash();
 
     static bool ExtractHeaderData(char *buf,
                                   char **groupname,
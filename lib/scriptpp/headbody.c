@@ -196,10 +196,10 @@ static void finalize_header(struct headbody_parser *parser)
 {
     int i, res;
     HBP->buffer[HBP->colonpos] = 0;
+    buf_addchar(HBP, 0);  /* before the skipping, or it may run past the end */
     i = HBP->colonpos + 1;
     while(HBP->buffer[i] == ' ' || HBP->buffer[i] == '\t')
         i++;
-    buf_addchar(HBP, 0);
     if(parser->header_cb) {
         res = (*parser->header_cb)(HBP->buffer, HBP->buffer + i,
                                    HBP->colonpos, HBP->bufused-i,
@@ -82,9 +82,13 @@ public:
 
     The ScriptMacroprocessor class object owns its collection of
     ``macros'' represented by objects of classes derived from
-    ScriptMacroprocessor::Macro, each having its name.  In the present
-    version, the name search is done in a simple linear way; this works
-    perfectly until you've got a lot of macros (say, 100 and more of them).
+    ScriptMacroprocessor::Macro, each having its name.  The names are
+    looked up through a hash index which every processor builds on the
+    first lookup after its collection of macros changes, so adding and
+    removing macros is cheap but lookups right after it are not; it is
+    better to register all the macros first and then do the processing.
+    A macro added later shadows the one of the same name added earlier,
+    and the processor's own macros shadow those of its parent.
     The Macro class has a pure virtual method which takes ScriptVector
     (formed out of all params except the macro name itself) and returns
     the resulting string in form of ScriptVariable.
@@ -124,6 +128,8 @@ public:
     flexible).  It is also impossible to determine what caused the error
     (unknown macro name or existing macro returning invalidated string).
  */
+class ScriptMacroTemplate;
+
 class ScriptMacroprocessor {
 public:
 
@@ -168,6 +174,15 @@ public:
                            const ScriptVector &argv,
                            int idx = 0, int count = -1) const;
 
+        //! Process a precompiled template
+        /*! The result is exactly the same as if the template's source
+            text was processed, but the text is not scanned again.
+         */
+    ScriptVariable Process(const ScriptMacroTemplate &templ) const;
+    ScriptVariable Process(const ScriptMacroTemplate &templ,
+                           const ScriptVector &argv,
+                           int idx = 0, int count = -1) const;
+
         /*! \note the *aux object is not deleted, it remains yours */
     ScriptVariable Process(const ScriptVariable &src,
                            const ScriptMacroprocessorMacro *aux) const;
@@ -191,6 +206,37 @@ public:
                          bool force_no_dirty = false) const;
 };
 
+//! Template text compiled for ScriptMacroprocessor
+/*! The text is scanned once, and broken down into literal spans and
+    macro calls, the arguments of eager calls being compiled as well;
+    ScriptMacroprocessor::Process executes the result without scanning
+    the text again, which pays off for templates expanded over and over.
+    The object depends on the special chars, so the chars must be the
+    same as for the processor (see the ScriptMacroprocessor constructors);
+    if they aren't, the source text is simply processed the usual way.
+ */
+class ScriptMacroTemplate {
+    struct ScriptMacroProgram *program;
+    ScriptVariable source;
+    char chars[5];
+public:
+    explicit ScriptMacroTemplate(const ScriptVariable &src, char ec = '%');
+    ScriptMacroTemplate(const ScriptVariable &src, const char *chrs);
+    ~ScriptMacroTemplate();
+
+    const ScriptVariable &GetSource() const { return source; }
+
+private:
+    void Compile();
+    bool CompiledFor(const struct ScriptMacroRealm *r) const;
+
+    friend class ScriptMacroprocessor;
+
+        // no copying
+    ScriptMacroTemplate(const ScriptMacroTemplate&);
+    void operator=(const ScriptMacroTemplate&);
+};
+
 //! A single macro 'variable' without parameters
 /*! The name of the substitution variable is given to the constructor,
     e.g., to arrange a substitution for '%MYVAR%', give the string 'MYVAR'.
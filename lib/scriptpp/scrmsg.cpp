@@ -16,12 +16,19 @@
 
 
 
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
 #include "scrmsg.hpp"
 
 #include "headbody.h"
 
 HeadedTextMessage::HeadedTextMessage(bool heading_line_expected)
-    : parser(new headbody_parser)
+    : parser(new headbody_parser), fed(false), bulk(false)
 {
     headbody_parser_init(parser);
     parser->userdata = this;
@@ -38,13 +45,190 @@ HeadedTextMessage::~HeadedTextMessage()
 
 bool HeadedTextMessage::FeedChar(int c)
 {
+    fed = true;
+    if(bulk) {    // we're in the body, see ParseBulk
+        if(c != -1)
+            body += c;
+        return true;
+    }
     headbody_parser_feedchar(parser, c);
     return !headbody_parser_error(parser, 0);
 }
 
 bool HeadedTextMessage::InBody() const
 {
-    return headbody_parser_in_body(parser);
+    return bulk || headbody_parser_in_body(parser);
+}
+
+    // the body callback drops zero bytes, so we must drop them, too
+static void append_body(ScriptVariable &body, const char *p, const char *end)
+{
+    while(p < end) {
+        const char *z = (const char*)memchr(p, 0, end - p);
+        if(!z) {
+            body += ScriptVariable(p, end - p);
+            return;
+        }
+        if(z > p)
+            body += ScriptVariable(p, z - p);
+        p = z + 1;
+    }
+}
+
+    // the bytes from p to end, with all CRs removed
+static ScriptVariable without_cr(const char *p, const char *end)
+{
+    ScriptVariable res;
+    while(p < end) {
+        const char *cr = (const char*)memchr(p, '\r', end - p);
+        if(!cr) {
+            res += ScriptVariable(p, end - p);
+            break;
+        }
+        res += ScriptVariable(p, cr - p);
+        p = cr + 1;
+    }
+    return res;
+}
+
+    /* Does exactly what the headbody parser does, for messages in which
+       the headers are well-formed and followed by the empty line; for
+       anything else (including errors) false is returned, and nothing
+       is changed.  Please note the parser is never told the text is
+       over, so a header is only complete when the next line begins.
+     */
+bool HeadedTextMessage::ParseBulk(const char *buf, int len)
+{
+    const char *end = buf + len;
+    if(memchr(buf, 0, len))
+        return false;   // let the parser decide what to do with these
+    const char *p = buf;
+    while(p < end && (*p == '\r' || *p == '\n' || *p == '\t' || *p == ' '))
+        p++;
+    ScriptVariable headline;
+    if(parser->headline_cb) {
+        const char *eol = (const char*)memchr(p, '\n', end - p);
+        if(!eol)
+            return false;
+        headline = without_cr(p, eol);
+        p = eol + 1;
+    }
+    ScriptVector hdrs;
+    bool body_follows = false;
+    while(!body_follows) {
+        if(p >= end)
+            return false;
+        if(*p == '\n') {   // the empty line
+            p++;
+            break;
+        }
+        const char *eol = (const char*)memchr(p, '\n', end - p);
+        if(!eol)
+            return false;
+        const char *colon = (const char*)memchr(p, ':', eol - p);
+        if(!colon)
+            return false;
+        const char *q;
+        for(q = p; q < colon; q++)
+            if(*q == ' ' || *q == '\t' || *q == '\r')
+                return false;
+        ScriptVariable name(p, colon - p);
+        ScriptVariable value = without_cr(colon + 1, eol);
+        p = eol + 1;
+            // continuation lines
+        while(p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+            while(p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+                p++;
+            if(p >= end)
+                return false;
+            if(*p == '\n') {   // whitespace-only line, accepted as empty
+                p++;
+                body_follows = true;
+                break;
+            }
+            eol = (const char*)memchr(p, '\n', end - p);
+            if(!eol)
+                return false;
+            value += '\n';
+            value += without_cr(p, eol);
+            p = eol + 1;
+        }
+        if(p >= end && !body_follows)
+            return false;   // the header isn't finalized yet
+        const char *v = value.c_str();
+        while(*v == ' ' || *v == '\t')
+            v++;
+        hdrs.AddItem(name);
+        hdrs.AddItem(v);
+    }
+
+    if(parser->headline_cb)
+        heading_line = headline;
+    int i;
+    for(i = 0; i < hdrs.Length(); i++)
+        headers.AddItem(hdrs[i]);
+    append_body(body, p, end);
+    bulk = true;
+    return true;
+}
+
+bool HeadedTextMessage::Parse(const char *buf, int len)
+{
+    if(!fed && !bulk && len > 0 && ParseBulk(buf, len)) {
+        fed = true;
+        return true;
+    }
+    int i;
+    for(i = 0; i < len; i++)
+        if(!FeedChar((unsigned char)buf[i]))
+            return false;
+    return true;
+}
+
+    // smaller files are read, larger ones are mapped; for files of a few
+    // kilobytes (like comments), mmap+munmap cost more than a read
+enum { readfile_mmap_threshold = 65536 };
+
+bool HeadedTextMessage::ReadFile(const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    if(fd == -1)
+        return false;
+    struct stat st;
+    if(fstat(fd, &st) == -1) {
+        close(fd);
+        return false;
+    }
+    if(st.st_size >= readfile_mmap_threshold) {
+        void *m = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(m != MAP_FAILED) {
+            close(fd);
+            Parse((const char*)m, st.st_size);
+            munmap(m, st.st_size);
+            return true;
+        }
+    }
+        // the size may be wrong (e.g. for special files), so we read
+        // until EOF, growing the buffer if needed
+    int bufsize = st.st_size > 0 ? st.st_size + 1 : 4096;
+    char *buf = new char[bufsize];
+    int used = 0;
+    int rc;
+    while((rc = read(fd, buf + used, bufsize - used)) > 0) {
+        used += rc;
+        if(used == bufsize) {
+            char *tmp = new char[bufsize * 2];
+            memcpy(tmp, buf, used);
+            delete[] buf;
+            buf = tmp;
+            bufsize *= 2;
+        }
+    }
+    close(fd);
+    if(rc != -1)
+        Parse(buf, used);
+    delete[] buf;
+    return rc != -1;
 }
 
 ScriptVariable HeadedTextMessage::FindHeader(const ScriptVariable &name) const
@@ -165,3 +349,116 @@ int HeadedTextMessage::BodyCb(int c, void *u)
         p->body += c;
     return 0;
 }
+
+
+#ifdef SCRMSG_BENCH_MAIN
+
+/* Benchmark: creates a corpus of comment-like files and reads them
+   all, first with fgetc and FeedChar (the way it used to be done),
+   then with ReadFile; checks the results are the same.
+
+     make scrmsg_bench && ./scrmsg_bench [files] [dir]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static ScriptVariable bench_comment(int n)
+{
+    ScriptVariable res(0, "id: %d\nparent: %d\nfrom: user%d\n"
+                          "unixtime: %d\nencoding: utf8\nformat: texbreaks\n"
+                          "subject: reply number %d\n\n",
+                       n, n / 3, n % 97, 1700000000 + n, n);
+    int paragraphs = 1 + n % 5;
+    int i;
+    for(i = 0; i < paragraphs; i++) {
+        res += "Lorem ipsum dolor sit amet, consectetur adipiscing elit, "
+               "sed do eiusmod tempor incididunt ut labore et dolore magna "
+               "aliqua.  Ut enim ad minim veniam, quis nostrud exercitation "
+               "ullamco laboris nisi ut aliquip ex ea commodo consequat.\n\n";
+    }
+    return res;
+}
+
+static ScriptVariable read_by_chars(const char *path, HeadedTextMessage &msg)
+{
+    FILE *s = fopen(path, "r");
+    if(!s)
+        return ScriptVariableInv();
+    int c;
+    while((c = fgetc(s)) != EOF) {
+        if(!msg.FeedChar(c))
+            break;
+    }
+    fclose(s);
+    return msg.GetHeaders().Join("|") + "|" + msg.GetBody();
+}
+
+static ScriptVariable read_by_file(const char *path, HeadedTextMessage &msg)
+{
+    if(!msg.ReadFile(path))
+        return ScriptVariableInv();
+    return msg.GetHeaders().Join("|") + "|" + msg.GetBody();
+}
+
+int main(int argc, char **argv)
+{
+    int count = argc > 1 ? atoi(argv[1]) : 100000;
+    char tmpl[] = "/tmp/scrmsg_bench_XXXXXX";
+    const char *dir = argc > 2 ? argv[2] : mkdtemp(tmpl);
+    if(!dir) {
+        perror("mkdtemp");
+        return 1;
+    }
+    long total = 0;
+    int i;
+    for(i = 0; i < count; i++) {
+        ScriptVariable fn(0, "%s/%d", dir, i);
+        FILE *f = fopen(fn.c_str(), "w");
+        if(!f) {
+            perror(fn.c_str());
+            return 1;
+        }
+        ScriptVariable text = bench_comment(i);
+        fputs(text.c_str(), f);
+        fclose(f);
+        total += text.Length();
+    }
+    printf("%d files, %ld bytes in %s\n", count, total, dir);
+
+    int pass;
+    for(pass = 0; pass < 2; pass++) {
+        long bytes = 0;
+        clock_t start = clock();
+        for(i = 0; i < count; i++) {
+            ScriptVariable fn(0, "%s/%d", dir, i);
+            HeadedTextMessage msg(false);
+            ScriptVariable r = pass ?
+                read_by_file(fn.c_str(), msg) : read_by_chars(fn.c_str(), msg);
+            bytes += r.Length();
+        }
+        double secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+        printf("%s: %.3f s, %.2f us per file (%ld bytes)\n",
+               pass ? "ReadFile        " : "fgetc + FeedChar",
+               secs, secs * 1e6 / count, bytes);
+    }
+
+    int mismatches = 0;
+    for(i = 0; i < count; i++) {
+        ScriptVariable fn(0, "%s/%d", dir, i);
+        HeadedTextMessage m1(false), m2(false);
+        if(read_by_chars(fn.c_str(), m1) != read_by_file(fn.c_str(), m2))
+            mismatches++;
+    }
+    printf("%d mismatches\n", mismatches);
+
+    if(argc <= 2) {
+        for(i = 0; i < count; i++)
+            unlink(ScriptVariable(0, "%s/%d", dir, i).c_str());
+        rmdir(dir);
+    }
+    return mismatches ? 1 : 0;
+}
+
+#endif
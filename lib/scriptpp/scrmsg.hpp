@@ -29,12 +29,27 @@ class HeadedTextMessage {
 
     struct headbody_parser *parser;
         // the struct is not exposed to the rest of the modules
+    bool fed;    // anything was given to FeedChar or Parse
+    bool bulk;   // the message was scanned by Parse, bypassing the parser
 public:
     HeadedTextMessage(bool heading_line_expected = false);
     ~HeadedTextMessage();
 
     bool FeedChar(int c);
 
+        //! Same as FeedChar for every byte (the end is not signalled)
+        /*! If nothing was fed before, a well-formed message is scanned
+            as a whole, without per-char processing, and the body is
+            copied in one go; anything unusual is given to the parser
+            char by char, so the results are always the same.
+         */
+    bool Parse(const char *buf, int len);
+        //! Parse the file's content (mapped to memory, if possible)
+        /*! Returns false if the file can't be read; use Error()
+            to check for parsing errors.
+         */
+    bool ReadFile(const char *path);
+
     bool InBody() const; // true if the header is over and we're in the body
 
     enum errors {
@@ -68,6 +83,7 @@ public:
     ScriptVariable Serialize() const;
 
 private:
+    bool ParseBulk(const char *buf, int len);
         /* callbacks for underlying headbody_parser */
     static int HeadlineCb(const char *s, int, void *u);
     static int HeaderCb(const char *h, const char *v, int, int, void *u);
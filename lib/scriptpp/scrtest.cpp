@@ -17,6 +17,7 @@
 
 
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include "tests.h"
 
@@ -67,6 +68,34 @@ public:
     ScriptVariable Expand() const { return "<empty>"; }
 };
 
+    // Parse must give exactly what FeedChar gives for every byte
+static bool parse_same_as_fed(const char *text, bool headline)
+{
+    int len = strlen(text);
+    HeadedTextMessage fed(headline), parsed(headline);
+    int i;
+    for(i = 0; i < len; i++)
+        if(!fed.FeedChar((unsigned char)text[i]))
+            break;
+    parsed.Parse(text, len);
+    int c1, l1, c2, l2;
+    bool e1 = fed.Error(c1, l1), e2 = parsed.Error(c2, l2);
+    if(e1 != e2 || (e1 && (c1 != c2 || l1 != l2)))
+        return false;
+    if(fed.InBody() != parsed.InBody())
+        return false;
+    if(fed.GetHeadline().IsValid() != parsed.GetHeadline().IsValid())
+        return false;
+    if(fed.GetHeadline().IsValid() &&
+        fed.GetHeadline() != parsed.GetHeadline())
+    {
+        return false;
+    }
+    if(fed.GetHeaders().Join("|") != parsed.GetHeaders().Join("|"))
+        return false;
+    return fed.GetBody() == parsed.GetBody();
+}
+
 int main()
 {
   try {
@@ -1156,6 +1185,70 @@ int main()
           ScriptVariable res2 = s.Apply("bad", args);
           test("macro_apply_dirty_blocked", res2.IsInvalid());
       }
+      test_subsuite("ScriptMacro many macros");
+      {
+          ScriptMacroprocessor s;
+          int i;
+          for(i = 0; i < 100; i++)
+              s.AddMacro(new ScriptMacroConst(ScriptVariable(0, "m%d", i),
+                                              ScriptVariable(0, "v%d", i)));
+          test_str("macro_many", s("%m0% %[m57] %m99%").c_str(),
+                                 "v0 v57 v99");
+          test_str("macro_many_unknown", s("%m100%").c_str(), "%m100%");
+
+          ScriptMacroprocessor::MacroId id =
+              s.AddMacro(new ScriptMacroConst("m57", "shadow"));
+          test_str("macro_many_shadowed", s("%m57%").c_str(), "shadow");
+          s.RemoveMacro(id);
+          test_str("macro_many_unshadowed", s("%m57%").c_str(), "v57");
+
+          ScriptMacroprocessor s2(&s);
+          s2.AddMacro(new ScriptMacroConst("m3", "child"));
+          test_str("macro_many_child", s2("%m3% %m4%").c_str(), "child v4");
+          s.AddMacro(new ScriptMacroConst("late", "added"));
+          test_str("macro_many_parent_added", s2("%late%").c_str(), "added");
+
+          ScriptMacroConst aux("m4", "aux");
+          test_str("macro_many_aux", s.Process("%m4% %m5%", &aux).c_str(),
+                                     "aux v5");
+          test_str("macro_many_aux_gone", s("%m4%").c_str(), "v4");
+      }
+      test_subsuite("ScriptMacro compiled templates");
+      {
+          ScriptMacroprocessor s;
+          s.AddMacro(new ScriptMacroConst("foobar", "foo:bar"));
+          s.AddMacro(new ScriptMacroConst("suspect", "%[foobar]"));
+          s.AddMacro(new MacroFunc);
+          ScriptMacroprocessor s2(&s);
+          s2.AddMacro(new ScriptMacroConst("local", "here"));
+
+          const char *srcs[] = {
+              "plain text", "%foobar% %[req:a:%local%:%[suspect]] %%",
+              "%{req:%foobar%:%}:%{foobar}}", "a%nosuch%b %[nosuch:x]",
+              "%{req:unclosed", "%[req:unclosed", "%foobar", "%{", "%",
+              "%req:a:b% %[req] %{req}", 0
+          };
+          int i;
+          for(i = 0; srcs[i]; i++) {
+              ScriptMacroTemplate t(srcs[i]);
+              ScriptVariable name(0, "macro_compiled_%d", i);
+              test_str(name.c_str(), s2.Process(t).c_str(),
+                                     s2.Process(srcs[i]).c_str());
+          }
+
+          ScriptVector vv("zero one two");
+          ScriptMacroTemplate targs("%2% %[req:%1%] %*%");
+          test_str("macro_compiled_argv", s2.Process(targs, vv).c_str(),
+                                          "two (one) one two");
+
+          ScriptMacroTemplate tother("%[req:x]", "$<>()");
+          test_str("macro_compiled_other_chars", s2.Process(tother).c_str(),
+                                                 "(x)");
+
+          ScriptVariableInv inval;
+          ScriptMacroTemplate tinval(inval);
+          test("macro_compiled_invalstring", s2.Process(tinval).IsInvalid());
+      }
       test_subsuite("ScriptSubst");
       {
           ScriptSubstitution s;
@@ -1546,6 +1639,52 @@ int main()
                                       "\xD0\xC9\xDA\xFF\xC4\xC1");
           test_str("body_after_xFF", msg.GetBody().c_str(), "body\n");
       }
+      test_subsuite("HeadedTextMessageParse");
+      {
+          HeadedTextMessage msg(false);
+          const char msgtext[] =
+              "JustAHeader: just a value\r\n"
+              "ThisIsFoldedHeader:\tthe value of this header\n"
+              "    is so long that it has to be folded\n"
+              "\n"
+              "Now the body\r\ncomes into play\n";
+          msg.Parse(msgtext, sizeof(msgtext) - 1);
+          int errcode, errline;
+          test("parse_ok", !msg.Error(errcode, errline));
+          test("parse_in_body", msg.InBody());
+          test_str("parse_header_cr", msg.FindHeader("JustAHeader").c_str(),
+                                      "just a value");
+          test_str("parse_folded",
+             msg.FindHeader("ThisIsFoldedHeader").c_str(),
+             "the value of this header\nis so long that it has to be folded");
+          test_str("parse_body", msg.GetBody().c_str(),
+                                 "Now the body\r\ncomes into play\n");
+          msg.FeedChar('!');
+          test_str("feed_after_parse", msg.GetBody().c_str(),
+                                 "Now the body\r\ncomes into play\n!");
+
+          test("parse_same_plain", parse_same_as_fed(msgtext, false));
+          test("parse_same_headline", parse_same_as_fed(
+              "\n\r\n  head line\r\nA: b\n\nbody", true));
+          test("parse_same_no_body", parse_same_as_fed("A: b\n", false));
+          test("parse_same_no_eol", parse_same_as_fed("A: b", false));
+          test("parse_same_empty", parse_same_as_fed("", false));
+          test("parse_same_ws_only", parse_same_as_fed(" \n\t", false));
+          test("parse_same_empty_value", parse_same_as_fed(
+              "A:\n  cont\nB:   \n\nbody", false));
+          test("parse_same_ws_line", parse_same_as_fed(
+              "A: b\n   \t\nbody\n", false));
+          test("parse_same_cont_eot", parse_same_as_fed("A: b\n  c", false));
+          test("parse_same_space_name", parse_same_as_fed(
+              "A b: c\n\nbody", false));
+          test("parse_same_no_colon", parse_same_as_fed(
+              "A: b\nbroken\n\nbody", false));
+          test("parse_same_empty_name", parse_same_as_fed(
+              ": b\n\nbody", false));
+          test("parse_same_body_only", parse_same_as_fed("\nbody", false));
+          test("parse_same_8bit", parse_same_as_fed(
+              "One: \xC8\xD5\xCA\xFF\n\n\xFF body\n", false));
+      }
       test_score();
   }
   catch(...) {
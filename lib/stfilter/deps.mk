@@ -0,0 +1,10 @@
+stfbench.o: stfbench.cpp stfilter.hpp stfencod.hpp stfhtml.hpp \
+ stfscan.hpp
+stfbs64.o: stfbs64.cpp stfbs64.hpp stfilter.hpp
+stfencod.o: stfencod.cpp stfscan.hpp stfencod.hpp stfilter.hpp
+stfhtml.o: stfhtml.cpp stfscan.hpp stfhtml.hpp stfilter.hpp stfencod.hpp
+stfilter.o: stfilter.cpp stfilter.hpp
+stfscan.o: stfscan.cpp stfscan.hpp
+text2text.o: text2text.cpp stfilter.hpp stfencod.hpp stfhtml.hpp \
+ version.h
+version.o: version.h
@@ -0,0 +1,303 @@
+// +-------------------------------------------------------------------------+
+// |                   StreamFilters library vers. 0.1.01                    |
+// |  Copyright (c) Andrey V. Stolyarov <croco at croco dot net> 2022, 2023  |
+// | ----------------------------------------------------------------------- |
+// | This is free software.  Permission is granted to everyone to use, copy  |
+// |        or modify this software under the terms and conditions of        |
+// |                 GNU LESSER GENERAL PUBLIC LICENSE, v. 2.1               |
+// |     as published by Free Software Foundation (see the file LGPL.txt)    |
+// |                                                                         |
+// | Please visit http://www.croco.net/software/stfilter to get a fresh copy |
+// | ----------------------------------------------------------------------- |
+// |   This code is provided strictly and exclusively on the "AS IS" basis.  |
+// | !!! THERE IS NO WARRANTY OF ANY KIND, NEITHER EXPRESSED NOR IMPLIED !!! |
+// +-------------------------------------------------------------------------+
+
+
+
+
+/* Throughput benchmark for the filters.  Every filter (and a couple
+   of chains the way Thalassa builds them) is run over a generated text,
+   first fed char by char with FeedChar, then with FeedBlock; the results
+   are compared, and the speed is reported in MB/s for both ways.
+   Then FeedBlock is measured for each of the scanning levels (see
+   stfscan.hpp) the CPU supports, on ASCII-heavy, KOI8-R Cyrillic and
+   mixed UTF-8 inputs; the results must be the same for all levels.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "stfilter.hpp"
+#include "stfencod.hpp"
+#include "stfhtml.hpp"
+#include "stfscan.hpp"
+
+
+class StreamFilterBenchSink : public StreamFilter {
+    char *buf;
+    int bufsize, used;
+public:
+    StreamFilterBenchSink() : StreamFilter(0), buf(0), bufsize(0), used(0) {}
+    ~StreamFilterBenchSink() { if(buf) free(buf); }
+    const char *Buf() const { return buf; }
+    int Used() const { return used; }
+private:
+    virtual void FeedChar(int c) { char ch = c; FeedBlock(&ch, 1); }
+    virtual void FeedBlock(const char *b, int len) {
+        if(used + len > bufsize) {
+            while(used + len > bufsize)
+                bufsize = bufsize ? 2 * bufsize : 4096;
+            buf = (char*)realloc(buf, bufsize);
+        }
+        memcpy(buf + used, b, len);
+        used += len;
+    }
+    virtual void Reset() { used = 0; }
+};
+
+
+static const char *const ascii_words[] = {
+    "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog",
+    "stream", "filter", "of", "characters", "is", "passed", "through",
+    "a", "chain", "and", "comes", "out", "converted", 0
+};
+
+static const char *const markup_words[] = {
+    "<b>bold</b>", "<i>it</i>", "a<b", "x&y",
+    "<a href=\"http://example.com/?a=1&b=2\">link</a>", "<script>",
+    "<!-- comment -->", "<pre>", "</pre>", "1>0", 0
+};
+
+    /* cp1251, koi8-r and utf8 for ``primer'' (Russian for ``example'') */
+static const char cp1251_word[] = "\xef\xf0\xe8\xec\xe5\xf0";
+static const char koi8r_word[] = "\xd0\xd2\xc9\xcd\xc5\xd2";
+static const char utf8_word[] =
+    "\xd0\xbf\xd1\x80\xd0\xb8\xd0\xbc\xd0\xb5\xd1\x80";
+
+enum text_kind { tk_ascii, tk_cp1251, tk_utf8, tk_koi8r };
+
+static char *make_text(int kind, int size, int *reslen)
+{
+    char *res = (char*)malloc(size + 64);
+    int n = 0, w = 0, m = 0, i;
+    unsigned int rnd = 12345;
+    while(n < size) {
+        rnd = rnd * 1103515245 + 12345;
+        int r = (rnd >> 16) % 100;
+        const char *word;
+        if(kind == tk_koi8r && r < 90) {
+            word = koi8r_word;
+        } else
+        if(kind != tk_ascii && kind != tk_koi8r && r < 30) {
+            word = kind == tk_cp1251 ? cp1251_word : utf8_word;
+        } else
+        if(r >= 90 && r < 98) {
+            word = markup_words[m];
+            m++;
+            if(!markup_words[m])
+                m = 0;
+        } else {
+            word = ascii_words[w];
+            w++;
+            if(!ascii_words[w])
+                w = 0;
+        }
+        for(i = 0; word[i] && n < size; i++)
+            res[n++] = word[i];
+        if(n >= size)
+            break;
+        res[n++] = r == 97 ? '\n' : (r > 97 ? '\n' : ' ');
+        if(r == 99 && n < size)
+            res[n++] = '\n';
+    }
+    *reslen = n;
+    return res;
+}
+
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+    /* returns MB/s; the output is left in the sink */
+static double run(StreamFilter *chain, const char *text, int len,
+                  bool block, int repeat)
+{
+    double t0 = now();
+    int r, i;
+    for(r = 0; r < repeat; r++) {
+        chain->ChainReset();
+        if(block) {
+            chain->FeedBlock(text, len);
+        } else {
+            for(i = 0; i < len; i++)
+                chain->FeedChar((unsigned char)text[i]);
+        }
+        chain->FeedEnd();
+    }
+    double t = now() - t0;
+    return (double)len * repeat / (1024.0 * 1024.0) / t;
+}
+
+static int failures = 0;
+
+static void bench(const char *name, StreamFilter *chain,
+                  StreamFilterBenchSink *sink,
+                  const char *text, int len, int repeat)
+{
+    double cs = run(chain, text, len, false, repeat);
+    int clen = sink->Used();
+    char *cres = (char*)malloc(clen + 1);
+    memcpy(cres, sink->Buf(), clen);
+    double bs = run(chain, text, len, true, repeat);
+    bool same = clen == sink->Used() && !memcmp(cres, sink->Buf(), clen);
+    if(!same)
+        failures++;
+    printf("%-26s %9.1f MB/s %9.1f MB/s  %5.2fx  %s\n",
+           name, cs, bs, bs / cs, same ? "ok" : "MISMATCH");
+    free(cres);
+}
+
+static const char * const level_names[] = { "scalar", "sse2", "avx2" };
+
+static void bench_levels(const char *name, StreamFilter *chain,
+                         StreamFilterBenchSink *sink,
+                         const char *text, int len, int repeat)
+{
+    char *res0 = 0;
+    int len0 = 0;
+    int best = streamfilter_set_scan_level(streamfilter_scan_avx2);
+    int lev;
+    printf("%-34s", name);
+    for(lev = 0; lev <= best; lev++) {
+        streamfilter_set_scan_level(lev);
+        double bs = run(chain, text, len, true, repeat);
+        bool same = true;
+        if(lev == 0) {
+            len0 = sink->Used();
+            res0 = (char*)malloc(len0 + 1);
+            memcpy(res0, sink->Buf(), len0);
+        } else {
+            same = len0 == sink->Used() && !memcmp(res0, sink->Buf(), len0);
+        }
+        if(!same)
+            failures++;
+        printf(" %9.1f%s", bs, same ? " " : "!");
+    }
+    printf("\n");
+    free(res0);
+    streamfilter_set_scan_level(-1);
+}
+
+static const char * const allowed_tags[] = {
+    "b", "i", "a", "pre", "p", 0
+};
+static const char * const pre_tags[] = { "pre", 0 };
+
+int main(int argc, char **argv)
+{
+    int size = argc > 1 ? atoi(argv[1]) : 1024*1024;
+    int repeat = argc > 2 ? atoi(argv[2]) : 20;
+    int alen, clen, ulen, klen;
+    char *atext = make_text(tk_ascii, size, &alen);
+    char *ctext = make_text(tk_cp1251, size, &clen);
+    char *utext = make_text(tk_utf8, size, &ulen);
+    char *ktext = make_text(tk_koi8r, size, &klen);
+    const int *cp1251 =
+        StreamFilterExtAsciiToUtf8::GetTable(streamfilter_enc_cp1251);
+    const int * const *koi8r =
+        StreamFilterUtf8ToExtAscii::GetTable(streamfilter_enc_koi8r);
+
+    printf("%d bytes x %d\n", size, repeat);
+    printf("%-26s %14s %14s %7s\n", "", "FeedChar", "FeedBlock", "");
+
+    StreamFilterBenchSink sink;
+    {
+        StreamFilterHtmlProtect f(&sink);
+        bench("HtmlProtect", &f, &sink, atext, alen, repeat);
+    }
+    {
+        StreamFilterHtmlTags f(allowed_tags, &sink);
+        bench("HtmlTags", &f, &sink, atext, alen, repeat);
+    }
+    {
+        StreamFilterHtmlReplaceNL f(false, &sink);
+        bench("HtmlReplaceNL", &f, &sink, atext, alen, repeat);
+    }
+    {
+        StreamFilterExtAsciiToUtf8 f(cp1251, &sink);
+        bench("ExtAsciiToUtf8 (cp1251)", &f, &sink, ctext, clen, repeat);
+    }
+    {
+        StreamFilterUtf8ToExtAscii f(koi8r, &sink);
+        bench("Utf8ToExtAscii (koi8r)", &f, &sink, utext, ulen, repeat);
+    }
+    {
+        StreamFilterUtf8ToHtml f(koi8r, &sink);
+        bench("Utf8ToHtml (koi8r)", &f, &sink, utext, ulen, repeat);
+    }
+    {
+            /* the ``content'' chain for a cp1251 source, utf8 target */
+        StreamFilterHtmlTags tags(allowed_tags, &sink);
+        tags.AddControlledNLReplacer(pre_tags, false);
+        StreamFilterExtAsciiToUtf8 enc(cp1251, &tags);
+        bench("chain: content", &enc, &sink, ctext, clen, repeat);
+            /* the NL replacer made by the tags filter is leaked here */
+    }
+    {
+            /* the ``userdata'' chain for a utf8 source, koi8r target */
+        StreamFilterUtf8ToHtml enc(koi8r, &sink);
+        StreamFilterHtmlProtect prot(&enc);
+        bench("chain: userdata", &prot, &sink, utext, ulen, repeat);
+    }
+
+
+    int best = streamfilter_set_scan_level(streamfilter_scan_avx2);
+    int lev;
+    printf("\nFeedBlock, MB/s by scan level    ");
+    for(lev = 0; lev <= best; lev++)
+        printf(" %10s", level_names[lev]);
+    printf("\n");
+    streamfilter_set_scan_level(-1);
+    {
+        StreamFilterHtmlProtect f(&sink);
+        bench_levels("HtmlProtect, ascii", &f, &sink, atext, alen, repeat);
+        bench_levels("HtmlProtect, mixed utf8", &f, &sink,
+                     utext, ulen, repeat);
+    }
+    {
+        StreamFilterHtmlReplaceNL f(false, &sink);
+        bench_levels("HtmlReplaceNL, ascii", &f, &sink, atext, alen, repeat);
+    }
+    {
+        StreamFilterUtf8ToHtml f(koi8r, &sink);
+        bench_levels("Utf8ToHtml, ascii", &f, &sink, atext, alen, repeat);
+        bench_levels("Utf8ToHtml, mixed utf8", &f, &sink,
+                     utext, ulen, repeat);
+    }
+    {
+        const int *koi8r_to_utf =
+            StreamFilterExtAsciiToUtf8::GetTable(streamfilter_enc_koi8r);
+        StreamFilterExtAsciiToUtf8 f(koi8r_to_utf, &sink);
+        bench_levels("ExtAsciiToUtf8, ascii", &f, &sink, atext, alen, repeat);
+        bench_levels("ExtAsciiToUtf8, koi8r", &f, &sink, ktext, klen, repeat);
+    }
+    {
+        StreamFilterUtf8ToHtml enc(koi8r, &sink);
+        StreamFilterHtmlProtect prot(&enc);
+        bench_levels("chain: userdata, ascii", &prot, &sink,
+                     atext, alen, repeat);
+        bench_levels("chain: userdata, mixed utf8", &prot, &sink,
+                     utext, ulen, repeat);
+    }
+
+    free(atext);
+    free(ctext);
+    free(utext);
+    free(ktext);
+    return failures ? 1 : 0;
+}
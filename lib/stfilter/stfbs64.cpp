@@ -46,6 +46,35 @@ void StreamFilterBase64encode::FeedChar(int c)
     }
 }
 
+    /* the leftover of the previous call is completed by FeedChar, then
+       the whole triples are encoded into a local buffer, and what is
+       left of the block goes to FeedChar again
+     */
+void StreamFilterBase64encode::FeedBlock(const char *buf, int len)
+{
+    enum { outsize = 256 };   // a multiple of 4
+    char out[outsize];
+    const unsigned char *p = (const unsigned char *)buf;
+    const unsigned char *end = p + len;
+    while(count != 0 && p < end)
+        FeedChar(*p++);
+    int n = 0;
+    while(end - p >= 3) {
+        if(n >= outsize) {
+            PutBlock(out, n);
+            n = 0;
+        }
+        out[n++] = b64_digit(p[0] >> 2);
+        out[n++] = b64_digit((p[0] << 4) | (p[1] >> 4));
+        out[n++] = b64_digit((p[1] << 2) | (p[2] >> 6));
+        out[n++] = b64_digit(p[2]);
+        p += 3;
+    }
+    PutBlock(out, n);
+    while(p < end)
+        FeedChar(*p++);
+}
+
 void StreamFilterBase64encode::FeedEnd()
 {
     if(count == 0)
@@ -75,13 +104,24 @@ public:
     virtual void FeedChar(int c) { putchar(c); }
 };
 
-int main()
+    /* with -b, the input is fed by blocks; the block size is not a
+       multiple of 3, so the leftovers are carried between the blocks,
+       and the output must be the same as without -b
+     */
+int main(int argc, char **argv)
 {
     StreamFilterOutput out;
     StreamFilterBase64encode enc(&out);
-    int c;
-    while((c = getchar()) != EOF) {
-        enc.FeedChar(c);
+    if(argc > 1 && argv[1][0] == '-' && argv[1][1] == 'b') {
+        char buf[1000];
+        int rc;
+        while((rc = fread(buf, 1, sizeof(buf), stdin)) > 0)
+            enc.FeedBlock(buf, rc);
+    } else {
+        int c;
+        while((c = getchar()) != EOF) {
+            enc.FeedChar(c);
+        }
     }
     enc.FeedEnd();
     putchar('\n');
@@ -28,6 +28,7 @@ public:
     StreamFilterBase64encode(StreamFilter *next)
         : StreamFilter(next), count(0) {}
     void FeedChar(int c);
+    void FeedBlock(const char *buf, int len);
     void FeedEnd();
     void Reset() { count = 0; }
 };
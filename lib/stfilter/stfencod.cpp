@@ -16,13 +16,43 @@
 
 
 
+#include "stfscan.hpp"
 #include "stfencod.hpp"
 
 
 
+    // returns the count of bytes stored into out (up to 4)
+static int encode_utf8(int c2, char *out)
+{
+    if(c2 < 0x800) {  /* 110xxxxx 10xxxxxx */
+        out[0] = 0xC0 | ((c2 >> 6) & 0x1F);
+        out[1] = 0x80 | (c2 & 0x3F);
+        return 2;
+    }
+    if(c2 < 0x10000) {  /* 1110xxxx 10xxxxxx 10xxxxxx */
+        out[0] = 0xE0 | ((c2 >> 12) & 0x0F);
+        out[1] = 0x80 | ((c2 >> 6) & 0x3F);
+        out[2] = 0x80 | (c2 & 0x3F);
+        return 3;
+    }
+    /* well, here perhaps should be a check for (c2 < 0x11000) which is
+       the UTF8 upper limit, but we just drop the "extra" bits; finally,
+       these codes come from the table supplied by the application, not
+       retrieved from the external world, so we leave it to the programmer
+       to make sure the codes are correct.
+     */
+        /* 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx */
+    out[0] = 0xF0 | ((c2 >> 18) & 0x03);
+    out[1] = 0x80 | ((c2 >> 12) & 0x3F);
+    out[2] = 0x80 | ((c2 >> 6) & 0x3F);
+    out[3] = 0x80 | (c2 & 0x3F);
+    return 4;
+}
+
 void StreamFilterExtAsciiToUtf8::FeedChar(int c)
 {
-    int c2;
+    int c2, i, n;
+    char out[4];
     if(c < 0x80) {   /* ASCII symbol goes unchanged */
         PutChar(c);
         return;
@@ -41,28 +71,36 @@ void StreamFilterExtAsciiToUtf8::FeedChar(int c)
         return;
     }
 #endif
-    if(c2 < 0x800) {  /* 110xxxxx 10xxxxxx */
-        PutChar(0xC0 | ((c2 >> 6) & 0x1F));
-        PutChar(0x80 | (c2 & 0x3F));
-        return;
-    }
-    if(c2 < 0x10000) {  /* 1110xxxx 10xxxxxx 10xxxxxx */
-        PutChar(0xE0 | ((c2 >> 12) & 0x0F));
-        PutChar(0x80 | ((c2 >> 6) & 0x3F));
-        PutChar(0x80 | (c2 & 0x3F));
-        return;
-    }
-    /* well, here perhaps should be a check for (c2 < 0x11000) which is
-       the UTF8 upper limit, but we just drop the "extra" bits; finally,
-       these codes come from the table supplied by the application, not
-       retrieved from the external world, so we leave it to the programmer
-       to make sure the codes are correct.
+    n = encode_utf8(c2, out);
+    for(i = 0; i < n; i++)
+        PutChar((unsigned char)out[i]);
+}
+
+    /* ASCII runs go on as they are; runs of non-ASCII chars are
+       encoded into a local buffer which is then passed as a whole
      */
-        /* 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx */
-    PutChar(0xF0 | ((c2 >> 18) & 0x03));
-    PutChar(0x80 | ((c2 >> 12) & 0x3F));
-    PutChar(0x80 | ((c2 >> 6) & 0x3F));
-    PutChar(0x80 | (c2 & 0x3F));
+void StreamFilterExtAsciiToUtf8::FeedBlock(const char *buf, int len)
+{
+    enum { outsize = 256 };
+    char out[outsize];
+    const unsigned char *p = (const unsigned char *)buf;
+    const unsigned char *end = p + len;
+    while(p < end) {
+        const unsigned char *q =
+            p + streamfilter_span_ascii((const char *)p, end - p);
+        PutBlock((const char *)p, q - p);
+        int n = 0;
+        while(q < end && *q >= 0x80) {
+            if(n > outsize - 4) {
+                PutBlock(out, n);
+                n = 0;
+            }
+            n += encode_utf8(the_table[*q - 0x80], out + n);
+            q++;
+        }
+        PutBlock(out, n);
+        p = q;
+    }
 }
 
 
@@ -114,6 +152,76 @@ void StreamFilterUtf8ToExtAscii::FeedChar(int c)
     }
 }
 
+    // decode a complete well-formed 2- or 3-byte sequence; -1 otherwise
+static int decode_utf8_seq(const unsigned char *p, const unsigned char *end,
+                           int *seqlen)
+{
+    int code;
+    if((p[0] & 0xE0) == 0xC0) {
+        if(end - p < 2 || (p[1] & 0xC0) != 0x80)
+            return -1;
+        code = ((p[0] & 0x1F) << 6) | (p[1] & 0x3F);
+        if(code < 0x80)
+            return -1;
+        *seqlen = 2;
+        return code;
+    }
+    if((p[0] & 0xF0) == 0xE0) {
+        if(end - p < 3 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80)
+            return -1;
+        code = ((p[0] & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+        if(code < 0x800)
+            return -1;
+        *seqlen = 3;
+        return code;
+    }
+    return -1;
+}
+
+    /* ASCII runs go on as they are; well-formed sequences for the
+       codes present in the table are decoded into a local buffer;
+       everything else (errors, unknown codes, sequences broken by
+       the end of the block) is left to FeedChar, byte by byte
+     */
+void StreamFilterUtf8ToExtAscii::FeedBlock(const char *buf, int len)
+{
+    enum { outsize = 256 };
+    char out[outsize];
+    int n = 0;
+    const unsigned char *p = (const unsigned char *)buf;
+    const unsigned char *end = p + len;
+    while(p < end) {
+        if(expected == 0) {
+            if(*p < 0x80) {
+                const unsigned char *q =
+                    p + streamfilter_span_ascii((const char *)p, end - p);
+                PutBlock(out, n);
+                n = 0;
+                PutBlock((const char *)p, q - p);
+                p = q;
+                continue;
+            }
+            int seqlen;
+            int code = decode_utf8_seq(p, end, &seqlen);
+            int rescode = code == -1 ? -1 : FindCode(code);
+            if(rescode != -1) {
+                if(n >= outsize) {
+                    PutBlock(out, n);
+                    n = 0;
+                }
+                out[n++] = rescode;
+                p += seqlen;
+                continue;
+            }
+        }
+        PutBlock(out, n);
+        n = 0;
+        FeedChar(*p);
+        p++;
+    }
+    PutBlock(out, n);
+}
+
 void StreamFilterUtf8ToExtAscii::FeedEnd()
 {
     if(expected != 0) {
@@ -144,20 +252,21 @@ void StreamFilterUtf8ToExtAscii::UnknownCode(int code)
     PutChar(']');
 }
 
-void StreamFilterUtf8ToExtAscii::HandleMultibyte(int code)
+int StreamFilterUtf8ToExtAscii::FindCode(int code) const
 {
-    int rescode = -1;
-
-    // first, try to find it in the table
     // remember, each ``line'' of the table starts with
     //   the first codepoint and the length
     const int * const *p;
     for(p = the_table; *p; p++) {
-        if(code >= (*p)[0] && code < (*p)[0] + (*p)[1]) {  // found?
-            rescode = (*p)[code - (*p)[0] + 2];
-            break;
-        }
+        if(code >= (*p)[0] && code < (*p)[0] + (*p)[1])  // found?
+            return (*p)[code - (*p)[0] + 2];
     }
+    return -1;
+}
+
+void StreamFilterUtf8ToExtAscii::HandleMultibyte(int code)
+{
+    int rescode = FindCode(code);
 
     if(rescode == -1)    // remains unknown
         UnknownCode(code);
@@ -27,6 +27,7 @@ public:
     StreamFilterExtAsciiToUtf8(const int *table, StreamFilter *next)
         : StreamFilter(next), the_table(table) {}
     void FeedChar(int c);
+    void FeedBlock(const char *buf, int len);
 
     static const int *FindTable(const char *encname);
     static const int *GetTable(int encoding);
@@ -40,6 +41,7 @@ public:
     StreamFilterUtf8ToExtAscii(const int * const *table, StreamFilter *next)
         : StreamFilter(next), the_table(table), expected(0), received(0) {}
     void FeedChar(int c);
+    void FeedBlock(const char *buf, int len);
     void FeedEnd();
     void Reset();
 
@@ -48,6 +50,7 @@ public:
 
 private:
     void HandleMultibyte(int code);
+    int FindCode(int code) const;  //!< -1 if there's no such code
 
 public:
     static const int * const *FindTable(const char *encname);
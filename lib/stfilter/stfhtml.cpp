@@ -16,15 +16,17 @@
 
 
 
-#include <string.h>    // for strlen, str[i]cmp
+#include <string.h>    // for strlen, memchr
 
+#include "stfscan.hpp"
 #include "stfhtml.hpp"
 
 
 StreamFilterHtmlTags::
 StreamFilterHtmlTags(const char * const * anames, StreamFilter *next)
     : StreamFilter(next), names(anames), pre_tags(0),
-    astate(start), qstate(unquoted), namebuf(0), namebufsize(0)
+    astate(start), qstate(unquoted), namebuf(0), namebufsize(0),
+    pre_level(0)
 {
 }
 
@@ -90,6 +92,34 @@ void StreamFilterHtmlTags::FeedChar(int c)
     }
 }
 
+    /* Outside of tags, everything up to the next '<' goes on unchanged,
+       and inside comments everything up to the next '-' is dropped;
+       the rest is left to FeedChar, char by char
+     */
+void StreamFilterHtmlTags::FeedBlock(const char *buf, int len)
+{
+    const char *end = buf + len;
+    while(buf < end) {
+        if(qstate == unquoted && astate == start) {
+            const char *p = (const char *)memchr(buf, '<', end - buf);
+            if(!p) {
+                PutBlock(buf, end - buf);
+                return;
+            }
+            PutBlock(buf, p - buf);
+            buf = p;
+        } else
+        if(qstate == unquoted && astate == comment) {
+            const char *p = (const char *)memchr(buf, '-', end - buf);
+            if(!p)
+                return;
+            buf = p;
+        }
+        FeedChar((unsigned char)*buf);
+        buf++;
+    }
+}
+
 void StreamFilterHtmlTags::FeedEnd()
 {
     if(astate == allowed_tag) {
@@ -112,6 +142,7 @@ void StreamFilterHtmlTags::Reset()
 {
     astate = start;
     qstate = unquoted;
+    pre_level = 0;
 }
 
 void StreamFilterHtmlTags::
@@ -130,10 +161,12 @@ void StreamFilterHtmlTags::HandleStart(int c)
         astate = just_started_tag;
         negtag = false;
         namebufidx = 0;
-            /* We don't make the buffer a correct string (z-term.) here
-               because the buffer may still be unallocated.  It will
-               become a valid string when the first char is processed.
+            /* The buffer may still be unallocated here; if it is not,
+               we make it an empty string so that a tag which ends up
+               without a name isn't mistaken for the previous one.
              */
+        if(namebuf)
+            *namebuf = 0;
     } else
         PutChar(c);
 }
@@ -359,6 +392,7 @@ void StreamFilterHtmlTags::AllocateNameBuf()
     }
     namebufsize = maxlen+1;
     namebuf = new char[namebufsize];
+    namebuf[0] = 0;
     namebufidx = 0;
 }
 
@@ -381,6 +415,8 @@ void StreamFilterHtmlTags::CheckTagName()
 
 void StreamFilterHtmlTags::ChangeNLModeIfNecessary()
 {
+    if(!namebuf)   // no tag had a name so far
+        return;
     if(tagname_is_there(namebuf, pre_tags)) {
         if(negtag) {
             if(pre_level > 0)
@@ -445,6 +481,26 @@ void StreamFilterHtmlReplaceNL::FeedChar(int c)
     };
 }
 
+    /* in the plain and disabled states, all chars but NLs and CRs
+       are passed as they are, so we only have to look for these two
+     */
+void StreamFilterHtmlReplaceNL::FeedBlock(const char *buf, int len)
+{
+    const char *end = buf + len;
+    while(buf < end) {
+        if(state == plain || state == disabled) {
+            const char *p =
+                buf + streamfilter_span_except(buf, end - buf, "\n\r");
+            PutBlock(buf, p - buf);
+            if(p == end)
+                return;
+            buf = p;
+        }
+        FeedChar((unsigned char)*buf);
+        buf++;
+    }
+}
+
 void StreamFilterHtmlReplaceNL::FeedEnd()
 {
     if(state != start)   // at least one char was output!
@@ -460,6 +516,7 @@ void StreamFilterHtmlReplaceNL::FeedEnd()
 void StreamFilterHtmlReplaceNL::Reset()
 {
     state = start;
+    out_cr = false;
 }
 
 void StreamFilterHtmlReplaceNL::PutNL()
@@ -480,6 +537,19 @@ void StreamFilterHtmlProtect::FeedChar(int c)
     }
 }
 
+void StreamFilterHtmlProtect::FeedBlock(const char *buf, int len)
+{
+    const char *end = buf + len;
+    while(buf < end) {
+        const char *p = buf + streamfilter_span_except(buf, end - buf, "<>&");
+        PutBlock(buf, p - buf);
+        if(p == end)
+            return;
+        FeedChar(*p);
+        buf = p + 1;
+    }
+}
+
 void StreamFilterHtmlReplaceNL::Enable()
 {
     state = start;
@@ -70,6 +70,7 @@ public:
     ~StreamFilterHtmlTags();
 
     void FeedChar(int c);
+    void FeedBlock(const char *buf, int len);
     void FeedEnd();
     void Reset();
 
@@ -127,6 +128,7 @@ public:
     ~StreamFilterHtmlReplaceNL() {}
 
     void FeedChar(int c);
+    void FeedBlock(const char *buf, int len);
     void FeedEnd();
     void Reset();
 
@@ -145,6 +147,7 @@ public:
     ~StreamFilterHtmlProtect() {}
 
     void FeedChar(int c);
+    void FeedBlock(const char *buf, int len);
 };
 
 //! Decode utf8 replacing unknown chars with HTML entities
@@ -16,6 +16,8 @@
 
 
 
+#include <string.h>    // for memcpy, strlen
+
 #include "stfilter.hpp"
 
 
@@ -47,13 +49,17 @@ void StreamFilter::ChainReset()
         dest->ChainReset();
 }
 
+void StreamFilter::FeedBlock(const char *buf, int len)
+{
+    const unsigned char *p = (const unsigned char *)buf;
+    const unsigned char *end = p + len;
+    for(; p < end; p++)
+        FeedChar(*p);
+}
+
 void StreamFilter::PutStr(const char *s)
 {
-    const char *p = s;
-    while(*p) {
-        PutChar(*p);
-        p++;
-    }
+    PutBlock(s, strlen(s));
 }
 
 void StreamFilter::PutHex(unsigned long long n, int minsigns, bool uppercase)
@@ -97,10 +103,19 @@ char *StreamFilterDestination::ReleaseBuffer()
 void StreamFilterDestination::FeedChar(int c)
 {
     if(buflen - buf_used < 2)
-        More();
-    buf[buf_used-1] = c;
-    buf[buf_used] = 0;
+        More(1);
+    buf[buf_used] = c;
     buf_used++;
+    buf[buf_used] = 0;
+}
+
+void StreamFilterDestination::FeedBlock(const char *b, int len)
+{
+    if(buflen - buf_used < len + 1)
+        More(len);
+    memcpy(buf + buf_used, b, len);
+    buf_used += len;
+    buf[buf_used] = 0;
 }
 
 void StreamFilterDestination::Reset()
@@ -108,16 +123,21 @@ void StreamFilterDestination::Reset()
     buf_used = 0;
 }
 
-void StreamFilterDestination::More()
+    // make sure there's room for ``need'' more chars plus the '\0'
+void StreamFilterDestination::More(int need)
 {
     if(!buf) {
         buflen = start_bufsize;
-        buf = new char[start_bufsize];
+        while(buflen < need + 1)
+            buflen = bufsize_step>0 ? buflen + bufsize_step : 2*buflen;
+        buf = new char[buflen];
         *buf = 0;
         buf_used = 0;
         return;
     }
-    int newlen = bufsize_step>0 ? buflen + bufsize_step : 2*buflen;
+    int newlen = buflen;
+    while(newlen - buf_used < need + 1)
+        newlen = bufsize_step>0 ? newlen + bufsize_step : 2*newlen;
     char *nbuf = new char[newlen];
     int i;
     for(i = 0; i <= buf_used; i++)   /* note <= because of term. '\0' */
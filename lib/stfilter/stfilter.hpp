@@ -35,6 +35,17 @@ public:
     virtual void FeedChar(int c) = 0;
     virtual void FeedEnd() { PutEnd(); }
 
+        //! Feed a block of chars at once
+        /*! The default implementation simply calls FeedChar for every
+            byte (as an unsigned char), so filters only have to override
+            it if they can do better.  Filters that do override it
+            normally look for the chars they are interested in and pass
+            the runs in between to the next filter with PutBlock, as is.
+            \note the chars are passed as unsigned; zero bytes are
+            not special here
+         */
+    virtual void FeedBlock(const char *buf, int len);
+
     void ChainReset(); // calls Reset() for every object in the chain
     virtual void Reset() {}
 
@@ -68,6 +79,8 @@ public:
 protected:
     void PutChar(int c) { if(dest) dest->FeedChar(c); }
     void PutEnd() { if(dest) dest->FeedEnd(); }
+    void PutBlock(const char *buf, int len)
+        { if(dest && len > 0) dest->FeedBlock(buf, len); }
     void PutStr(const char *s);
 
         /*! \param minsigns minimal number of digits (zeroes added
@@ -103,8 +116,9 @@ public:
     char *ReleaseBuffer();
 private:
     virtual void FeedChar(int c);
+    virtual void FeedBlock(const char *buf, int len);
     virtual void Reset();
-    void More();
+    void More(int need);
 };
 
 
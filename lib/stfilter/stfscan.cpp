@@ -0,0 +1,209 @@
+// +-------------------------------------------------------------------------+
+// |                   StreamFilters library vers. 0.1.01                    |
+// |  Copyright (c) Andrey V. Stolyarov <croco at croco dot net> 2022, 2023  |
+// | ----------------------------------------------------------------------- |
+// | This is free software.  Permission is granted to everyone to use, copy  |
+// |        or modify this software under the terms and conditions of        |
+// |                 GNU LESSER GENERAL PUBLIC LICENSE, v. 2.1               |
+// |     as published by Free Software Foundation (see the file LGPL.txt)    |
+// |                                                                         |
+// | Please visit http://www.croco.net/software/stfilter to get a fresh copy |
+// | ----------------------------------------------------------------------- |
+// |   This code is provided strictly and exclusively on the "AS IS" basis.  |
+// | !!! THERE IS NO WARRANTY OF ANY KIND, NEITHER EXPRESSED NOR IMPLIED !!! |
+// +-------------------------------------------------------------------------+
+
+
+#include "stfscan.hpp"
+
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define STFSCAN_X86 1
+#include <immintrin.h>
+#endif
+
+
+static int span_ascii_scalar(const char *buf, int len)
+{
+    const unsigned char *p = (const unsigned char *)buf;
+    int i;
+    for(i = 0; i < len; i++)
+        if(p[i] & 0x80)
+            break;
+    return i;
+}
+
+    /* the stops are always given as 4 chars, the short sets being
+       padded with their first char; see prepare_stops below */
+static int span_except_scalar(const char *buf, int len, const char *st)
+{
+    int i;
+    for(i = 0; i < len; i++) {
+        char c = buf[i];
+        if(c == st[0] || c == st[1] || c == st[2] || c == st[3])
+            break;
+    }
+    return i;
+}
+
+#ifdef STFSCAN_X86
+
+__attribute__((target("sse2")))
+static int span_ascii_sse2(const char *buf, int len)
+{
+    int i;
+    for(i = 0; i + 16 <= len; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(buf + i));
+        int mask = _mm_movemask_epi8(x);
+        if(mask)
+            return i + __builtin_ctz(mask);
+    }
+    return i + span_ascii_scalar(buf + i, len - i);
+}
+
+__attribute__((target("sse2")))
+static int span_except_sse2(const char *buf, int len, const char *st)
+{
+    __m128i s0 = _mm_set1_epi8(st[0]);
+    __m128i s1 = _mm_set1_epi8(st[1]);
+    __m128i s2 = _mm_set1_epi8(st[2]);
+    __m128i s3 = _mm_set1_epi8(st[3]);
+    int i;
+    for(i = 0; i + 16 <= len; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(buf + i));
+        __m128i m = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(x, s0), _mm_cmpeq_epi8(x, s1)),
+            _mm_or_si128(_mm_cmpeq_epi8(x, s2), _mm_cmpeq_epi8(x, s3)));
+        int mask = _mm_movemask_epi8(m);
+        if(mask)
+            return i + __builtin_ctz(mask);
+    }
+    return i + span_except_scalar(buf + i, len - i, st);
+}
+
+__attribute__((target("avx2")))
+static int span_ascii_avx2(const char *buf, int len)
+{
+    int i;
+    for(i = 0; i + 32 <= len; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(buf + i));
+        unsigned int mask = _mm256_movemask_epi8(x);
+        if(mask)
+            return i + __builtin_ctz(mask);
+    }
+    return i + span_ascii_sse2(buf + i, len - i);
+}
+
+__attribute__((target("avx2")))
+static int span_except_avx2(const char *buf, int len, const char *st)
+{
+    __m256i s0 = _mm256_set1_epi8(st[0]);
+    __m256i s1 = _mm256_set1_epi8(st[1]);
+    __m256i s2 = _mm256_set1_epi8(st[2]);
+    __m256i s3 = _mm256_set1_epi8(st[3]);
+    int i;
+    for(i = 0; i + 32 <= len; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(buf + i));
+        __m256i m = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(x, s0),
+                            _mm256_cmpeq_epi8(x, s1)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(x, s2),
+                            _mm256_cmpeq_epi8(x, s3)));
+        unsigned int mask = _mm256_movemask_epi8(m);
+        if(mask)
+            return i + __builtin_ctz(mask);
+    }
+    return i + span_except_sse2(buf + i, len - i, st);
+}
+
+static int best_level()
+{
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2"))
+        return streamfilter_scan_avx2;
+    if(__builtin_cpu_supports("sse2"))
+        return streamfilter_scan_sse2;
+    return streamfilter_scan_scalar;
+}
+
+#else
+
+static int best_level()
+{
+    return streamfilter_scan_scalar;
+}
+
+#endif
+
+
+static int the_level = -1;
+static int (*span_ascii_fn)(const char *, int) = 0;
+static int (*span_except_fn)(const char *, int, const char *) = 0;
+
+int streamfilter_set_scan_level(int level)
+{
+    int best = best_level();
+    if(level < 0 || level > best)
+        level = best;
+    switch(level) {
+#ifdef STFSCAN_X86
+    case streamfilter_scan_avx2:
+        span_ascii_fn = span_ascii_avx2;
+        span_except_fn = span_except_avx2;
+        break;
+    case streamfilter_scan_sse2:
+        span_ascii_fn = span_ascii_sse2;
+        span_except_fn = span_except_sse2;
+        break;
+#endif
+    default:
+        level = streamfilter_scan_scalar;
+        span_ascii_fn = span_ascii_scalar;
+        span_except_fn = span_except_scalar;
+    }
+    the_level = level;
+    return level;
+}
+
+int streamfilter_scan_level()
+{
+    if(the_level == -1)
+        streamfilter_set_scan_level(-1);
+    return the_level;
+}
+
+    /* runs are often just a few chars long in markup-heavy texts, and
+       vectors don't pay off for them, so we always look at the first
+       few chars with the plain loop and only then go for the vectors
+     */
+enum { probe_len = 16 };
+
+int streamfilter_span_ascii(const char *buf, int len)
+{
+    int n = len < probe_len ? len : probe_len;
+    int i = span_ascii_scalar(buf, n);
+    if(i < n || n == len)
+        return i;
+    if(!span_ascii_fn)
+        streamfilter_set_scan_level(-1);
+    return i + span_ascii_fn(buf + i, len - i);
+}
+
+int streamfilter_span_except(const char *buf, int len, const char *stops)
+{
+    char st[4];
+    const char *s = stops;
+    int i;
+    for(i = 0; i < 4; i++) {
+        st[i] = *s ? *s : stops[0];
+        if(*s)
+            s++;
+    }
+    int n = len < probe_len ? len : probe_len;
+    i = span_except_scalar(buf, n, st);
+    if(i < n || n == len)
+        return i;
+    if(!span_except_fn)
+        streamfilter_set_scan_level(-1);
+    return i + span_except_fn(buf + i, len - i, st);
+}
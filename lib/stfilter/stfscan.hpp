@@ -0,0 +1,50 @@
+// +-------------------------------------------------------------------------+
+// |                   StreamFilters library vers. 0.1.01                    |
+// |  Copyright (c) Andrey V. Stolyarov <croco at croco dot net> 2022, 2023  |
+// | ----------------------------------------------------------------------- |
+// | This is free software.  Permission is granted to everyone to use, copy  |
+// |        or modify this software under the terms and conditions of        |
+// |                 GNU LESSER GENERAL PUBLIC LICENSE, v. 2.1               |
+// |     as published by Free Software Foundation (see the file LGPL.txt)    |
+// |                                                                         |
+// | Please visit http://www.croco.net/software/stfilter to get a fresh copy |
+// | ----------------------------------------------------------------------- |
+// |   This code is provided strictly and exclusively on the "AS IS" basis.  |
+// | !!! THERE IS NO WARRANTY OF ANY KIND, NEITHER EXPRESSED NOR IMPLIED !!! |
+// +-------------------------------------------------------------------------+
+
+
+#ifndef STFSCAN_HPP_SENTRY
+#define STFSCAN_HPP_SENTRY
+
+/* Scanning primitives used by the filters' FeedBlock methods to find
+   the end of a run of chars they pass on unchanged.  On x86 they are
+   done with SSE2 or AVX2, whichever is the best the CPU supports
+   (this is determined at runtime, on the first call); elsewhere, and
+   for the tails shorter than a vector, plain C loops are used.
+ */
+
+enum streamfilter_scan_levels {
+    streamfilter_scan_scalar = 0,
+    streamfilter_scan_sse2,
+    streamfilter_scan_avx2
+};
+
+    //! length of the leading run of bytes below 0x80
+int streamfilter_span_ascii(const char *buf, int len);
+
+    //! length of the leading run not containing any of the stops
+    /*! \param stops a string of 1 to 4 chars
+     */
+int streamfilter_span_except(const char *buf, int len, const char *stops);
+
+    //! the level currently used
+int streamfilter_scan_level();
+
+    //! force the given level (mostly for testing and benchmarks)
+    /*! If the CPU doesn't support the level, the best one it does
+        support is used instead; the level actually set is returned.
+     */
+int streamfilter_set_scan_level(int level);
+
+#endif
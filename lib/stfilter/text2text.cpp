@@ -33,6 +33,7 @@ public:
     void SetStream(FILE *s) { f = s; }
 private:
     virtual void FeedChar(int c) { fputc(c, f); }
+    virtual void FeedBlock(const char *buf, int len) { fwrite(buf, 1, len, f); }
 };
 
 #if 0
@@ -329,9 +330,10 @@ int main(int argc, char **argv)
         cp.dest->SetStream(out_f);
     }
 
-    int c;
-    while((c = fgetc(in_f)) != EOF)
-        chain->FeedChar(c);
+    char buf[8192];
+    int n;
+    while((n = fread(buf, 1, sizeof(buf), in_f)) > 0)
+        chain->FeedBlock(buf, n);
     chain->FeedEnd();
 
     if(cp.input)
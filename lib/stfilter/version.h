@@ -0,0 +1,2 @@
+#define STFILTER_VERSION "0.1.01"
+#define STFILTER_VERSIONID 101